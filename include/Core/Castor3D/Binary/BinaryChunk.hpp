@@ -39,7 +39,10 @@ namespace castor3d
 
 	//!\~english	The current format version number.
 	//!\~french		La version actuelle du format.
-	uint32_t constexpr CurrentCmshVersion = makeCmshVersion( 0x01u, 0x05u, 0x0000u );
+	uint32_t constexpr CurrentCmshVersion = makeCmshVersion( 0x02u, 0x00u, 0x0000u );
+	//!\~english	The alignment of chunk headers and payloads, from version 2.0.
+	//!\~french		L'alignement des en-têtes et données des chunks, depuis la version 2.0.
+	uint32_t constexpr CmshChunkAlignment = 16u;
 	//!\~english	A define to ease the declaration of a chunk id.
 	//!\~french		Un define pour faciliter la déclaration d'un id de chunk.
 	uint64_t constexpr makeChunkID( char a, char b, char c, char d
@@ -115,6 +118,10 @@ namespace castor3d
 		eSubmeshIndexComponentCount = makeChunkID( 'S', 'M', 'F', 'C', 'C', 'P', 'C', 'T' ),
 		eSubmeshIndexCount = makeChunkID( 'S', 'M', 'S', 'H', 'I', 'C', 'C', 'T' ),
 		eSubmeshIndices = makeChunkID( 'S', 'M', 'S', 'H', 'I', 'D', 'C', 'S' ),
+		// Version 1.6
+		eSkeletonAnimationKeyFrameObjectTranslate = makeChunkID( 'S', 'K', 'A', 'N', 'K', 'F', 'T', 'R' ),
+		eSkeletonAnimationKeyFrameObjectRotate = makeChunkID( 'S', 'K', 'A', 'N', 'K', 'F', 'R', 'T' ),
+		eSkeletonAnimationKeyFrameObjectScale = makeChunkID( 'S', 'K', 'A', 'N', 'K', 'F', 'S', 'C' ),
 	};
 	/**
 	 *\~english
@@ -180,6 +187,18 @@ namespace castor3d
 		 *\param[in]	size	La taille du tampon
 		 */
 		C3D_API void get( uint8_t * data, uint32_t size );
+		/**
+		 *\~english
+		 *\brief		Skips data from the chunk
+		 *\param[in]	size	The skipped size
+		 *\~french
+		 *\brief		Saute des données du chunk
+		 *\param[in]	size	La taille sautée
+		 */
+		void skip( uint32_t size )
+		{
+			m_index += size;
+		}
 		/**
 		 *\~english
 		 *\brief		Checks that the remaining place can hold the given size
@@ -242,6 +261,22 @@ namespace castor3d
 		 *\return		\p false si une erreur quelconque est arrivée
 		 */
 		C3D_API bool read( castor::BinaryFile & file );
+		/**
+		 *\~english
+		 *\brief		From memory reader function.
+		 *\remarks		The chunk doesn't copy the data, so the memory must outlive it and its subchunks.
+		 *\param[in]	data	The memory containing the chunk (a mapped file, for instance).
+		 *\param[in]	size	The memory size.
+		 *\return		\p false if any error occured
+		 *\~french
+		 *\brief		Fonction de lecture à partir de la mémoire.
+		 *\remarks		Le chunk ne copie pas les données, la mémoire doit donc lui survivre, ainsi qu'à ses sous-chunks.
+		 *\param[in]	data	La mémoire contenant le chunk (un fichier mappé, par exemple).
+		 *\param[in]	size	La taille de la mémoire.
+		 *\return		\p false si une erreur quelconque est arrivée
+		 */
+		C3D_API bool read( uint8_t const * data
+			, size_t size );
 		/**
 		 *\~english
 		 *\brief		Retrieves the remaining data
@@ -252,7 +287,7 @@ namespace castor3d
 		 */
 		inline uint8_t const * getRemainingData()const
 		{
-			return &m_data[m_index];
+			return getData() + m_index;
 		}
 		/**
 		 *\~english
@@ -276,7 +311,9 @@ namespace castor3d
 		 */
 		inline uint32_t getDataSize()const
 		{
-			return uint32_t( m_data.size() );
+			return m_view
+				? m_viewSize
+				: uint32_t( m_data.size() );
 		}
 		/**
 		 *\~english
@@ -288,7 +325,19 @@ namespace castor3d
 		 */
 		inline uint8_t const * getData()const
 		{
-			return m_data.data();
+			return m_view
+				? m_view
+				: m_data.data();
+		}
+		/**
+		 *\~english
+		 *\return		\p true if the chunk data is big endian (cmsh 1.x), \p false if it is little endian (cmsh 2.0 and later).
+		 *\~french
+		 *\return		\p true si les données du chunk sont en big endian (cmsh 1.x), \p false si elles sont en little endian (cmsh 2.0 et après).
+		 */
+		inline bool isBigEndian()const
+		{
+			return m_bigEndian;
 		}
 		/**
 		 *\~english
@@ -303,6 +352,8 @@ namespace castor3d
 		inline void setData( uint8_t const * begin
 			, uint8_t const * end )
 		{
+			m_view = nullptr;
+			m_viewSize = 0u;
 			m_data.assign( begin, end );
 		}
 		/**
@@ -313,7 +364,7 @@ namespace castor3d
 		 */
 		void endParse()
 		{
-			m_index = uint32_t( m_data.size() );
+			m_index = getDataSize();
 		}
 		/**
 		 *\~english
@@ -329,42 +380,16 @@ namespace castor3d
 	private:
 		C3D_API void binaryError( std::string_view view );
 
-	private:
-		template< typename T >
-		inline bool doRead( T * values
-			, uint32_t count )
-		{
-			auto size = count * uint32_t( sizeof( T ) );
-			bool result{ m_index + size < m_data.size() };
-
-			if ( result )
-			{
-				auto begin = reinterpret_cast< T * >( &m_data[m_index] );
-				auto end = begin + count;
-				auto value = values;
-
-				for ( auto it = begin; it != end; ++it )
-				{
-					( *value ) = *it;
-					prepareChunkData( *value );
-					++value;
-				}
-
-				m_index += size;
-			}
-			else
-			{
-				binaryError( "Not enough data in chunk" );
-			}
-
-			return result;
-		}
-
 	private:
 		ChunkType m_type;
 		castor::ByteArray m_data;
+		// When set, the chunk data is a view into its parent's (or a mapped file's) memory, m_data being unused.
+		uint8_t const * m_view{ nullptr };
+		uint32_t m_viewSize{ 0u };
 		uint32_t m_index;
+		bool m_bigEndian{ false };
 		std::list< castor::ByteArray > m_addedData;
+		uint32_t m_addedSize{ 0u };
 	};
 }
 
@@ -10,6 +10,9 @@ See LICENSE file in root folder
 #include "Castor3D/Miscellaneous/Logger.hpp"
 #include "Castor3D/Miscellaneous/Version.hpp"
 
+#include <CastorUtils/Data/BinaryFile.hpp>
+#include <CastorUtils/Data/MappedFile.hpp>
+
 namespace castor3d
 {
 	template< class TParsed >
@@ -50,35 +53,44 @@ namespace castor3d
 			BinaryChunk header;
 			bool result = header.read( file );
 
-			if ( header.getChunkType() != ChunkType::eCmshFile )
-			{
-				result = false;
-				checkError( result, "Not a valid CMSH file." );
-			}
-
-			if ( result )
-			{
-				result = doParseHeader( header );
-			}
-
 			if ( result )
 			{
-				result = header.checkAvailable( 1 );
-				checkError( result, "No more data in chunk." );
+				result = doParseFile( obj, header );
 			}
 
-			BinaryChunk chunk;
+			return result;
+		}
+		/**
+		 *\~english
+		 *\brief		From file reader function, mapping the file in memory.
+		 *\remarks		Falls back to a regular file read if the file can't be mapped.
+		 *\param[out]	obj		The object to read
+		 *\param[in]	path	The file path
+		 *\return		\p false if any error occured
+		 *\~french
+		 *\brief		Fonction de lecture à partir d'un fichier, en le mappant en mémoire.
+		 *\remarks		Se rabat sur une lecture classique si le fichier ne peut pas être mappé.
+		 *\param[out]	obj		L'objet à lire
+		 *\param[in]	path	Le chemin du fichier
+		 *\return		\p false si une erreur quelconque est arrivée
+		 */
+		inline bool parse( TParsed & obj
+			, castor::Path const & path )
+		{
+			castor::MappedFile mapped{ path };
 
-			if ( result )
+			if ( !mapped.isMapped() )
 			{
-				result = header.getSubChunk( chunk );
-				checkError( result, "Couldn't retrieve subchunk." );
+				castor::BinaryFile file{ path, castor::File::OpenMode::eRead };
+				return parse( obj, file );
 			}
 
+			BinaryChunk header;
+			bool result = header.read( mapped.getData(), mapped.getSize() );
+
 			if ( result )
 			{
-				result = parse( obj, chunk );
-				checkError( result, "Couldn't parse chunk." );
+				result = doParseFile( obj, header );
 			}
 
 			return result;
@@ -308,6 +320,56 @@ namespace castor3d
 		}
 
 	protected:
+		/**
+		 *\~english
+		 *\brief			Parses the content of a file chunk.
+		 *\param[out]		obj		The object to read.
+		 *\param[in,out]	header	The file chunk.
+		 *\return			\p false if any error occured.
+		 *\~french
+		 *\brief			Lit le contenu d'un chunk de fichier.
+		 *\param[out]		obj		L'objet à lire.
+		 *\param[in,out]	header	Le chunk de fichier.
+		 *\return			\p false si une erreur quelconque est arrivée.
+		 */
+		inline bool doParseFile( TParsed & obj
+			, BinaryChunk & header )
+		{
+			bool result = true;
+
+			if ( header.getChunkType() != ChunkType::eCmshFile )
+			{
+				result = false;
+				checkError( result, "Not a valid CMSH file." );
+			}
+
+			if ( result )
+			{
+				result = doParseHeader( header );
+			}
+
+			if ( result )
+			{
+				result = header.checkAvailable( 1 );
+				checkError( result, "No more data in chunk." );
+			}
+
+			BinaryChunk chunk;
+
+			if ( result )
+			{
+				result = header.getSubChunk( chunk );
+				checkError( result, "Couldn't retrieve subchunk." );
+			}
+
+			if ( result )
+			{
+				result = parse( obj, chunk );
+				checkError( result, "Couldn't parse chunk." );
+			}
+
+			return result;
+		}
 		/**
 		 *\~english
 		 *\brief			Parses the header chunk.
@@ -475,6 +537,24 @@ namespace castor3d
 		{
 			return ChunkParser< T >::parse( value, chunk );
 		}
+		/**
+		 *\~english
+		 *\brief		Retrieves a value array from a chunk, without copying it.
+		 *\param[in]	count	The values count
+		 *\param[in]	chunk	The chunk containing the values
+		 *\return		The values, \p nullptr if the chunk can't be mapped (big endian chunk).
+		 *\~french
+		 *\brief		Récupère un tableau de valeurs à partir d'un chunk, sans le copier.
+		 *\param[in]	count	Le nombre de valeurs
+		 *\param[in]	chunk	Le chunk contenant les valeurs
+		 *\return		Les valeurs, \p nullptr si le chunk ne peut pas être mappé (chunk en big endian).
+		 */
+		template< typename T >
+		inline T const * doMapChunk( size_t count
+			, BinaryChunk & chunk )const
+		{
+			return ChunkParser< T >::map( count, chunk );
+		}
 		/**
 		 *\~english
 		 *\brief		Retrieves a subchunk.
@@ -77,9 +77,12 @@ namespace castor3d
 				, count * sizeof( T )
 				, chunk ) };
 
-			for ( uint32_t i = 0; i < count; ++i )
+			if ( chunk.isBigEndian() )
 			{
-				prepareChunkData( *values++ );
+				for ( uint32_t i = 0; i < count; ++i )
+				{
+					prepareChunkData( *values++ );
+				}
 			}
 
 			return result;
@@ -102,9 +105,44 @@ namespace castor3d
 			bool result{ ChunkParserBase::parse( getBuffer( value )
 				, uint32_t( getDataSize( value ) )
 				, chunk ) };
-			prepareChunkData( value );
+
+			if ( chunk.isBigEndian() )
+			{
+				prepareChunkData( value );
+			}
+
 			return result;
 		}
+		/**
+		 *\~english
+		 *\brief		Retrieves a value array directly from the chunk memory, without copy.
+		 *\remarks		Only available for little endian chunks (cmsh 2.0 and later).
+		 *\param[in]	count	The values count
+		 *\param[in]	chunk	The chunk containing the values
+		 *\return		The values, \p nullptr if they can't be mapped.
+		 *\~french
+		 *\brief		Récupère un tableau de valeurs directement depuis la mémoire du chunk, sans copie.
+		 *\remarks		Disponible uniquement pour les chunks en little endian (cmsh 2.0 et après).
+		 *\param[in]	count	Le compte des valeurs
+		 *\param[in]	chunk	Le chunk contenant les valeurs
+		 *\return		Les valeurs, \p nullptr si elles ne peuvent pas être mappées.
+		 */
+		static inline T const * map( size_t count
+			, BinaryChunk & chunk )
+		{
+			auto size = uint32_t( count * sizeof( T ) );
+			auto data = chunk.getRemainingData();
+
+			if ( chunk.isBigEndian()
+				|| !chunk.checkAvailable( size )
+				|| ( reinterpret_cast< uintptr_t >( data ) % alignof( T ) ) != 0u )
+			{
+				return nullptr;
+			}
+
+			chunk.skip( size );
+			return reinterpret_cast< T const * >( data );
+		}
 	};
 	/**
 	\author 	Sylvain DOREMUS
@@ -85,15 +85,9 @@ namespace castor3d
 			, ChunkType type
 			, BinaryChunk & chunk )
 		{
-			std::vector< T > values{ begin, end };
-
-			for ( auto & value : values )
-			{
-				prepareChunkData( value );
-			}
-
-			return ChunkWriterBase::write( reinterpret_cast< uint8_t const * >( values.data() )
-				, reinterpret_cast< uint8_t const * >( values.data() + values.size() )
+			// Chunks are written in little endian, hence no conversion is needed.
+			return ChunkWriterBase::write( reinterpret_cast< uint8_t const * >( begin )
+				, reinterpret_cast< uint8_t const * >( end )
 				, type
 				, chunk );
 		}
@@ -115,10 +109,8 @@ namespace castor3d
 			, ChunkType type
 			, BinaryChunk & chunk )
 		{
-			auto cvalue = value;
-			prepareChunkData( cvalue );
-			auto begin = getBuffer( cvalue );
-			auto end = begin + getDataSize( cvalue );
+			auto begin = getBuffer( value );
+			auto end = begin + getDataSize( value );
 			return ChunkWriterBase::write( begin, end, type, chunk );
 		}
 	};
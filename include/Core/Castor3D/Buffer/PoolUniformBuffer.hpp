@@ -24,6 +24,7 @@ namespace castor3d
 		 *\brief		Constructor.
 		 *\param[in]	renderSystem	The RenderSystem.
 		 *\param[in]	data			The mapped data.
+		 *\param[in]	uploaded		Receives the copy of the data last uploaded to the GPU buffer.
 		 *\param[in]	usage			The buffer usage flags.
 		 *\param[in]	flags			The buffer memory flags.
 		 *\param[in]	debugName		The buffer debug name.
@@ -32,6 +33,7 @@ namespace castor3d
 		 *\brief		Constructeur.
 		 *\param[in]	renderSystem	Le RenderSystem.
 		 *\param[in]	data			Les données mappées
+		 *\param[in]	uploaded		Reçoit la copie des données envoyées en dernier au tampon GPU.
 		 *\param[in]	usage			Les indicateurs d'utilisation du tampon.
 		 *\param[in]	flags			Les indicateurs de mémoire du tampon.
 		 *\param[in]	debugName		Le nom debug du tampon.
@@ -39,6 +41,7 @@ namespace castor3d
 		 */
 		C3D_API PoolUniformBuffer( RenderSystem const & renderSystem
 			, castor::ArrayView< uint8_t > data
+			, castor::ArrayView< uint8_t > uploaded
 			, VkBufferUsageFlags usage
 			, VkMemoryPropertyFlags flags
 			, castor::String debugName
@@ -90,6 +93,17 @@ namespace castor3d
 		 *\param[in]	offset	L'offset de la zone mémoire.
 		 */
 		C3D_API void deallocate( VkDeviceSize offset );
+		/**
+		 *\~english
+		 *\brief		Gathers the allocated memory chunks modified since the last call, and updates the uploaded copy.
+		 *\remarks		The chunks allocated since the last call are always gathered.
+		 *\param[out]	ranges	Receives the modified ranges, in bytes, the adjacent ones being merged.
+		 *\~french
+		 *\brief		Récupère les zones mémoire allouées modifiées depuis le dernier appel, et met à jour la copie envoyée.
+		 *\remarks		Les zones allouées depuis le dernier appel sont toujours récupérées.
+		 *\param[out]	ranges	Reçoit les intervalles modifiés, en octets, ceux adjacents étant fusionnés.
+		 */
+		C3D_API void gatherModifiedRanges( std::vector< MemChunk > & ranges );
 		/**
 		*\~english
 		*\return
@@ -246,10 +260,14 @@ namespace castor3d
 		ashes::UniformBufferPtr m_buffer;
 		castor::String m_debugName;
 		castor::ArrayView< uint8_t > m_data;
+		castor::ArrayView< uint8_t > m_uploaded;
+		// The offsets of the chunks to upload whatever their content, because their GPU memory is not initialised.
+		std::set< VkDeviceSize > m_pending;
 	};
 
 	inline PoolUniformBufferUPtr makePoolUniformBuffer( RenderSystem const & renderSystem
 		, castor::ArrayView< uint8_t > data
+		, castor::ArrayView< uint8_t > uploaded
 		, VkBufferUsageFlags usage
 		, VkMemoryPropertyFlags flags
 		, std::string name
@@ -257,6 +275,7 @@ namespace castor3d
 	{
 		return std::make_unique< PoolUniformBuffer >( renderSystem
 			, data
+			, uploaded
 			, usage
 			, flags
 			, std::move( name )
@@ -57,13 +57,16 @@ namespace castor3d
 		C3D_API void cleanup();
 		/**
 		 *\~english
-		 *\brief		Uploads all GPU buffers to VRAM.
-		 *\param[in]	cb	The command buffer on which transfer commands are recorded.
+		 *\brief		Uploads the ranges modified since the last upload to VRAM.
+		 *\param[in]	cb		The command buffer on which transfer commands are recorded.
+		 *\param[out]	info	Receives the uploaded bytes count.
 		 *\~french
-		 *\brief		Met à jour tous les tampons GPU en VRAM.
-		 *\param[in]	cb	Le command buffer sur lequel les commandes de transfert sont enregistrées.
+		 *\brief		Met à jour en VRAM les intervalles modifiés depuis la dernière mise à jour.
+		 *\param[in]	cb		Le command buffer sur lequel les commandes de transfert sont enregistrées.
+		 *\param[out]	info	Reçoit le nombre d'octets envoyés.
 		 */
-		C3D_API void upload( ashes::CommandBuffer const & cb )const;
+		C3D_API void upload( ashes::CommandBuffer const & cb
+			, RenderInfo & info );
 		/**
 		 *\~english
 		 *\brief		Retrieves a uniform buffer.
@@ -108,7 +111,15 @@ namespace castor3d
 		uint32_t m_maxPoolUboCount{ 100u };
 		uint32_t m_currentUboIndex{ 0u };
 		ashes::StagingBufferPtr m_stagingBuffer;
-		uint8_t * m_stagingData;
+		//!\~english	The persistently mapped staging buffer memory, receiving the modified ranges at each upload.
+		//!\~french		La mémoire du staging buffer, mappée en permanence, recevant les intervalles modifiés à chaque mise à jour.
+		uint8_t * m_mappedData{ nullptr };
+		//!\~english	The memory the uniform buffers write to.
+		//!\~french		La mémoire dans laquelle écrivent les tampons d'uniformes.
+		castor::ByteArray m_hostData;
+		//!\~english	The copy of the data last uploaded to the GPU buffers.
+		//!\~french		La copie des données envoyées en dernier aux tampons GPU.
+		castor::ByteArray m_uploadedData;
 		std::map< uint32_t, BufferArray > m_buffers;
 		castor::String m_debugName;
 	};
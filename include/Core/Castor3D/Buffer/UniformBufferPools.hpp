@@ -33,13 +33,16 @@ namespace castor3d
 		C3D_API ~UniformBufferPools();
 		/**
 		 *\~english
-		 *\brief		Uploads all GPU buffers to VRAM.
-		 *\param[in]	cb	The command buffer on which transfer commands are recorded.
+		 *\brief		Uploads the ranges modified since the last upload to VRAM.
+		 *\param[in]	cb		The command buffer on which transfer commands are recorded.
+		 *\param[out]	info	Receives the uploaded bytes count.
 		 *\~french
-		 *\brief		Met à jour tous les tampons GPU en VRAM.
-		 *\param[in]	cb	Le command buffer sur lequel les commandes de transfert sont enregistrées.
+		 *\brief		Met à jour en VRAM les intervalles modifiés depuis la dernière mise à jour.
+		 *\param[in]	cb		Le command buffer sur lequel les commandes de transfert sont enregistrées.
+		 *\param[out]	info	Reçoit le nombre d'octets envoyés.
 		 */
-		C3D_API void upload( ashes::CommandBuffer const & cb )const;
+		C3D_API void upload( ashes::CommandBuffer const & cb
+			, RenderInfo & info );
 		/**
 		 *\~english
 		 *\brief		Retrieves a uniform buffer.
@@ -499,6 +499,13 @@ namespace castor3d
 	using OnCacheChangedFunction = std::function< void() >;
 	using OnCacheChanged = castor::Signal < OnCacheChangedFunction >;
 
+	template< typename ElementType >
+	using OnCacheElementFunctionT = std::function< void( ElementType & ) >;
+	template< typename ElementType >
+	using OnCacheElementT = castor::Signal < OnCacheElementFunctionT< ElementType > >;
+	template< typename ElementType >
+	using OnCacheElementConnectionT = typename OnCacheElementT< ElementType >::connection;
+
 
 	class AnimatedObjectGroupCache;
 	class BillboardListCache;
@@ -10,7 +10,9 @@ See LICENSE file in root folder
 #include "Castor3D/Buffer/UniformBufferOffset.hpp"
 #include "Castor3D/Shader/Ubos/UbosModule.hpp"
 
+#include <mutex>
 #include <set>
+#include <unordered_set>
 
 namespace castor3d
 {
@@ -108,13 +110,35 @@ namespace castor3d
 		C3D_API void fillInfo( RenderInfo & info )const;
 		/**
 		 *\~english
-		 *\brief			Updates the render pass, CPU wise.
+		 *\brief			Updates the models UBOs, CPU wise.
+		 *\remarks			Only the entries of the nodes marked dirty since the last update are recomputed,
+		 *					unless the scene has changed, spread across the CPU jobs.
 		 *\param[in, out]	updater	The update data.
 		 *\~french
-		 *\brief			Met à jour la passe de rendu, au niveau CPU.
+		 *\brief			Met à jour les UBOs de modèle, au niveau CPU.
+		 *\remarks			Seules les entrées des noeuds marqués modifiés depuis la dernière mise à jour sont recalculées,
+		 *					sauf si la scène a changé, réparties sur les jobs CPU.
 		 *\param[in, out]	updater	Les données d'update.
 		 */
 		C3D_API void update( CpuUpdater & updater );
+		/**
+		 *\~english
+		 *\brief		Marks a node's geometries for the next update.
+		 *\param[in]	node	The node.
+		 *\~french
+		 *\brief		Marque les géométries d'un noeud pour la prochaine mise à jour.
+		 *\param[in]	node	Le noeud.
+		 */
+		C3D_API void markNodeDirty( SceneNode const & node );
+		/**
+		 *\~english
+		 *\brief		Forgets a removed node.
+		 *\param[in]	node	The node.
+		 *\~french
+		 *\brief		Oublie un noeud supprimé.
+		 *\param[in]	node	Le noeud.
+		 */
+		C3D_API void removeNode( SceneNode const & node );
 		/**
 		 *\~english
 		 *\return		The UBOs for given geometry, submesh and pass.
@@ -187,6 +211,7 @@ namespace castor3d
 			, Geometry const & geometry
 			, Submesh const & submesh
 			, Pass const & pass );
+		void doUpdateEntry( PoolsEntry & entry );
 		void doRegister( Geometry & geometry );
 		void doUnregister( Geometry & geometry );
 
@@ -198,6 +223,12 @@ namespace castor3d
 		std::map< Geometry *, OnSubmeshMaterialChangedConnection > m_connections;
 		using RenderPassSet = std::set< SceneRenderPass const * >;
 		std::map< uint32_t, RenderPassSet > m_instances;
+		// The nodes moved and the entries created since the last update.
+		std::mutex m_dirtyMutex;
+		std::unordered_set< SceneNode const * > m_dirtyNodes;
+		std::unordered_set< PoolsEntry * > m_newEntries;
+		// The entries updated by the last update, their previous matrix needs to catch up with the current one.
+		std::unordered_set< PoolsEntry * > m_movedEntries;
 	};
 }
 
@@ -34,6 +34,7 @@ namespace castor3d
 	public:
 		using OnChangedFunction = std::function< void() >;
 		using OnChanged = castor::Signal < OnChangedFunction >;
+		using OnElement = OnCacheElementT< Element >;
 
 	public:
 		/**
@@ -165,6 +166,7 @@ namespace castor3d
 				else
 				{
 					m_elements.insert( name, element );
+					onElementAdded( *element );
 					onChanged();
 				}
 			}
@@ -204,6 +206,7 @@ namespace castor3d
 				m_elements.insert( name, result );
 				m_attach( result, parent, m_rootNode.lock(), m_rootCameraNode.lock(), m_rootObjectNode.lock() );
 				doReportCreation( name );
+				onElementAdded( *result );
 				onChanged();
 			}
 			else
@@ -231,6 +234,7 @@ namespace castor3d
 				auto element = m_elements.find( name );
 				m_detach( element );
 				m_elements.erase( name );
+				onElementRemoved( *element );
 				onChanged();
 			}
 		}
@@ -254,10 +258,13 @@ namespace castor3d
 					, it.second
 					, destination.m_rootCameraNode.lock()
 					, destination.m_rootObjectNode.lock() );
+				onElementRemoved( *it.second );
+				destination.onElementAdded( *it.second );
 			}
 
 			clear();
 			onChanged();
+			destination.onChanged();
 		}
 		/**
 		 *\~english
@@ -457,6 +464,12 @@ namespace castor3d
 		//!\~english	The signal emitted when the content has changed.
 		//!\~french		Le signal émis lorsque le contenu a changé.
 		OnChanged onChanged;
+		//!\~english	The signal emitted when an element has been added.
+		//!\~french		Le signal émis lorsqu'un élément a été ajouté.
+		OnElement onElementAdded;
+		//!\~english	The signal emitted when an element has been removed.
+		//!\~french		Le signal émis lorsqu'un élément a été retiré.
+		OnElement onElementRemoved;
 
 	protected:
 		//!\~english	The engine.
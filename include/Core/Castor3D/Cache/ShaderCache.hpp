@@ -6,6 +6,11 @@ See LICENSE file in root folder
 
 #include "CacheModule.hpp"
 #include "Castor3D/Shader/ShaderModule.hpp"
+#include "Castor3D/Shader/SpirVCache.hpp"
+
+#include <CastorUtils/Multithreading/AsyncJobQueue.hpp>
+
+#include <unordered_map>
 
 namespace castor3d
 {
@@ -56,17 +61,84 @@ namespace castor3d
 		 *\~english
 		 *\brief		Looks for an automatically generated program corresponding to given flags.
 		 *\remarks		If none exists it is created.
+		 *\n			Thread-safe: distinct flags are generated concurrently, only the callers asking for the same flags wait for each other.
 		 *\param[in]	renderPass	The pass from which the program code is retrieved.
 		 *\param[in]	flags		The pipeline flags.
 		 *\return		The found or created program.
 		 *\~french
 		 *\brief		Cherche un programme automatiquement généré correspondant aux flags donnés.
+		 *\remarks		S'il n'existe pas, il est créé.
+		 *\n			Thread-safe : des flags différents sont générés en parallèle, seuls les appelants demandant les mêmes flags s'attendent.
 		 *\param[in]	renderPass	La passe a partir de laquelle est récupéré le code du programme.
 		 *\param[in]	flags		Les flags de pipeline.
 		 *\return		Le programme trouvé ou créé.
 		 */
 		C3D_API ShaderProgramSPtr getAutomaticProgram( SceneRenderPass const & renderPass
 			, PipelineFlags const & flags );
+		/**
+		 *\~english
+		 *\brief		Sets the folder of the on disk SPIR-V cache, used by automatic programs.
+		 *\remarks		Programs found in the cache are not generated, those that aren't are added to it.
+		 *\n			The cache is disabled until a folder is set.
+		 *\param[in]	folder	The cache folder, an empty path disables the cache.
+		 *\~french
+		 *\brief		Définit le dossier du cache SPIR-V sur disque, utilisé par les programmes automatiques.
+		 *\remarks		Les programmes trouvés dans le cache ne sont pas générés, ceux qui n'y sont pas y sont ajoutés.
+		 *\n			Le cache est désactivé tant qu'aucun dossier n'est défini.
+		 *\param[in]	folder	Le dossier du cache, un chemin vide désactive le cache.
+		 */
+		C3D_API void setDiskCacheFolder( castor::Path folder );
+		/**
+		 *\~english
+		 *\return		The on disk SPIR-V cache.
+		 *\~french
+		 *\return		Le cache SPIR-V sur disque.
+		 */
+		SpirVCache const & getDiskCache()const
+		{
+			return m_diskCache;
+		}
+		/**
+		 *\~english
+		 *\brief		Sets the file of the pipeline variants manifest, and loads it.
+		 *\remarks		When enabled, the pipeline flags of each automatic program are recorded into the manifest.
+		 *\param[in]	file	The manifest file, an empty path disables the manifest.
+		 *\~french
+		 *\brief		Définit le fichier du manifeste des variantes de pipeline, et le charge.
+		 *\remarks		Lorsqu'il est activé, les indicateurs de pipeline de chaque programme automatique sont enregistrés dans le manifeste.
+		 *\param[in]	file	Le fichier manifeste, un chemin vide désactive le manifeste.
+		 */
+		C3D_API void setPipelineManifestFile( castor::Path file );
+		/**
+		 *\~english
+		 *\brief		Writes the pipeline variants manifest, if enabled.
+		 *\~french
+		 *\brief		Ecrit le manifeste des variantes de pipeline, s'il est activé.
+		 */
+		C3D_API void savePipelineManifest();
+		/**
+		 *\~english
+		 *\brief		Generates in background the automatic programs recorded in the manifest for given render pass.
+		 *\remarks		The returned jobs must be waited for, or cancelled, before the render pass is destroyed.
+		 *\param[in]	renderPass	The render pass.
+		 *\return		The background jobs.
+		 *\~french
+		 *\brief		Génère en arrière plan les programmes automatiques enregistrés dans le manifeste pour la passe de rendu donnée.
+		 *\remarks		Les tâches retournées doivent être attendues, ou annulées, avant la destruction de la passe de rendu.
+		 *\param[in]	renderPass	La passe de rendu.
+		 *\return		Les tâches d'arrière plan.
+		 */
+		C3D_API std::vector< castor::AsyncJobQueue::Handle > prewarmAutomaticPrograms( SceneRenderPass const & renderPass );
+		/**
+		 *\~english
+		 *\return		The pipeline variants manifest, \p nullptr if disabled.
+		 *\~french
+		 *\return		Le manifeste des variantes de pipeline, \p nullptr s'il est désactivé.
+		 */
+		PipelineManifest const * getPipelineManifest()const
+		{
+			return m_manifest.get();
+		}
 		/**
 		 *\~english
 		 *\brief		Locks the collection mutex
@@ -136,25 +208,40 @@ namespace castor3d
 			return m_programs.end();
 		}
 
-	private:
-		ShaderProgramSPtr doFindAutomaticProgram( PipelineFlags const & flags );
-		ShaderProgramSPtr doCreateAutomaticProgram( SceneRenderPass const & renderPass
-			, PipelineFlags const & flags )const;
-		void doAddAutomaticProgram( ShaderProgramSPtr program
-			, PipelineFlags const & flags );
-		void doAddProgram( ShaderProgramSPtr program );
-
 	private:
 		struct AutoGeneratedProgram
 		{
-			PipelineFlags flags;
+			std::mutex mutex;
 			ShaderProgramSPtr program;
 		};
-		using ShaderProgramCont = std::vector< AutoGeneratedProgram >;
+		using AutoGeneratedProgramPtr = std::shared_ptr< AutoGeneratedProgram >;
+		using ShaderProgramCont = std::unordered_map< PipelineFlags, AutoGeneratedProgramPtr, PipelineFlagsHasher >;
+
+	private:
+		AutoGeneratedProgramPtr doFindAutomaticProgram( PipelineFlags const & flags
+			, SpirVCache & diskCache
+			, std::shared_ptr< PipelineManifest > & manifest );
+		ShaderProgramSPtr doGetAutomaticProgram( SceneRenderPass const & renderPass
+			, PipelineFlags const & flags
+			, AutoGeneratedProgram & entry
+			, SpirVCache const & diskCache
+			, bool & created );
+		ShaderProgramSPtr doLoadAutomaticProgram( SceneRenderPass const & renderPass
+			, SpirVCache const & diskCache
+			, uint64_t key )const;
+		ShaderProgramSPtr doCreateAutomaticProgram( SceneRenderPass const & renderPass
+			, PipelineFlags const & flags )const;
+		void doSaveAutomaticProgram( ShaderProgram const & program
+			, SpirVCache const & diskCache
+			, uint64_t key )const;
+		void doAddProgram( ShaderProgramSPtr program );
 
+	private:
 		mutable std::mutex m_mutex;
 		ShaderProgramPtrArray m_programs;
 		ShaderProgramCont m_autogenerated;
+		SpirVCache m_diskCache;
+		std::shared_ptr< PipelineManifest > m_manifest;
 	};
 	/**
 	 *\~english
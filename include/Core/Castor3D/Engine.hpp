@@ -33,6 +33,7 @@ See LICENSE file in root folder
 #include <CastorUtils/Log/LoggerInstance.hpp>
 #include <CastorUtils/Miscellaneous/CpuInformations.hpp>
 #include <CastorUtils/Multithreading/AsyncJobQueue.hpp>
+#include <CastorUtils/Multithreading/JobScheduler.hpp>
 
 #include <ashespp/Core/RendererList.hpp>
 
@@ -256,17 +257,31 @@ namespace castor3d
 		/**
 		 *\~english
 		 *\brief		Enqueues the given job.
+		 *\param[in]	job			The job.
+		 *\param[in]	priority	The job priority.
+		 *\return		The job's handle, allowing cancellation and continuations.
 		 *\~french
 		 *\brief		Met dans la file la tâche donnée.
+		 *\param[in]	job			La tâche.
+		 *\param[in]	priority	La priorité de la tâche.
+		 *\return		Le handle de la tâche, permettant l'annulation et les continuations.
 		 */
-		C3D_API void pushJob( castor::AsyncJobQueue::Job job );
+		C3D_API castor::AsyncJobQueue::Handle pushJob( castor::AsyncJobQueue::Job job
+			, castor::JobPriority priority = castor::JobPriority::eBackground );
 		/**
 		 *\~english
 		 *\brief		Enqueues the given GPU job.
+		 *\param[in]	job			The job.
+		 *\param[in]	priority	The job priority.
+		 *\return		The job's handle, allowing cancellation and continuations.
 		 *\~french
 		 *\brief		Met dans la file la tâche GPU donnée.
+		 *\param[in]	job			La tâche.
+		 *\param[in]	priority	La priorité de la tâche.
+		 *\return		Le handle de la tâche, permettant l'annulation et les continuations.
 		 */
-		C3D_API void pushGpuJob( std::function< void( RenderDevice const & ) > job );
+		C3D_API castor::AsyncJobQueue::Handle pushGpuJob( std::function< void( RenderDevice const & ) > job
+			, castor::JobPriority priority = castor::JobPriority::eBackground );
 		/**
 		 *\~english
 		 *\brief		Retrieves a colour issued from a rainbow colours iterator.
@@ -523,6 +538,11 @@ namespace castor3d
 			return m_cpuInformations;
 		}
 
+		castor::JobScheduler & getCpuJobs()
+		{
+			return m_cpuJobs;
+		}
+
 		PassTypeID getPassesType()const
 		{
 			return m_passesType;
@@ -558,6 +578,11 @@ namespace castor3d
 			return m_lpvGridSize;
 		}
 
+		uint32_t getMaxFramesInFlight()const
+		{
+			return m_maxFramesInFlight;
+		}
+
 		std::map< castor::String, RenderWindow * > const & getRenderWindows()const
 		{
 			return m_renderWindows;
@@ -596,6 +621,24 @@ namespace castor3d
 		{
 			m_lpvGridSize = size;
 		}
+		/**
+		 *\~english
+		 *\brief		Sets the number of frames the render loop can have in flight.
+		 *\remarks		Can be called at any time, the render loop applies the change at the start of its next frame.
+		 *				1 renders synchronously, 2 lets the CPU update of a frame run while the GPU renders the previous one.
+		 *				Greater values are clamped to 2, since the GPU update still writes some buffers in place.
+		 *\param[in]	count	The frames count.
+		 *\~french
+		 *\brief		Définit le nombre de frames que la boucle de rendu peut avoir en vol.
+		 *\remarks		Peut être appelée à tout moment, la boucle de rendu applique le changement au début de sa frame suivante.
+		 *				1 rend de manière synchrone, 2 permet à la mise à jour CPU d'une frame de s'exécuter pendant que le GPU rend la précédente.
+		 *				Les valeurs supérieures sont ramenées à 2, car la mise à jour GPU écrit encore certains tampons sur place.
+		 *\param[in]	count	Le nombre de frames.
+		 */
+		void setMaxFramesInFlight( uint32_t count )
+		{
+			m_maxFramesInFlight = std::max( 1u, std::min( 2u, count ) );
+		}
 		/**@}*/
 
 	private:
@@ -643,7 +686,9 @@ namespace castor3d
 		bool m_enableValidation{ false };
 		bool m_enableApiTrace{ false };
 		uint32_t m_lpvGridSize{ 32u };
+		std::atomic< uint32_t > m_maxFramesInFlight{ 1u };
 		castor::AsyncJobQueue m_jobs;
+		castor::JobScheduler m_cpuJobs;
 		crg::ResourceHandler m_resourceHandler;
 		shader::LightingModelFactory m_lightingModelFactory;
 	};
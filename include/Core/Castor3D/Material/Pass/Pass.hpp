@@ -19,6 +19,7 @@ See LICENSE file in root folder
 #include <CastorUtils/Math/RangedValue.hpp>
 
 #include <atomic>
+#include <mutex>
 
 namespace castor3d
 {
@@ -634,6 +635,7 @@ namespace castor3d
 		bool m_implicit{ false };
 		bool m_automaticShader{ true };
 		std::atomic_bool m_texturesReduced{ false };
+		std::mutex m_texturesMutex;
 		castor::GroupChangeTracked< float > m_opacity;
 		castor::GroupChangeTracked< castor::RangedValue< uint32_t > > m_bwAccumulationOperator;
 		castor::GroupChangeTracked< float > m_emissive;
@@ -21,6 +21,7 @@ See LICENSE file in root folder
 
 #include <ashespp/Buffer/VertexBuffer.hpp>
 
+#include <mutex>
 #include <unordered_map>
 
 namespace castor3d
@@ -400,6 +401,7 @@ namespace castor3d
 		ashes::BufferPtr< uint32_t > m_indexBuffer;
 		mutable std::unordered_map< size_t, ashes::PipelineVertexInputStateCreateInfo > m_vertexLayouts;
 		mutable std::unordered_map< size_t, GeometryBuffers > m_geometryBuffers;
+		mutable std::mutex m_geometryBuffersMutex;
 		bool m_needsNormalsCompute{ false };
 		bool m_disableSceneUpdate{ false };
 
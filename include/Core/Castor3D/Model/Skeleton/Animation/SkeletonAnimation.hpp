@@ -152,6 +152,20 @@ namespace castor3d
 		{
 			return m_toMove;
 		}
+		/**
+		 *\~english
+		 *\brief		Removes the keyframes that can be rebuilt, within given tolerances, by interpolating the kept ones.
+		 *\param[in]	tolerance		The maximum translation and scale error.
+		 *\param[in]	angleTolerance	The maximum rotation error.
+		 *\return		The removed keyframes count.
+		 *\~french
+		 *\brief		Supprime les keyframes pouvant être reconstruites, dans les tolérances données, en interpolant celles gardées.
+		 *\param[in]	tolerance		L'erreur maximale de translation et d'échelle.
+		 *\param[in]	angleTolerance	L'erreur maximale de rotation.
+		 *\return		Le nombre de keyframes supprimées.
+		 */
+		C3D_API uint32_t reduceKeyFrames( float tolerance
+			, castor::Angle const & angleTolerance );
 		/**
 		 *\~english
 		 *\return		The root moving objects.
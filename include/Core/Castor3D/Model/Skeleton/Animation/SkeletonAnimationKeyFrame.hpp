@@ -86,6 +86,16 @@ namespace castor3d
 		 *\brief		Initialise la keyframe.
 		 */
 		C3D_API void initialise()override;
+		/**
+		 *\~english
+		 *\return		The local transformations, per animation object, parents first.
+		 *\~french
+		 *\return		Les transformations locales, par objet d'animation, parents en premier.
+		 */
+		inline ObjectTrsArray const & getLocalTransforms()const
+		{
+			return m_locals;
+		}
 		/**
 		 *\~english
 		 *\return		The beginning of the cumulative transforms map.
@@ -133,10 +143,17 @@ namespace castor3d
 			m_timeIndex = time;
 		}
 
+		void doAddAnimationObject( SkeletonAnimationObject & object
+			, castor::Matrix4x4f const & transform
+			, ObjectTrs const & local );
+
 	private:
 		//!\~english	The transformations, per animation object.
 		//!\~french		Les transformations, par objet d'animation.
 		TransformArray m_transforms;
+		//!\~english	The transformations, per animation object, as translation, rotation and scale.
+		//!\~french		Les transformations, par objet d'animation, en translation, rotation et échelle.
+		ObjectTrsArray m_locals;
 		//!\~english	The cumulative transformations, per animation object.
 		//!\~french		Les transformations cumulatives, par objet d'animation.
 		TransformArray m_cumulative;
@@ -144,6 +161,38 @@ namespace castor3d
 		friend class BinaryParser< SkeletonAnimationKeyFrame >;
 		friend class BinaryWriter< SkeletonAnimationKeyFrame >;
 	};
+	/**
+	 *\~english
+	 *\brief		Computes a keyframe transformation matrix from translation, rotation and scale.
+	 *\~french
+	 *\brief		Calcule une matrice de transformation de keyframe à partir de la translation, la rotation et l'échelle.
+	 */
+	C3D_API castor::Matrix4x4f composeTransform( castor::Point3f const & translate
+		, castor::Quaternion const & rotate
+		, castor::Point3f const & scale );
+	/**
+	 *\~english
+	 *\brief		Extracts translation, rotation and scale from a keyframe transformation matrix, without shear.
+	 *\~french
+	 *\brief		Extrait la translation, la rotation et l'échelle d'une matrice de transformation de keyframe, sans cisaillement.
+	 */
+	C3D_API void decomposeTransform( castor::Matrix4x4f const & transform
+		, castor::Point3f & translate
+		, castor::Quaternion & rotate
+		, castor::Point3f & scale );
+	/**
+	 *\~english
+	 *\brief		Interpolates two local transformations of the same object.
+	 *\param[in]	lhs, rhs	The transformations.
+	 *\param[in]	factor		The interpolation factor, 0 giving \p lhs, 1 giving \p rhs.
+	 *\~french
+	 *\brief		Interpole deux transformations locales d'un même objet.
+	 *\param[in]	lhs, rhs	Les transformations.
+	 *\param[in]	factor		Le facteur d'interpolation, 0 donnant \p lhs, 1 donnant \p rhs.
+	 */
+	C3D_API ObjectTrs interpolateTransform( ObjectTrs const & lhs
+		, ObjectTrs const & rhs
+		, float factor );
 }
 
 #endif
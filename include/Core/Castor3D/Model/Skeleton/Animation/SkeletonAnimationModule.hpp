@@ -6,6 +6,7 @@ See LICENSE file in root folder
 
 #include "Castor3D/Model/Skeleton/SkeletonModule.hpp"
 
+#include <CastorUtils/Math/Quaternion.hpp>
 #include <CastorUtils/Math/SquareMatrix.hpp>
 
 namespace castor3d
@@ -93,6 +94,20 @@ namespace castor3d
 
 	using ObjectTransform = std::pair< SkeletonAnimationObject *, castor::Matrix4x4f >;
 	using TransformArray = std::vector< ObjectTransform >;
+	/**
+	\~english
+	\brief		The local translation, rotation and scale of a skeleton animation object, in a keyframe.
+	\~french
+	\brief		La translation, la rotation et l'échelle locales d'un objet d'animation de squelette, dans une keyframe.
+	*/
+	struct ObjectTrs
+	{
+		SkeletonAnimationObject * object;
+		castor::Point3f translate;
+		castor::Quaternion rotate;
+		castor::Point3f scale;
+	};
+	using ObjectTrsArray = std::vector< ObjectTrs >;
 
 	CU_DeclareSmartPtr( SkeletonAnimation );
 	CU_DeclareSmartPtr( SkeletonAnimationKeyFrame );
@@ -134,6 +134,21 @@ namespace castor3d
 		 */
 		void unregisterTimer( castor::String const & category
 			, crg::FramePassTimer & timer );
+		/**
+		 *\~english
+		 *\brief		Adds a CPU only duration to a pass, it is reported with the next frame times.
+		 *\param[in]	category	The pass category.
+		 *\param[in]	name		The pass name.
+		 *\param[in]	time		The duration.
+		 *\~french
+		 *\brief		Ajoute une durée CPU seule à une passe, elle est rapportée avec les temps de la prochaine image.
+		 *\param[in]	category	La catégorie de la passe.
+		 *\param[in]	name		Le nom de la passe.
+		 *\param[in]	time		La durée.
+		 */
+		void addCpuTime( castor::String const & category
+			, castor::String const & name
+			, castor::Nanoseconds time );
 		/**
 		 *\~english
 		 *\return		The debug overlays shown status.
@@ -259,6 +274,11 @@ namespace castor3d
 			bool removeTimer( RenderPassTimer & timer );
 			bool removeTimer( crg::FramePassTimer & timer );
 
+			inline void addCpuTime( castor::Nanoseconds time )
+			{
+				m_cpuOnlyTime += time;
+			}
+
 			inline castor::Nanoseconds getGpuTime()
 			{
 				return m_gpu.time;
@@ -281,6 +301,7 @@ namespace castor3d
 			uint32_t m_index;
 			std::vector< RenderPassTimer * > m_timers;
 			std::map< crg::FramePassTimer *, crg::OnFramePassDestroyConnection > m_crgtimers;
+			castor::Nanoseconds m_cpuOnlyTime{ 0_ns };
 			PanelOverlaySPtr m_panel;
 			TextOverlaySPtr m_passName;
 			TimeOverlays m_cpu;
@@ -313,6 +334,8 @@ namespace castor3d
 			void addTimer( crg::FramePassTimer & timer );
 			bool removeTimer( RenderPassTimer & timer );
 			bool removeTimer( crg::FramePassTimer & timer );
+			bool addCpuTime( castor::String const & name
+				, castor::Nanoseconds time );
 			void retrieveGpuTime();
 			void update();
 			void setVisible( bool visible );
@@ -62,6 +62,15 @@ namespace castor3d
 	/**
 	*\~english
 	*\brief
+	*	Culls nodes against a frustum, then against a software depth buffer filled with the occluders.
+	*\~french
+	*\brief
+	*	Elimine les noeuds par rapport à un frustum, puis par rapport à un tampon de profondeur logiciel rempli avec les occultants.
+	*/
+	class OcclusionCuller;
+	/**
+	*\~english
+	*\brief
 	*	Base class to cull nodes, before adding them to the render queue.
 	*\~french
 	*\brief
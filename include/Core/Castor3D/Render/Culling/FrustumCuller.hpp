@@ -16,9 +16,12 @@ namespace castor3d
 			, Camera & camera );
 		C3D_API explicit FrustumCuller( Camera & camera );
 
-	private:
+	protected:
 		void doCullGeometries()override;
 		void doCullBillboards()override;
+
+	private:
+		std::vector< uint8_t > m_inFrustum;
 	};
 }
 
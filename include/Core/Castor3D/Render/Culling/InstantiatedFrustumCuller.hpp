@@ -27,6 +27,8 @@ namespace castor3d
 
 	private:
 		std::vector< Frustum > m_frustums;
+		// For each frustum, the submeshes bounds visibility.
+		std::vector< std::vector< uint8_t > > m_inFrustums;
 	};
 }
 
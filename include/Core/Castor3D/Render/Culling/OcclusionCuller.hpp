@@ -0,0 +1,54 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_OcclusionCuller_H___
+#define ___C3D_OcclusionCuller_H___
+
+#include "Castor3D/Render/Culling/FrustumCuller.hpp"
+
+#include <CastorUtils/Graphics/OcclusionBuffer.hpp>
+
+namespace castor3d
+{
+	class OcclusionCuller
+		: public FrustumCuller
+	{
+	public:
+		C3D_API OcclusionCuller( Scene & scene
+			, Camera & camera );
+		C3D_API explicit OcclusionCuller( Camera & camera );
+		/**
+		 *\copydoc	castor3d::SceneCuller::fillInfo
+		 */
+		C3D_API void fillInfo( RenderInfo & info )const override;
+
+	private:
+		// The positions and triangles of an occluder submesh, in object space.
+		struct OccluderProxy
+		{
+			std::vector< castor::Point3f > positions;
+			std::vector< uint32_t > indices;
+		};
+
+		struct Stats
+		{
+			uint32_t tested{};
+			uint32_t occluded{};
+			uint32_t triangles{};
+		};
+
+		void doCullGeometries()override;
+		OccluderProxy const & doGetProxy( Submesh const & submesh );
+		void doRasteriseOccluders( castor::Matrix4x4f const & viewProj );
+		void doCullOccluded( castor::Matrix4x4f const & viewProj );
+
+	private:
+		castor::OcclusionBuffer m_buffer;
+		std::unordered_map< Submesh const *, OccluderProxy > m_proxies;
+		std::vector< uint8_t > m_rasterised;
+		std::vector< uint8_t > m_occlusion;
+		Stats m_stats;
+	};
+}
+
+#endif
@@ -6,7 +6,18 @@ See LICENSE file in root folder
 
 #include "CullingModule.hpp"
 
+#include "Castor3D/Cache/CacheModule.hpp"
 #include "Castor3D/Model/Mesh/Submesh/SubmeshModule.hpp"
+#include "Castor3D/Scene/SceneModule.hpp"
+#include "Castor3D/Scene/ParticleSystem/ParticleModule.hpp"
+
+#include <CastorUtils/Design/DynamicBitset.hpp>
+#include <CastorUtils/Graphics/BoundingBoxArray.hpp>
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace castor3d
 {
@@ -16,13 +27,25 @@ namespace castor3d
 		Submesh & data;
 		PassSPtr pass;
 		SceneNode & sceneNode;
+		// Index of the submesh world space bounds in the culler's bounds array.
+		uint32_t boundsIndex;
+		// Index of the node in the culler's visibility bitsets, stable until the node is removed.
+		uint32_t id{};
 	};
 	size_t hash( CulledSubmesh const & culled );
 	size_t hash( CulledSubmesh const & culled
 		, uint32_t instanceMult );
-	bool isVisible( Camera const & camera
-		, CulledSubmesh const & node );
-	bool isVisible( Frustum const & frustum
+	/**
+	 *\~english
+	 *\brief		Tells if a culled submesh is visible.
+	 *\param[in]	inFrustum	The result of the bounds culling, indexed by CulledSubmesh::boundsIndex.
+	 *\param[in]	node		The culled submesh.
+	 *\~french
+	 *\brief		Dit si un sous-maillage culled est visible.
+	 *\param[in]	inFrustum	Le résultat du culling des volumes englobants, indexé par CulledSubmesh::boundsIndex.
+	 *\param[in]	node		Le sous-maillage culled.
+	 */
+	bool isVisible( std::vector< uint8_t > const & inFrustum
 		, CulledSubmesh const & node );
 
 	struct CulledBillboard
@@ -31,23 +54,45 @@ namespace castor3d
 		BillboardBase & data;
 		PassSPtr pass;
 		SceneNode & sceneNode;
+		// Index of the node in the culler's visibility bitsets, stable until the node is removed.
+		uint32_t id{};
 	};
 	size_t hash( CulledBillboard const & culled );
 	size_t hash( CulledBillboard const & culled
 		, uint32_t instanceMult );
-	bool isVisible( Camera const & camera
-		, CulledBillboard const & node );
-	bool isVisible( Frustum const & frustum
+	/**
+	 *\~english
+	 *\brief		Tells if a culled billboard is visible.
+	 *\remarks		The billboards are not bounds culled, \p inFrustum is only there for the signature to match the submeshes one.
+	 *\param[in]	inFrustum	The result of the bounds culling.
+	 *\param[in]	node		The culled billboard.
+	 *\~french
+	 *\brief		Dit si un billboard culled est visible.
+	 *\remarks		Les billboards ne passent pas par le culling des volumes englobants, \p inFrustum n'est là que pour que la signature corresponde à celle des sous-maillages.
+	 *\param[in]	inFrustum	Le résultat du culling des volumes englobants.
+	 *\param[in]	node		Le billboard culled.
+	 */
+	bool isVisible( std::vector< uint8_t > const & inFrustum
 		, CulledBillboard const & node );
 
 	class SceneCuller
 	{
 	public:
-		template< typename CulledT, typename ArrayT >
+		template< typename CulledT, typename ArrayT, template< typename ... > typename ContainerT >
 		struct CulledInstancesArrayT
 		{
-			std::vector< CulledT > objects;
-			std::vector< ArrayT > instances;
+			using ObjectIterator = typename ContainerT< CulledT >::iterator;
+			using InstanceIterator = typename ContainerT< ArrayT >::iterator;
+
+			// Position of an object and its instances in the arrays.
+			struct Entry
+			{
+				ObjectIterator object;
+				InstanceIterator instance;
+			};
+
+			ContainerT< CulledT > objects;
+			ContainerT< ArrayT > instances;
 			uint32_t count;
 
 			void clear()noexcept
@@ -56,14 +101,22 @@ namespace castor3d
 				instances.clear();
 			}
 
-			void push_back( CulledT object
+			Entry push_back( CulledT object
 				, ArrayT instance )
 			{
 				objects.push_back( std::move( object ) );
 				instances.push_back( std::move( instance ) );
+				return Entry{ std::prev( objects.end() )
+					, std::prev( instances.end() ) };
+			}
+
+			void erase( Entry const & entry )
+			{
+				objects.erase( entry.object );
+				instances.erase( entry.instance );
 			}
 
-			void copy( CulledInstancesArrayT< CulledT *, ArrayT * > & dst )
+			void copy( CulledInstancesArrayT< CulledT *, ArrayT *, std::vector > & dst )
 			{
 				for ( auto & node : objects )
 				{
@@ -76,16 +129,110 @@ namespace castor3d
 				}
 			}
 		};
+		/**
+		 *\~english
+		 *\brief		The objects added to and removed from the culler's lists during one or more computes.
+		 *\remarks		The objects addresses are their IDs, a removed object's address may be reused by an added one,
+		 *				so the removals must be processed before the additions.
+		 *\~french
+		 *\brief		Les objets ajoutés aux et retirés des listes du culler pendant un ou plusieurs calculs.
+		 *\remarks		Les adresses des objets sont leurs IDs, l'adresse d'un objet retiré peut être réutilisée par un objet ajouté,
+		 *				donc les retraits doivent être traités avant les ajouts.
+		 */
+		template< typename CulledT >
+		struct CulledDeltaT
+		{
+			std::unordered_set< CulledT const * > added;
+			std::unordered_set< CulledT const * > removed;
+
+			void clear()noexcept
+			{
+				added.clear();
+				removed.clear();
+			}
+
+			bool empty()const noexcept
+			{
+				return added.empty()
+					&& removed.empty();
+			}
 
+			void add( CulledT const * object )
+			{
+				added.insert( object );
+			}
+
+			void remove( CulledT const * object )
+			{
+				// An object added and removed before anyone saw it is just forgotten.
+				if ( !added.erase( object ) )
+				{
+					removed.insert( object );
+				}
+			}
+
+			void merge( CulledDeltaT const & next )
+			{
+				for ( auto object : next.removed )
+				{
+					remove( object );
+				}
+
+				for ( auto object : next.added )
+				{
+					add( object );
+				}
+			}
+		};
+
+		/**
+		 *\~english
+		 *\brief		Allocates the objects IDs, reusing the released ones to keep the visibility bitsets small.
+		 *\~french
+		 *\brief		Alloue les IDs des objets, en réutilisant ceux libérés pour garder les ensembles de bits de visibilité petits.
+		 */
+		struct NodeIds
+		{
+			std::vector< uint32_t > released;
+			uint32_t count{};
+
+			void clear()noexcept
+			{
+				released.clear();
+				count = 0u;
+			}
+
+			uint32_t allocate()
+			{
+				if ( released.empty() )
+				{
+					return count++;
+				}
+
+				auto result = released.back();
+				released.pop_back();
+				return result;
+			}
+
+			void release( uint32_t id )
+			{
+				released.push_back( id );
+			}
+		};
+
+		// The objects lists, std::list so that the objects addresses stay valid until their removal.
 		template< typename CulledT >
-		using CulledInstancesT = CulledInstancesArrayT< CulledT, UInt32Array >;
+		using CulledInstancesT = CulledInstancesArrayT< CulledT, UInt32Array, std::list >;
 		template< typename CulledT >
-		using CulledInstancesPtrT = CulledInstancesArrayT< CulledT *, UInt32Array * >;
+		using CulledInstancesPtrT = CulledInstancesArrayT< CulledT *, UInt32Array *, std::vector >;
 
 		template< typename CulledT >
 		using CulledInstanceArrayT = std::array< CulledInstancesT< CulledT >, size_t( RenderMode::eCount ) >;
 		template< typename CulledT >
 		using CulledInstancePtrArrayT = std::array< CulledInstancesPtrT< CulledT >, size_t( RenderMode::eCount ) >;
+		template< typename CulledT >
+		using CulledDeltaArrayT = std::array< CulledDeltaT< CulledT >, size_t( RenderMode::eCount ) >;
+		using VisibilityArray = std::array< castor::DynamicBitset, size_t( RenderMode::eCount ) >;
 
 	public:
 		C3D_API SceneCuller( Scene & scene
@@ -93,10 +240,16 @@ namespace castor3d
 			, uint32_t instancesCount );
 		C3D_API virtual ~SceneCuller() = default;
 		C3D_API void compute();
-
-		inline float getMinCastersZ()
+		/**
+		 *\~english
+		 *\brief		Fills the culling statistics.
+		 *\param[in,out]	info	Receives the statistics.
+		 *\~french
+		 *\brief		Remplit les statistiques de culling.
+		 *\param[in,out]	info	Reçoit les statistiques.
+		 */
+		C3D_API virtual void fillInfo( RenderInfo & info )const
 		{
-			return m_minCullersZ;
 		}
 
 		inline Scene & getScene()const
@@ -150,21 +303,121 @@ namespace castor3d
 		{
 			return m_culledBillboards[size_t( mode )];
 		}
+		/**
+		 *\~english
+		 *\return		The submeshes added and removed by the last compute, meaningless if areAllChanged.
+		 *\~french
+		 *\return		Les sous-maillages ajoutés et retirés par le dernier calcul, non significatif si areAllChanged.
+		 */
+		inline CulledDeltaT< CulledSubmesh > const & getSubmeshesDelta( RenderMode mode )const
+		{
+			return m_submeshesDelta[size_t( mode )];
+		}
+		/**
+		 *\~english
+		 *\return		The billboards added and removed by the last compute, meaningless if areAllChanged.
+		 *\~french
+		 *\return		Les billboards ajoutés et retirés par le dernier calcul, non significatif si areAllChanged.
+		 */
+		inline CulledDeltaT< CulledBillboard > const & getBillboardsDelta( RenderMode mode )const
+		{
+			return m_billboardsDelta[size_t( mode )];
+		}
+		/**
+		 *\~english
+		 *\return		The culled submeshes, as a bitset indexed by the submeshes IDs.
+		 *\~french
+		 *\return		Les sous-maillages visibles, sous forme d'ensemble de bits indexé par les IDs des sous-maillages.
+		 */
+		inline castor::DynamicBitset const & getVisibleSubmeshes( RenderMode mode )const
+		{
+			return m_visibleSubmeshes[size_t( mode )];
+		}
+		/**
+		 *\~english
+		 *\return		The culled billboards, as a bitset indexed by the billboards IDs.
+		 *\~french
+		 *\return		Les billboards visibles, sous forme d'ensemble de bits indexé par les IDs des billboards.
+		 */
+		inline castor::DynamicBitset const & getVisibleBillboards( RenderMode mode )const
+		{
+			return m_visibleBillboards[size_t( mode )];
+		}
 
 	public:
 		mutable SceneCullerSignal onCompute;
 
 	protected:
 		UInt32Array getInitialInstances()const;
+		/**
+		 *\~english
+		 *\brief		Tests the submeshes bounds against given frustum.
+		 *\remarks		The scene's geometries BVH selects the geometries in the frustum,
+		 *				only their submeshes bounds are then tested.
+		 *\param[in]	frustum		The frustum.
+		 *\param[out]	inFrustum	Receives, for each bounds index, 1 if the submesh is in the frustum.
+		 *\~french
+		 *\brief		Teste les limites des sous-maillages par rapport au frustum donné.
+		 *\remarks		La BVH des géométries de la scène sélectionne les géométries dans le frustum,
+		 *				seules les limites de leurs sous-maillages sont ensuite testées.
+		 *\param[in]	frustum		Le frustum.
+		 *\param[out]	inFrustum	Reçoit, pour chaque indice de limites, 1 si le sous-maillage est dans le frustum.
+		 */
+		void doCullBounds( Frustum const & frustum
+			, std::vector< uint8_t > & inFrustum )const;
 
 	private:
+		template< typename CulledT >
+		using CulledEntryArrayT = std::array< std::vector< typename CulledInstancesT< CulledT >::Entry >, size_t( RenderMode::eCount ) >;
+
+		// The culler entries of a geometry.
+		struct GeometryEntries
+		{
+			SceneNode const * node{};
+			Mesh const * mesh{};
+			castor::BoundingBoxArray::Range bounds{};
+			CulledEntryArrayT< CulledSubmesh > entries;
+			OnSubmeshMaterialChangedConnection onMaterialChanged;
+		};
+
+		// The culler entries of a billboard list or a particle system.
+		struct BillboardEntries
+		{
+			CulledEntryArrayT< CulledBillboard > entries;
+			OnBillboardMaterialChangedConnection onMaterialChanged;
+		};
+
+		// The listed billboard lists or particle systems, and their pending changes.
+		template< typename OwnerT >
+		struct BillboardOwnersT
+		{
+			std::unordered_map< OwnerT const *, BillboardEntries > listed;
+			// Added, or with a changed material, or listed while not renderable yet.
+			std::unordered_set< OwnerT * > dirty;
+			std::unordered_set< OwnerT const * > removed;
+		};
+
 		void onSceneChanged( Scene const & scene );
+		void onSceneUpdated( Scene const & scene );
 		void onCameraChanged( Camera const & camera );
 		void doClearAll();
 		void doClearCulled();
-		void doListGeometries();
-		void doListBillboards();
-		void doListParticles();
+		void doUpdateVisibility();
+		void doListAll();
+		void doApplyChanges();
+		void doAddGeometry( Geometry & geometry );
+		void doRemoveGeometry( Geometry const * geometry );
+		void doUpdateGeometryBounds( Geometry const & geometry
+			, GeometryEntries const & entries );
+		template< typename OwnerT >
+		void doAddBillboards( OwnerT & owner
+			, BillboardOwnersT< OwnerT > & owners );
+		template< typename OwnerT >
+		void doRemoveBillboards( OwnerT const * owner
+			, BillboardOwnersT< OwnerT > & owners );
+		template< typename OwnerT >
+		void doApplyBillboardsChanges( BillboardOwnersT< OwnerT > & owners
+			, BillboardOwnersT< OwnerT > & pending );
 		virtual void doCullGeometries() = 0;
 		virtual void doCullBillboards() = 0;
 
@@ -178,12 +431,38 @@ namespace castor3d
 		bool m_culledChanged{ true };
 		bool m_sceneDirty{ true };
 		bool m_cameraDirty{ true };
-		float m_minCullersZ{ 0.0f };
 		CulledInstanceArrayT< CulledSubmesh > m_allSubmeshes;
+		// World space bounds of the listed submeshes, updated when the scene changes.
+		// Removed geometries leave holes, filled back by a full listing when they are too many.
+		castor::BoundingBoxArray m_submeshBounds;
+		uint32_t m_freeBounds{ 0u };
+		std::unordered_map< Geometry const *, GeometryEntries > m_geometries;
 		CulledInstanceArrayT< CulledBillboard > m_allBillboards;
+		BillboardOwnersT< BillboardList > m_billboardLists;
+		BillboardOwnersT< ParticleSystem > m_particleSystems;
 		CulledInstancePtrArrayT< CulledSubmesh > m_culledSubmeshes;
 		CulledInstancePtrArrayT< CulledBillboard > m_culledBillboards;
+		CulledDeltaArrayT< CulledSubmesh > m_submeshesDelta;
+		CulledDeltaArrayT< CulledBillboard > m_billboardsDelta;
+		NodeIds m_submeshIds;
+		NodeIds m_billboardIds;
+		VisibilityArray m_visibleSubmeshes;
+		VisibilityArray m_visibleBillboards;
+		// The changes received from the caches and the scene since the last compute.
+		std::mutex m_pendingMutex;
+		std::unordered_set< Geometry * > m_dirtyGeometries;
+		std::unordered_set< Geometry const * > m_removedGeometries;
+		std::unordered_set< Geometry * > m_movedGeometries;
+		BillboardOwnersT< BillboardList > m_pendingBillboardLists;
+		BillboardOwnersT< ParticleSystem > m_pendingParticleSystems;
+		OnCacheElementConnectionT< Geometry > m_geometryAdded;
+		OnCacheElementConnectionT< Geometry > m_geometryRemoved;
+		OnCacheElementConnectionT< BillboardList > m_billboardListAdded;
+		OnCacheElementConnectionT< BillboardList > m_billboardListRemoved;
+		OnCacheElementConnectionT< ParticleSystem > m_particleSystemAdded;
+		OnCacheElementConnectionT< ParticleSystem > m_particleSystemRemoved;
 		OnSceneChangedConnection m_sceneChanged;
+		OnSceneUpdateConnection m_sceneUpdated;
 		OnCameraChangedConnection m_cameraChanged;
 	};
 }
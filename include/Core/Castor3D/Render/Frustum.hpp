@@ -116,6 +116,16 @@ namespace castor3d
 		 *\return		\p false si le point en dehors du frustum de vue.
 		 */
 		C3D_API bool isVisible( castor::Point3f const & point )const;
+		/**
+		 *\~english
+		 *\return		The frustum planes.
+		 *\~french
+		 *\return		Les plans du frustum.
+		 */
+		Planes const & getPlanes()const
+		{
+			return m_planes;
+		}
 
 	private:
 		Viewport & m_viewport;
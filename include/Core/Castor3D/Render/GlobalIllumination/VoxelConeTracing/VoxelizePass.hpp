@@ -109,6 +109,7 @@ namespace castor3d
 		ShaderPtr doGetBillboardShaderSource( PipelineFlags const & flags )const override;
 		ShaderPtr doGetGeometryShaderSource( PipelineFlags const & flags )const override;
 		ShaderPtr doGetPixelShaderSource( PipelineFlags const & flags )const override;
+		void doHashShaderInputs( size_t & hash )const override;
 
 	private:
 		Scene const & m_scene;
@@ -21,6 +21,49 @@ namespace castor3d
 		using InstantiatedSkinnedNodesMap = RenderNodesT< SubmeshRenderNode, SubmeshRenderNodesPtrByPipelineMap >;
 		using MorphingNodesMap = RenderNodesT< SubmeshRenderNode, SubmeshRenderNodePtrByPipelineMap >;
 		using BillboardNodesMap = RenderNodesT< BillboardRenderNode, BillboardRenderNodePtrByPipelineMap >;
+		/**
+		*\~english
+		*\brief
+		*	A draw call, flattened from the culled nodes, to split the recording in chunks.
+		*\~french
+		*\brief
+		*	Un appel de dessin, aplati depuis les noeuds visibles, pour découper l'enregistrement en morceaux.
+		*/
+		struct Draw
+		{
+			RenderPipeline const * pipeline;
+			//!\~english	The submesh node, \p nullptr for billboards.
+			//!\~french		Le noeud de sous-maillage, \p nullptr pour les billboards.
+			SubmeshRenderNode const * submeshNode;
+			//!\~english	The billboard node, \p nullptr for submeshes.
+			//!\~french		Le noeud de billboard, \p nullptr pour les sous-maillages.
+			BillboardRenderNode const * billboardNode;
+			Pass const * pass;
+			Submesh const * submesh;
+			uint32_t instanceCount;
+			//!\~english	The sort key, packing from highest to lowest bits the pipeline, material, geometry and depth indices (pipeline, depth, material and geometry for alpha blended pipelines).
+			//!\~french		La clé de tri, contenant des bits de poids fort à ceux de poids faible les indices de pipeline, matériau, géométrie et profondeur (pipeline, profondeur, matériau et géométrie pour les pipelines avec mélange alpha).
+			uint64_t sortKey{};
+		};
+		/**
+		*\~english
+		*\brief
+		*	The binds emitted by the last recording.
+		*\~french
+		*\brief
+		*	Les binds émis par le dernier enregistrement.
+		*/
+		struct BindCounts
+		{
+			uint32_t pipelines{};
+			uint32_t descriptorSets{};
+			//!\~english	The vertex and index buffers binds.
+			//!\~french		Les binds de tampons de sommets et d'indices.
+			uint32_t buffers{};
+			//!\~english	The binds skipped because the state was already bound.
+			//!\~french		Les binds évités car l'état était déjà lié.
+			uint32_t skipped{};
+		};
 
 		//!\~english	The static render nodes, sorted by shader program.
 		//!\~french		Les noeuds de rendu statiques, triés par programme shader.
@@ -40,13 +83,50 @@ namespace castor3d
 		//!\~english	The billboards render nodes, sorted by shader program.
 		//!\~french		Les noeuds de rendu de billboards, triés par programme shader.
 		BillboardNodesMap billboardNodes;
+		//!\~english	The draw calls, sorted by sort key.
+		//!\~french		Les appels de dessin, triés par clé de tri.
+		std::vector< Draw > draws;
+		BindCounts bindCounts;
 
 		C3D_API explicit QueueCulledRenderNodes( RenderQueue const & queue );
 
 		C3D_API void parse();
+		/**
+		 *\~english
+		 *\brief		Flattens the culled nodes into the draw calls list, and sorts it to minimise the state changes.
+		 *\return		The draw calls count.
+		 *\~french
+		 *\brief		Aplatit les noeuds visibles dans la liste d'appels de dessin, et la trie pour minimiser les changements d'état.
+		 *\return		Le nombre d'appels de dessin.
+		 */
+		C3D_API uint32_t prepareDraws();
+		/**
+		 *\~english
+		 *\brief		Records the draw calls, split evenly between the given secondary command buffers.
+		 *\remarks		When more than one command buffer is given, they are recorded in parallel, so each one must come from its own pool.
+		 *\param[in]	queue			The render queue.
+		 *\param[in]	viewport		The optional viewport.
+		 *\param[in]	scissors		The optional scissor.
+		 *\param[in]	commandBuffers	The command buffers, to execute in this order.
+		 *\~french
+		 *\brief		Enregistre les appels de dessin, répartis équitablement entre les tampons de commandes secondaires donnés.
+		 *\remarks		Lorsque plus d'un tampon de commandes est donné, ils sont enregistrés en parallèle, chacun doit donc venir de son propre pool.
+		 *\param[in]	queue			La file de rendu.
+		 *\param[in]	viewport		Le viewport optionnel.
+		 *\param[in]	scissors		Le scissor optionnel.
+		 *\param[in]	commandBuffers	Les tampons de commandes, à exécuter dans cet ordre.
+		 */
 		C3D_API void prepareCommandBuffers( RenderQueue const & queue
 			, ashes::Optional< VkViewport > const & viewport
-			, ashes::Optional< VkRect2D > const & scissors );
+			, ashes::Optional< VkRect2D > const & scissors
+			, std::vector< ashes::CommandBuffer const * > const & commandBuffers );
+		/**
+		 *\~english
+		 *\brief		Adds the binds counts of the last recording to given render informations.
+		 *\~french
+		 *\brief		Ajoute les nombres de binds du dernier enregistrement aux informations de rendu données.
+		 */
+		C3D_API void fillInfo( RenderInfo & info )const;
 		C3D_API bool hasNodes()const;
 	};
 }
@@ -9,6 +9,7 @@ See LICENSE file in root folder
 #include "Castor3D/Shader/Ubos/UbosModule.hpp"
 
 #include "Castor3D/Buffer/UniformBufferOffset.hpp"
+#include "Castor3D/Render/Culling/SceneCuller.hpp"
 #include "Castor3D/Render/Node/PassRenderNode.hpp"
 
 #include <CastorUtils/Design/OwnedBy.hpp>
@@ -63,7 +64,11 @@ namespace castor3d
 
 		C3D_API explicit QueueRenderNodes( RenderQueue const & queue );
 
-		C3D_API void parse( ShadowMapLightTypeArray & shadowMaps );
+		C3D_API void parse( ShadowMapLightTypeArray const & shadowMaps );
+		// Removes the nodes of the culler's removed objects, then adds the nodes of its added ones.
+		C3D_API void update( SceneCuller::CulledDeltaT< CulledSubmesh > const & submeshes
+			, SceneCuller::CulledDeltaT< CulledBillboard > const & billboards );
+		C3D_API void initialiseNodes( ShadowMapLightTypeArray const & shadowMaps );
 		C3D_API void addRenderNode( RenderPipeline & pipeline
 			, AnimatedObjects const & animated
 			, CulledSubmesh const & culledNode
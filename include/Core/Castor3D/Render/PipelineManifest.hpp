@@ -0,0 +1,149 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_PipelineManifest_H___
+#define ___C3D_PipelineManifest_H___
+
+#include "RenderModule.hpp"
+
+#include <CastorUtils/Data/Path.hpp>
+
+#include <mutex>
+#include <unordered_map>
+
+namespace castor3d
+{
+	class PipelineManifest
+	{
+	public:
+		/**
+		*\~english
+		*\brief
+		*	The manifest statistics, for the current run.
+		*\~french
+		*\brief
+		*	Les statistiques du manifeste, pour l'exécution courante.
+		*/
+		struct Statistics
+		{
+			//!\~english	The number of variants read from the manifest file.
+			//!\~french		Le nombre de variantes lues depuis le fichier manifeste.
+			uint32_t loaded{};
+			//!\~english	The number of variants used this run, and which were known by the manifest.
+			//!\~french		Le nombre de variantes utilisées pendant cette exécution, et qui étaient connues du manifeste.
+			uint32_t hits{};
+			//!\~english	The number of variants used this run, and which were unknown by the manifest.
+			//!\~french		Le nombre de variantes utilisées pendant cette exécution, et qui étaient inconnues du manifeste.
+			uint32_t misses{};
+			//!\~english	The number of programs generated in background, from the manifest.
+			//!\~french		Le nombre de programmes générés en arrière plan, depuis le manifeste.
+			uint32_t prewarmed{};
+		};
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	file	The manifest file, the manifest is disabled if empty.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	file	Le fichier manifeste, le manifeste est désactivé s'il est vide.
+		 */
+		C3D_API explicit PipelineManifest( castor::Path file = {} );
+		/**
+		 *\~english
+		 *\brief		Reads the manifest file, and merges its variants with the known ones.
+		 *\return		\p false if the file doesn't exist or is invalid.
+		 *\~french
+		 *\brief		Lit le fichier manifeste, et fusionne ses variantes avec celles connues.
+		 *\return		\p false si le fichier n'existe pas ou est invalide.
+		 */
+		C3D_API bool load();
+		/**
+		 *\~english
+		 *\brief		Writes the known variants to the manifest file.
+		 *\remarks		The variants written to the file by other runs meanwhile are kept.
+		 *\return		\p false if the file couldn't be written.
+		 *\~french
+		 *\brief		Ecrit les variantes connues dans le fichier manifeste.
+		 *\remarks		Les variantes écrites dans le fichier par d'autres exécutions entre temps sont conservées.
+		 *\return		\p false si le fichier n'a pas pu être écrit.
+		 */
+		C3D_API bool save();
+		/**
+		 *\~english
+		 *\brief		Records a variant used by a render pass.
+		 *\remarks		Updates the hits and misses statistics, the first time the variant is used during this run.
+		 *\param[in]	passName	The render pass name.
+		 *\param[in]	flags		The pipeline flags.
+		 *\~french
+		 *\brief		Enregistre une variante utilisée par une passe de rendu.
+		 *\remarks		Met à jour les statistiques de succès et d'échecs, la première fois que la variante est utilisée pendant cette exécution.
+		 *\param[in]	passName	Le nom de la passe de rendu.
+		 *\param[in]	flags		Les indicateurs de pipeline.
+		 */
+		C3D_API void record( castor::String const & passName
+			, PipelineFlags const & flags );
+		/**
+		 *\~english
+		 *\brief		Counts a program generated in background.
+		 *\~french
+		 *\brief		Compte un programme généré en arrière plan.
+		 */
+		C3D_API void notifyPrewarmed();
+		/**
+		 *\~english
+		 *\param[in]	passName	The render pass name.
+		 *\return		The variants known for given render pass.
+		 *\~french
+		 *\param[in]	passName	Le nom de la passe de rendu.
+		 *\return		Les variantes connues pour la passe de rendu donnée.
+		 */
+		C3D_API std::vector< PipelineFlags > getVariants( castor::String const & passName )const;
+		/**
+		 *\~english
+		 *\return		The statistics for the current run.
+		 *\~french
+		 *\return		Les statistiques pour l'exécution courante.
+		 */
+		C3D_API Statistics getStatistics()const;
+		/**
+		*\~english
+		*name
+		*	Getters.
+		*\~french
+		*name
+		*	Accesseurs.
+		**/
+		/**@{*/
+		bool isEnabled()const
+		{
+			return !m_file.empty();
+		}
+
+		castor::Path const & getFile()const
+		{
+			return m_file;
+		}
+		/**@}*/
+
+	private:
+		enum class Origin
+		{
+			eFile,
+			eUsedFromFile,
+			eUsedOnly,
+		};
+		using PassVariants = std::unordered_map< PipelineFlags, Origin, PipelineFlagsHasher >;
+
+		bool doLoad();
+
+	private:
+		castor::Path m_file;
+		mutable std::mutex m_mutex;
+		std::map< castor::String, PassVariants > m_variants;
+		Statistics m_statistics;
+	};
+}
+
+#endif
@@ -151,6 +151,31 @@ namespace castor3d
 			, Face & nearestFace
 			, SubmeshSPtr & nearestSubmesh
 			, float & distance )const;
+		/**
+		 *\~english
+		 *\brief		Looks for the nearest geometry of the given scene intersected by the ray.
+		 *\remarks		Only the geometries which bounds are hit, in the scene's BVH, are tested.
+		 *\param[in]	scene			The scene.
+		 *\param[out]	nearestGeometry	Receives the intersected geometry.
+		 *\param[out]	nearestFace		Receives the intersected face.
+		 *\param[out]	nearestSubmesh	Receives the intersected submesh.
+		 *\param[out]	distance		Receives the distance.
+		 *\return		\p castor::Intersection::eIn or \p castor::Intersection::eOut.
+		 *\~french
+		 *\brief		Recherche la géométrie la plus proche, de la scène donnée, croisée par le rayon.
+		 *\remarks		Seules les géométries dont les limites sont touchées, dans la BVH de la scène, sont testées.
+		 *\param[in]	scene			La scène.
+		 *\param[out]	nearestGeometry	Reçoit la géométrie croisée.
+		 *\param[out]	nearestFace		Reçoit la face croisée.
+		 *\param[out]	nearestSubmesh	Reçoit le sous-maillage croisé.
+		 *\param[out]	distance		Reçoit la distance.
+		 *\return		\p castor::Intersection::eIn ou \p castor::Intersection::eOut.
+		 */
+		C3D_API castor::Intersection intersects( Scene const & scene
+			, Geometry *& nearestGeometry
+			, Face & nearestFace
+			, SubmeshSPtr & nearestSubmesh
+			, float & distance )const;
 		/**
 		 *\~english
 		 *\brief		Projects the given vertex on the ray.
@@ -161,6 +186,12 @@ namespace castor3d
 		C3D_API bool projectVertex( castor::Point3f const & point
 			, castor::Point3f & result )const;
 
+	private:
+		castor::Intersection doIntersects( Geometry const & geometry
+			, Face & nearestFace
+			, SubmeshSPtr & nearestSubmesh
+			, float & distance )const;
+
 	public:
 		//!\~english	The ray origin.
 		//!\~french		L'origine du rayon.
@@ -7,6 +7,7 @@ See LICENSE file in root folder
 #include "RenderModule.hpp"
 #include "Castor3D/Buffer/BufferModule.hpp"
 
+#include <CastorUtils/Data/Path.hpp>
 #include <CastorUtils/Design/FlagCombination.hpp>
 
 #include <ashespp/Command/CommandPool.hpp>
@@ -51,6 +52,15 @@ namespace castor3d
 		C3D_API VkFormat selectSuitableDepthStencilFormat( VkFormatFeatureFlags requiredFeatures )const;
 		C3D_API VkFormat selectSuitableFormat( std::vector< VkFormat > const & formats
 			, VkFormatFeatureFlags requiredFeatures )const;
+		/**
+		 *\~english
+		 *\brief		Writes the pipeline cache content to its file, for next runs.
+		 *\remarks		Called at device destruction.
+		 *\~french
+		 *\brief		Ecrit le contenu du cache de pipelines dans son fichier, pour les exécutions suivantes.
+		 *\remarks		Appelé à la destruction du device.
+		 */
+		C3D_API void savePipelineCache()const;
 		C3D_API crg::GraphContext & makeContext()const
 		{
 			return *m_context;
@@ -102,6 +112,8 @@ namespace castor3d
 		VkPhysicalDeviceProperties properties{};
 		QueueFamilies queueFamilies;
 		ashes::DevicePtr device;
+		castor::Path pipelineCacheFile;
+		VkPipelineCache pipelineCache{};
 		QueueData * m_preferredGraphicsQueue{};
 		QueueData * m_preferredComputeQueue{};
 		QueueData * m_preferredTransferQueue{};
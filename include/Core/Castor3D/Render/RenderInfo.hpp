@@ -28,6 +28,15 @@ namespace castor3d
 		//!\~english	The visible objects count.
 		//!\~french		Le nombre d'objets visibles.
 		uint32_t m_visibleObjectsCount{ 0u };
+		//!\~english	The objects count tested by the occlusion culling.
+		//!\~french		Le nombre d'objets testés par l'occlusion culling.
+		uint32_t m_occlusionTestedObjectsCount{ 0u };
+		//!\~english	The objects count hidden by occluders.
+		//!\~french		Le nombre d'objets cachés par des occultants.
+		uint32_t m_occludedObjectsCount{ 0u };
+		//!\~english	The occluders triangles count rasterised by the occlusion culling.
+		//!\~french		Le nombre de triangles d'occultants rastérisés par l'occlusion culling.
+		uint32_t m_occluderTrianglesCount{ 0u };
 		//!\~english	The particles count.
 		//!\~french		Le nombre de particules.
 		uint32_t m_particlesCount{ 0u };
@@ -40,6 +49,21 @@ namespace castor3d
 		//!\~english	The draw calls count.
 		//!\~french		Le nombre d'appels aux fonctions de dessin.
 		uint32_t m_drawCalls{ 0u };
+		//!\~english	The pipeline binds count, in the render queues.
+		//!\~french		Le nombre de binds de pipeline, dans les files de rendu.
+		uint32_t m_pipelineBinds{ 0u };
+		//!\~english	The descriptor set binds count, in the render queues.
+		//!\~french		Le nombre de binds de descriptor set, dans les files de rendu.
+		uint32_t m_descriptorSetBinds{ 0u };
+		//!\~english	The vertex and index buffer binds count, in the render queues.
+		//!\~french		Le nombre de binds de tampons de sommets et d'indices, dans les files de rendu.
+		uint32_t m_bufferBinds{ 0u };
+		//!\~english	The redundant binds count, skipped in the render queues.
+		//!\~french		Le nombre de binds redondants, évités dans les files de rendu.
+		uint32_t m_skippedBinds{ 0u };
+		//!\~english	The bytes count copied from the staging buffers to the pooled uniform buffers.
+		//!\~french		Le nombre d'octets copiés depuis les staging buffers vers les tampons d'uniformes des pools.
+		uint32_t m_uploadedUboBytes{ 0u };
 	};
 }
 
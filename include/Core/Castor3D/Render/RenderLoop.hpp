@@ -10,7 +10,7 @@ See LICENSE file in root folder
 #include "Castor3D/Overlay/OverlayModule.hpp"
 #include "Castor3D/Render/Passes/CommandsSemaphore.hpp"
 
-#include <CastorUtils/Multithreading/AsyncJobQueue.hpp>
+#include <CastorUtils/Multithreading/JobScheduler.hpp>
 
 #include <ashespp/Core/WindowHandle.hpp>
 
@@ -194,6 +194,46 @@ namespace castor3d
 		{
 			return m_lastFrameTime;
 		}
+		/**
+		 *\~english
+		 *\return		The number of frames in flight slots currently used.
+		 *\~french
+		 *\return		Le nombre d'emplacements de frames en vol actuellement utilisés.
+		 */
+		uint32_t getFramesInFlight()const
+		{
+			return uint32_t( m_uploadResources.size() );
+		}
+		/**
+		 *\~english
+		 *\return		The index of the slot the next frame will use.
+		 *\~french
+		 *\return		L'indice de l'emplacement que la prochaine frame utilisera.
+		 */
+		uint32_t getCurrentFrameSlot()const
+		{
+			return m_currentUpdate;
+		}
+		/**
+		 *\~english
+		 *\return		The number of frames submitted to the GPU.
+		 *\~french
+		 *\return		Le nombre de frames soumises au GPU.
+		 */
+		uint64_t getSubmittedFrames()const
+		{
+			return m_submittedFrames;
+		}
+		/**
+		 *\~english
+		 *\return		The number of the last frame whose fence has been waited for.
+		 *\~french
+		 *\return		Le numéro de la dernière frame dont la fence a été attendue.
+		 */
+		uint64_t getCompletedFrames()const
+		{
+			return m_completedFrames;
+		}
 
 	protected:
 		/**
@@ -229,20 +269,38 @@ namespace castor3d
 		//!\~english	The debug overlays.
 		//!\~french		Les incrustations de débogage.
 		std::unique_ptr< DebugOverlays > m_debugOverlays;
-		//!\~english	The pool used to update the render queues.
-		//!\~french		Le pool de mise à jour des files de rendu.
-		castor::ThreadPool m_queueUpdater;
+		//!\~english	The scheduler used to parse the render queues in parallel.
+		//!\~french		L'ordonnanceur utilisé pour parser les files de rendu en parallèle.
+		castor::JobScheduler m_queueUpdater;
 		struct UploadResources
 		{
 			//!\~english	The command buffer and semaphore used for UBO uploads.
 			//!\~french		Le command buffer et le semaphore utilisé pour l'upload des UBO.
 			CommandsSemaphore commands;
-			//!\~english	The fence and semaphore used for UBO uploads.
-			//!\~french		La fence et le semaphore utilisé pour l'upload des UBO.
+			//!\~english	The fence signalled at the end of the frame.
+			//!\~french		La fence signalée à la fin de la frame.
 			ashes::FencePtr fence;
+			//!\~english	The number of the frame last submitted with this fence.
+			//!\~french		Le numéro de la frame soumise en dernier avec cette fence.
+			uint64_t frame{ 0u };
 		};
-		std::array< UploadResources, 2u > m_uploadResources;
+		//!\~english	One set of resources per frame in flight.
+		//!\~french		Un ensemble de ressources par frame en vol.
+		std::vector< UploadResources > m_uploadResources;
+		//!\~english	The index of the current frame's resources.
+		//!\~french		L'indice des ressources de la frame courante.
 		uint32_t m_currentUpdate{ 0u };
+		//!\~english	The number of frames submitted to the GPU.
+		//!\~french		Le nombre de frames soumises au GPU.
+		uint64_t m_submittedFrames{ 0u };
+		//!\~english	The number of the last frame known to be finished.
+		//!\~french		Le numéro de la dernière frame connue comme terminée.
+		uint64_t m_completedFrames{ 0u };
+
+	private:
+		void doUpdateFramesInFlight( RenderDevice const & device );
+		void doWaitFrame( UploadResources & resources );
+		void doWaitFramesInFlight();
 
 	private:
 		bool m_first = true;
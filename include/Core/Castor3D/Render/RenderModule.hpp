@@ -532,6 +532,34 @@ namespace castor3d
 		TextureFlags texturesFlags;
 	};
 	C3D_API bool operator==( PipelineFlags const & lhs, PipelineFlags const & rhs );
+	/**
+	 *\~english
+	 *\brief		Computes a hash of the given pipeline flags.
+	 *\remarks		The hash is stable across runs of a given build, and can thus be used as a persistent key.
+	 *\param[in]	flags	The pipeline flags.
+	 *\return		The hash.
+	 *\~french
+	 *\brief		Calcule un hash des indicateurs de pipeline donnés.
+	 *\remarks		Le hash est stable entre les exécutions d'un même build, et peut donc être utilisé en tant que clé persistante.
+	 *\param[in]	flags	Les indicateurs de pipeline.
+	 *\return		Le hash.
+	 */
+	C3D_API size_t hash( PipelineFlags const & flags );
+	/**
+	*\~english
+	*\brief
+	*	Hasher for PipelineFlags, to use them as unordered containers keys.
+	*\~french
+	*\brief
+	*	Hasheur pour PipelineFlags, pour les utiliser comme clés de conteneurs non ordonnés.
+	*/
+	struct PipelineFlagsHasher
+	{
+		size_t operator()( PipelineFlags const & flags )const
+		{
+			return hash( flags );
+		}
+	};
 	/**
 	*\~english
 	*\brief
@@ -656,6 +684,15 @@ namespace castor3d
 	/**
 	*\~english
 	*\brief
+	*	Records the pipeline flags used by each render pass, to pre-generate their programs on next runs.
+	*\~french
+	*\brief
+	*	Enregistre les indicateurs de pipeline utilisés par chaque passe de rendu, pour pré-générer leurs programmes lors des exécutions suivantes.
+	*/
+	class PipelineManifest;
+	/**
+	*\~english
+	*\brief
 	*	The render nodes for a specific scene.
 	*\~french
 	*\brief
@@ -13,6 +13,7 @@ See LICENSE file in root folder
 
 #include <CastorUtils/Design/Named.hpp>
 #include <CastorUtils/Graphics/Size.hpp>
+#include <CastorUtils/Multithreading/AsyncJobQueue.hpp>
 
 #include <RenderGraph/RunnablePasses/RenderPass.hpp>
 
@@ -416,6 +417,15 @@ namespace castor3d
 		 */
 		C3D_API FilteredTextureFlags filterTexturesFlags( TextureFlagsArray const & textures )const;
 		C3D_API void setIgnoredNode( SceneNode const & node );
+		/**
+		 *\~english
+		 *\brief		Cancels the programs prewarm jobs, and waits for the running ones.
+		 *\remarks		The jobs use the pass shader sources, hence the most derived passes must call it from their destructor.
+		 *\~french
+		 *\brief		Annule les tâches de préchauffage des programmes, et attend celles en cours.
+		 *\remarks		Les tâches utilisent les sources des shaders de la passe, les passes les plus dérivées doivent donc l'appeler depuis leur destructeur.
+		 */
+		C3D_API void cleanupPrewarm();
 		/**
 		 *\~english
 		 *\brief		Creates a blend state matching given blend modes.
@@ -450,6 +460,13 @@ namespace castor3d
 			return ShaderFlag::eWorldSpace
 				| ShaderFlag::eTangentSpace;
 		}
+		/**
+		 *\~english
+		 *\return		The hash of the pass state, other than the pipeline flags, the shaders are generated from.
+		 *\~french
+		 *\return		Le hash de l'état de la passe, autre que les flags de pipeline, à partir duquel les shaders sont générés.
+		 */
+		C3D_API size_t getShaderInputsHash()const;
 
 		bool isOrderIndependent()const
 		{
@@ -809,6 +826,15 @@ namespace castor3d
 		 *\param[in]	flags	Les indicateurs de pipeline.
 		 */
 		C3D_API virtual ShaderPtr doGetPixelShaderSource( PipelineFlags const & flags )const = 0;
+		/**
+		 *\~english
+		 *\brief			Adds to the given hash the pass specific state the shaders are generated from.
+		 *\param[in,out]	hash	The hash.
+		 *\~french
+		 *\brief			Ajoute au hash donné l'état spécifique à la passe à partir duquel les shaders sont générés.
+		 *\param[in,out]	hash	Le hash.
+		 */
+		C3D_API virtual void doHashShaderInputs( size_t & hash )const;
 
 	public:
 		struct VertexInputs
@@ -871,6 +897,7 @@ namespace castor3d
 	private:
 		std::vector< RenderPipelineUPtr > m_frontPipelines;
 		std::vector< RenderPipelineUPtr > m_backPipelines;
+		std::vector< castor::AsyncJobQueue::Handle > m_prewarmJobs;
 	};
 }
 
@@ -198,13 +198,13 @@ namespace castor3d
 
 		bool hasPipeline()const
 		{
-			return m_pipeline != nullptr;
+			return m_pipeline != VkPipeline{};
 		}
 
-		ashes::GraphicsPipeline const & getPipeline()const
+		VkPipeline getPipeline()const
 		{
-			hasPipeline();
-			return *m_pipeline;
+			CU_Require( hasPipeline() );
+			return m_pipeline;
 		}
 
 		ashes::PipelineLayout const & getPipelineLayout()const
@@ -234,6 +234,9 @@ namespace castor3d
 		}
 		/**@}*/
 
+	private:
+		void doDestroyPipeline();
+
 	private:
 		RenderSystem & m_renderSystem;
 		ashes::PipelineDepthStencilStateCreateInfo m_dsState;
@@ -249,7 +252,8 @@ namespace castor3d
 		std::unique_ptr< VkViewport > m_viewport;
 		std::unique_ptr< VkRect2D > m_scissor;
 		ashes::PipelineLayoutPtr m_pipelineLayout;
-		ashes::GraphicsPipelinePtr m_pipeline;
+		ashes::Device const * m_device{};
+		VkPipeline m_pipeline{};
 		std::unordered_map< SubmeshRenderNode const *, ashes::DescriptorSetPtr > m_submeshAddDescriptors;
 		std::unordered_map< BillboardRenderNode const *, ashes::DescriptorSetPtr > m_billboardAddDescriptors;
 	};
@@ -4,12 +4,14 @@ See LICENSE file in root folder
 #ifndef ___C3D_RenderQueue_H___
 #define ___C3D_RenderQueue_H___
 
+#include "Castor3D/Render/Culling/SceneCuller.hpp"
 #include "Castor3D/Render/Node/RenderNodeModule.hpp"
 #include "Castor3D/Render/ShadowMap/ShadowMapModule.hpp"
 
 #include <CastorUtils/Design/GroupChangeTracked.hpp>
 
 #include <atomic>
+#include <mutex>
 
 #if defined( CU_CompilerMSVC )
 #	pragma warning( push )
@@ -87,6 +89,26 @@ namespace castor3d
 		 */
 		C3D_API void update( ShadowMapLightTypeArray & shadowMaps
 			, VkRect2D const & scissor );
+		/**
+		 *\~english
+		 *\brief		Parses the render nodes, CPU side of update().
+		 *\remarks		Doesn't send any event, so different queues can be parsed concurrently.
+		 *\param[in]	shadowMaps	The shadow maps used in the render pass.
+		 *\~french
+		 *\brief		Parse les noeuds de rendu, partie CPU de update().
+		 *\remarks		N'envoie aucun évènement, des files différentes peuvent donc être parsées en parallèle.
+		 *\param[in]	shadowMaps	Les shadow maps utilisées par la passe de rendu.
+		 */
+		C3D_API void parse( ShadowMapLightTypeArray const & shadowMaps );
+		/**
+		 *\~english
+		 *\brief		Sends the GPU events resulting from the last parse().
+		 *\remarks		To keep the events order deterministic, the queues must be processed one at a time, always in the same order.
+		 *\~french
+		 *\brief		Envoie les évènements GPU résultant du dernier parse().
+		 *\remarks		Pour que l'ordre des évènements soit déterministe, les files doivent être traitées une par une, toujours dans le même ordre.
+		 */
+		C3D_API void sendEvents();
 		C3D_API void setIgnoredNode( SceneNode const & node );
 		/**@}*/
 		/**
@@ -117,6 +139,16 @@ namespace castor3d
 		{
 			return *m_commandBuffer;
 		}
+		/**
+		 *\~english
+		 *\return		The secondary command buffers holding the queue's draw calls, in execution order.
+		 *\~french
+		 *\return		Les tampons de commandes secondaires contenant les appels de dessin de la file, dans l'ordre d'exécution.
+		 */
+		std::vector< VkCommandBuffer > const & getCommandBuffers()const
+		{
+			return m_commandBuffers;
+		}
 
 		SceneCuller const & getCuller()const
 		{
@@ -131,7 +163,8 @@ namespace castor3d
 
 	private:
 		void doPrepareCommandBuffer();
-		void doParseAllRenderNodes( ShadowMapLightTypeArray & shadowMaps );
+		std::vector< ashes::CommandBuffer const * > doGetChunksCommandBuffers( uint32_t count );
+		void doParseAllRenderNodes( ShadowMapLightTypeArray const & shadowMaps );
 		void doParseCulledRenderNodes();
 		void doOnCullerCompute( SceneCuller const & culler );
 
@@ -142,8 +175,26 @@ namespace castor3d
 		QueueRenderNodesUPtr m_renderNodes;
 		QueueCulledRenderNodesUPtr m_culledRenderNodes;
 		ashes::CommandBufferPtr m_commandBuffer;
+		// The command buffers used after the first one, when the draw calls are recorded in parallel.
+		// Each one has its own pool, since a pool can't be used by more than one thread at a time.
+		struct CommandChunk
+		{
+			ashes::CommandPoolPtr pool;
+			ashes::CommandBufferPtr commandBuffer;
+		};
+		std::vector< CommandChunk > m_chunks;
+		std::vector< VkCommandBuffer > m_commandBuffers;
+		// Protects the changes received from the culler.
+		std::mutex m_cullerChangesMutex;
 		bool m_allChanged{};
 		bool m_culledChanged{};
+		// The culler's additions and removals since the last parse, applied without a full parse.
+		SceneCuller::CulledDeltaT< CulledSubmesh > m_submeshesDelta;
+		SceneCuller::CulledDeltaT< CulledBillboard > m_billboardsDelta;
+		SceneFlags m_sceneFlags;
+		bool m_allParsed{};
+		bool m_culledParsed{};
+		ShadowMapLightTypeArray m_shadowMaps;
 		castor::GroupChangeTracked< ashes::Optional< VkViewport > > m_viewport;
 		castor::GroupChangeTracked< ashes::Optional< VkRect2D > > m_scissor;
 		enum class Preparation
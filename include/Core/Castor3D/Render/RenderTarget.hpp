@@ -196,6 +196,11 @@ namespace castor3d
 			return m_ssaoConfig;
 		}
 
+		bool isOcclusionCulling()const
+		{
+			return m_occlusionCulling;
+		}
+
 		bool isInitialised()const
 		{
 			return m_initialised;
@@ -321,6 +326,18 @@ namespace castor3d
 		{
 			m_ssaoConfig = config;
 		}
+		/**
+		 *\~english
+		 *\brief		Enables or disables the CPU occlusion culling of the technique passes.
+		 *\remarks		Takes effect when the culler is created, at initialisation or when the camera changes.
+		 *\~french
+		 *\brief		Active ou désactive l'occlusion culling CPU des passes de la technique.
+		 *\remarks		Prend effet à la création du culler, à l'initialisation ou au changement de caméra.
+		 */
+		void setOcclusionCulling( bool value )
+		{
+			m_occlusionCulling = value;
+		}
 
 		void setJitter( castor::Point2f const & value )
 		{
@@ -337,6 +354,7 @@ namespace castor3d
 			, crg::ImageViewId const & target
 			, crg::FramePass const & previousPass );
 		void doInitCombineProgram();
+		void doCreateCuller();
 		void doRender( RenderDevice const & device
 			, RenderInfo & info
 			, CameraSPtr camera );
@@ -374,6 +392,7 @@ namespace castor3d
 		ashes::SemaphorePtr m_signalReady;
 		crg::SemaphoreWait m_signalFinished{};
 		SceneCullerUPtr m_culler;
+		bool m_occlusionCulling{ false };
 		crg::FrameGraph m_graph;
 		Texture m_velocity;
 		Texture m_objects;
@@ -438,6 +438,7 @@ namespace castor3d
 		void doResetSwapChain();
 		RenderingResources * doGetResources();
 		void doWaitFrame();
+		bool doIsPipelined()const;
 		void doSubmitFrame( RenderingResources * resources );
 		void doPresentFrame( RenderingResources * resources );
 		bool doCheckNeedReset( VkResult errCode
@@ -471,7 +472,8 @@ namespace castor3d
 		bool m_vsync{ false };
 		bool m_fullscreen{ false };
 		castor::Size m_size;
-		bool m_toSave{ false };
+		std::atomic_bool m_toSave{ false };
+		bool m_saving{ false };
 		mutable std::atomic_bool m_dirty{ true };
 		castor::PxBufferBaseSPtr m_saveBuffer;
 		PickingSPtr m_picking;
@@ -38,6 +38,13 @@ namespace castor3d
 			, castor::String const & name
 			, SceneRenderPassDesc const & renderPassDesc
 			, RenderTechniquePassDesc const & techniquePassDesc );
+		/**
+		 *\~english
+		 *\brief		Destructor
+		 *\~french
+		 *\brief		Destructeur
+		 */
+		C3D_API ~ForwardRenderTechniquePass();
 		/**
 		 *\copydoc		castor3d::RenderTechniquePass::accept
 		 */
@@ -242,6 +242,10 @@ namespace castor3d
 		 *\param[in]	flags	Les indicateurs de pipeline.
 		 */
 		ShaderPtr doGetVertexShaderSource( PipelineFlags const & flags )const override;
+		/**
+		 *\copydoc		castor3d::SceneRenderPass::doHashShaderInputs
+		 */
+		void doHashShaderInputs( size_t & hash )const override;
 
 	protected:
 		Scene const & m_scene;
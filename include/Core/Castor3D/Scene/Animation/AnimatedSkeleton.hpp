@@ -137,6 +137,7 @@ namespace castor3d
 		void doStartAnimation( AnimationInstance & animation )override;
 		void doStopAnimation( AnimationInstance & animation )override;
 		void doClearAnimations()override;
+		void doUpdatePose();
 
 	protected:
 		//!\~english	The skeleton affected by the animations.
@@ -151,6 +152,9 @@ namespace castor3d
 		//!\~english	Currently playing animations.
 		//!\~french		Les animations en cours de lecture.
 		SkeletonAnimationInstanceArray m_playingAnimations;
+		//!\~english	The playing animations blended transforms, one per bone.
+		//!\~french		Les transformations mélangées des animations en cours de lecture, une par os.
+		std::vector< castor::Matrix4x4f > m_pose;
 	};
 }
 
@@ -54,6 +54,22 @@ namespace castor3d
 		 *\param[in]	bone	L'os.
 		 */
 		C3D_API SkeletonAnimationInstanceObjectSPtr getObject( Bone const & bone )const;
+		/**
+		 *\~english
+		 *\brief		Retrieves the animated bone for a skeleton bone, resolved when the instance is created.
+		 *\param[in]	index	The bone index in the skeleton.
+		 *\return		\p nullptr if the bone isn't animated.
+		 *\~french
+		 *\brief		Récupère l'os animé pour un os du squelette, résolu à la création de l'instance.
+		 *\param[in]	index	L'indice de l'os dans le squelette.
+		 *\return		\p nullptr si l'os n'est pas animé.
+		 */
+		SkeletonAnimationInstanceObject const * getBoneObject( size_t index )const
+		{
+			return index < m_bones.size()
+				? m_bones[index]
+				: nullptr;
+		}
 		/**
 		 *\~english
 		 *\brief		Retrieves an animated node.
@@ -133,6 +149,9 @@ namespace castor3d
 		//!\~english	The moving objects.
 		//!\~french		Les objets mouvants.
 		SkeletonAnimationInstanceObjectPtrArray m_toMove;
+		//!\~english	The animated bones, indexed as the skeleton bones.
+		//!\~french		Les os animés, indexés comme les os du squelette.
+		std::vector< SkeletonAnimationInstanceObject const * > m_bones;
 		//!\~english	The instance keyframes.
 		//!\~french		Les instances des keyframes.
 		SkeletonAnimationInstanceKeyFrameArray m_keyFrames;
@@ -39,6 +39,18 @@ namespace castor3d
 		 *\brief		Applique la keyframe.
 		 */
 		C3D_API void apply();
+		/**
+		 *\~english
+		 *\brief		Applies the keyframe, interpolated towards the next one.
+		 *\param[in]	next	The next keyframe.
+		 *\param[in]	factor	The interpolation factor, 0 applying this keyframe, 1 applying \p next.
+		 *\~french
+		 *\brief		Applique la keyframe, interpolée vers la suivante.
+		 *\param[in]	next	La keyframe suivante.
+		 *\param[in]	factor	Le facteur d'interpolation, 0 appliquant cette keyframe, 1 appliquant \p next.
+		 */
+		C3D_API void apply( SkeletonAnimationInstanceKeyFrame const & next
+			, float factor );
 		/**
 		 *\~english
 		 *\return		The start time index.
@@ -55,6 +67,9 @@ namespace castor3d
 		SkeletonAnimationKeyFrame const & m_keyFrame;
 		ObjectArray m_objects;
 		SubmeshBoundingBoxList m_boxes;
+		// The instance objects and their parent index, in the keyframe local transforms order.
+		std::vector< std::pair< SkeletonAnimationInstanceObject *, uint32_t > > m_locals;
+		std::vector< castor::Matrix4x4f > m_cumulative;
 	};
 	using SkeletonAnimationInstanceKeyFrameArray = std::vector< SkeletonAnimationInstanceKeyFrame >;
 }
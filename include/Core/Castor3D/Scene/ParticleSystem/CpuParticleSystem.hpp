@@ -6,6 +6,7 @@ See LICENSE file in root folder
 
 #include "Castor3D/Scene/ParticleSystem/Particle.hpp"
 #include "Castor3D/Scene/ParticleSystem/ParticleEmitter.hpp"
+#include "Castor3D/Scene/ParticleSystem/ParticleStreams.hpp"
 #include "Castor3D/Scene/ParticleSystem/ParticleSystemImpl.hpp"
 
 namespace castor3d
@@ -116,9 +117,9 @@ namespace castor3d
 		//!\~english	The particle's elements description.
 		//!\~french		La description des éléments d'une particule.
 		ParticleDeclaration m_inputs;
-		//!\~english	The particles.
-		//!\~french		Les particules.
-		ParticleArray m_particles;
+		//!\~english	The particles, one stream per element.
+		//!\~french		Les particules, un flux par élément.
+		ParticleStreams m_particles;
 		//!\~english	The particles emitters.
 		//!\~french		Les émetteurs de particules.
 		ParticleEmitterArray m_emitters;
@@ -159,14 +159,23 @@ namespace castor3d
 	/**
 	*\~english
 	*\brief
+	*	The CPU particles values, stored as one contiguous stream per particle element.
+	*\~french
+	*\brief
+	*	Les valeurs des particules CPU, stockées en un flux contigu par élément de particule.
+	*/
+	class ParticleStreams;
+	/**
+	*\~english
+	*\brief
 	*	Updates the particles.
 	*\remarks
-	*	Met à jour une particule à la fois
+	*	Updates all the particles at once, stream by stream.
 	*\~french
 	*\brief
 	*	Met à jour les particules.
 	*\remarks
-	*	Met à jour une particule à la fois.
+	*	Met à jour toutes les particules en une fois, flux par flux.
 	*/
 	class ParticleUpdater;
 	/**
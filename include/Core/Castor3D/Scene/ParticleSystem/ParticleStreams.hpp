@@ -0,0 +1,115 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_ParticleStreams_H___
+#define ___C3D_ParticleStreams_H___
+
+#include "ParticleModule.hpp"
+
+#include "Castor3D/Scene/ParticleSystem/ParticleDeclaration.hpp"
+
+namespace castor3d
+{
+	class ParticleStreams
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	description	The particle's elements description.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	description	La description des éléments d'une particule.
+		 */
+		C3D_API explicit ParticleStreams( ParticleDeclaration const & description );
+		/**
+		 *\~english
+		 *\brief		Allocates the streams, and fills them with the default values.
+		 *\param[in]	capacity		The maximum particles count.
+		 *\param[in]	defaultValues	The default values, per element name.
+		 *\~french
+		 *\brief		Alloue les flux, et les remplit avec les valeurs par défaut.
+		 *\param[in]	capacity		Le nombre maximal de particules.
+		 *\param[in]	defaultValues	Les valeurs par défaut, par nom d'élément.
+		 */
+		C3D_API void initialise( uint32_t capacity
+			, castor::StrStrMap const & defaultValues );
+		/**
+		 *\~english
+		 *\brief		Releases the streams.
+		 *\~french
+		 *\brief		Libère les flux.
+		 */
+		C3D_API void cleanup();
+		/**
+		 *\~english
+		 *\brief		Scatters a particle's values into the streams.
+		 *\param[in]	index		The particle index.
+		 *\param[in]	particle	The particle.
+		 *\~french
+		 *\brief		Disperse les valeurs d'une particule dans les flux.
+		 *\param[in]	index		L'indice de la particule.
+		 *\param[in]	particle	La particule.
+		 */
+		C3D_API void set( uint32_t index
+			, Particle const & particle );
+		/**
+		 *\~english
+		 *\brief		Copies a particle's values over another one's.
+		 *\param[in]	dst, src	The destination and source particle indices.
+		 *\~french
+		 *\brief		Copie les valeurs d'une particule sur celles d'une autre.
+		 *\param[in]	dst, src	Les indices des particules destination et source.
+		 */
+		C3D_API void copy( uint32_t dst
+			, uint32_t src );
+		/**
+		 *\~english
+		 *\brief		Interleaves the first particles values, as described by the declaration offsets.
+		 *\param[in]	count	The particles count.
+		 *\param[out]	dst		Receives the interleaved values, \p count times the declaration stride.
+		 *\~french
+		 *\brief		Entrelace les valeurs des premières particules, tel que décrit par les offsets de la déclaration.
+		 *\param[in]	count	Le nombre de particules.
+		 *\param[out]	dst		Reçoit les valeurs entrelacées, \p count fois le stride de la déclaration.
+		 */
+		C3D_API void interleave( uint32_t count
+			, uint8_t * dst )const;
+		/**
+		 *\~english
+		 *\brief		Retrieves an element's stream.
+		 *\remarks		The stream holds the element's components contiguously, for all the particles.
+		 *\param[in]	element	The element, from the declaration.
+		 *\return		The stream's first component.
+		 *\~french
+		 *\brief		Récupère le flux d'un élément.
+		 *\remarks		Le flux contient les composantes de l'élément de manière contiguë, pour toutes les particules.
+		 *\param[in]	element	L'élément, de la déclaration.
+		 *\return		La première composante du flux.
+		 */
+		template< typename ComponentT >
+		ComponentT * getStream( ParticleElementDeclaration const & element )
+		{
+			return reinterpret_cast< ComponentT * >( m_data.data() + size_t( element.m_offset ) * m_capacity );
+		}
+
+		template< typename ComponentT >
+		ComponentT const * getStream( ParticleElementDeclaration const & element )const
+		{
+			return reinterpret_cast< ComponentT const * >( m_data.data() + size_t( element.m_offset ) * m_capacity );
+		}
+
+		uint32_t getCapacity()const
+		{
+			return m_capacity;
+		}
+
+	private:
+		ParticleDeclaration const & m_description;
+		uint32_t m_capacity{ 0u };
+		// One stream per element, each one starting at the element's offset times the capacity.
+		std::vector< uint8_t > m_data;
+	};
+}
+
+#endif
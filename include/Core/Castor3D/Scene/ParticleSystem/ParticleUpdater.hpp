@@ -17,16 +17,19 @@ namespace castor3d
 		C3D_API virtual ~ParticleUpdater() = default;
 		/**
 		 *\~english
-		 *\brief		Updates a particle.
+		 *\brief		Updates the first particles.
 		 *\param[in]	time		The time elapsed since last update.
-		 *\param[in]	particle	The particle.
+		 *\param[in]	particles	The particles streams.
+		 *\param[in]	count		The number of particles to update.
 		 *\~french
-		 *\brief		Met à jour une particle.
+		 *\brief		Met à jour les premières particules.
 		 *\param[in]	time		Le temps écoulé depuis la denière mise à jour.
-		 *\param[in]	particle	La particule.
+		 *\param[in]	particles	Les flux des particules.
+		 *\param[in]	count		Le nombre de particules à mettre à jour.
 		 */
 		C3D_API virtual void update( castor::Milliseconds const & time
-			, Particle & particle );
+			, ParticleStreams & particles
+			, uint32_t count );
 
 	protected:
 		ParticleSystem const & m_system;
@@ -80,11 +80,34 @@ namespace castor3d
 		{
 			m_receivesShadows = value;
 		}
+		/**
+		 *\~english
+		 *\return		The occluder status, used by the occlusion culling.
+		 *\~french
+		 *\return		Le statut d'occultant, utilisé par l'occlusion culling.
+		 */
+		bool isOccluder()const
+		{
+			return m_occluder;
+		}
+		/**
+		 *\~english
+		 *\brief		Defines the occluder status.
+		 *\param[in]	value	The new value.
+		 *\~french
+		 *\brief		Définit le statut d'occultant.
+		 *\param[in]	value	La nouvelle valeur.
+		 */
+		void setOccluder( bool value )
+		{
+			m_occluder = value;
+		}
 
 	private:
 		bool m_visible{ true };
 		bool m_castsShadows{ true };
 		bool m_receivesShadows{ true };
+		bool m_occluder{ false };
 	};
 }
 
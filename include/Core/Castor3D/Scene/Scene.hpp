@@ -22,13 +22,17 @@ See LICENSE file in root folder
 #include <CastorUtils/Data/TextWriter.hpp>
 #include <CastorUtils/Design/Named.hpp>
 #include <CastorUtils/Design/Signal.hpp>
+#include <CastorUtils/Graphics/DynamicBvh.hpp>
 #include <CastorUtils/Graphics/RgbColour.hpp>
 #include <CastorUtils/Log/Logger.hpp>
-#include <CastorUtils/Multithreading/ThreadPool.hpp>
+#include <CastorUtils/Math/TransformHierarchy.hpp>
 
 #include <RenderGraph/FrameGraphPrerequisites.hpp>
 
 #include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace castor3d
 {
@@ -116,6 +120,55 @@ namespace castor3d
 		 *\param[in]	scene	La scène à intégrer
 		 */
 		C3D_API void merge( SceneSPtr scene );
+		/**
+		 *\~english
+		 *\brief		Tells the scene the objects attached to given node have moved.
+		 *\remarks		Their bounds are updated in the geometries BVH during the next CPU update.
+		 *\param[in]	node	The scene node.
+		 *\~french
+		 *\brief		Dit à la scène que les objets attachés au noeud donné ont bougé.
+		 *\remarks		Leurs volumes englobants sont mis à jour dans la BVH des géométries lors de la prochaine mise à jour CPU.
+		 *\param[in]	node	Le noeud de scène.
+		 */
+		C3D_API void markNodeDirty( SceneNode const & node );
+		/**
+		 *\~english
+		 *\brief		Registers a scene node in the scene nodes transforms.
+		 *\param[in]	node	The scene node.
+		 *\return		The node's transform index.
+		 *\~french
+		 *\brief		Enregistre un noeud de scène dans les transformations des noeuds de la scène.
+		 *\param[in]	node	Le noeud de scène.
+		 *\return		L'indice de la transformation du noeud.
+		 */
+		C3D_API uint32_t addNodeTransform( SceneNode & node );
+		/**
+		 *\~english
+		 *\brief		Unregisters a scene node from the scene nodes transforms.
+		 *\param[in]	node	The scene node.
+		 *\~french
+		 *\brief		Désenregistre un noeud de scène des transformations des noeuds de la scène.
+		 *\param[in]	node	Le noeud de scène.
+		 */
+		C3D_API void removeNodeTransform( SceneNode & node );
+		/**
+		 *\~english
+		 *\brief		Tells the scene the local transformations or the parent of given node have changed.
+		 *\remarks		They are applied during the next nodes transforms update.
+		 *\param[in]	node	The scene node.
+		 *\~french
+		 *\brief		Dit à la scène que les transformations locales ou le parent du noeud donné ont changé.
+		 *\remarks		Ils sont appliqués lors de la prochaine mise à jour des transformations des noeuds.
+		 *\param[in]	node	Le noeud de scène.
+		 */
+		C3D_API void markNodeTransformDirty( SceneNode & node );
+		/**
+		 *\~english
+		 *\brief		Applies the pending nodes changes, and propagates the world transformations to the descendants of the changed nodes.
+		 *\~french
+		 *\brief		Applique les changements de noeuds en attente, et propage les transformations monde aux descendants des noeuds changés.
+		 */
+		C3D_API void updateNodeTransforms();
 		/**
 		 *\~english
 		 *\brief		Retrieves the vertices count
@@ -228,6 +281,16 @@ namespace castor3d
 			return m_boundingBox;
 		}
 
+		castor::DynamicBvh const & getGeometryBvh()const
+		{
+			return m_geometryBvh;
+		}
+
+		std::vector< Geometry * > const & getMovedGeometries()const
+		{
+			return m_movedGeometries;
+		}
+
 		SceneBackgroundSPtr getBackground()const
 		{
 			return m_background;
@@ -361,7 +424,8 @@ namespace castor3d
 		/**@}*/
 
 	private:
-		void doUpdateBoundingBox();
+		void doRebuildBvh();
+		void doUpdateBvh();
 		void doUpdateAnimations( CpuUpdater & updater );
 		void doUpdateMaterials();
 		bool doUpdateLightDependent( LightType lightType
@@ -380,6 +444,11 @@ namespace castor3d
 
 	private:
 		bool m_initialised{ false };
+		// The nodes transforms, sorted by depth, the user data are the SceneNode pointers.
+		// Declared before the nodes, which unregister from it on destruction.
+		std::mutex m_nodeTransformsMutex;
+		castor::TransformHierarchy m_nodeTransforms;
+		std::unordered_set< SceneNode * > m_dirtyNodeTransforms;
 		SceneNodeSPtr m_rootNode;
 		SceneNodeSPtr m_rootCameraNode;
 		SceneNodeSPtr m_rootObjectNode;
@@ -403,7 +472,6 @@ namespace castor3d
 		Fog m_fog;
 		FrameListenerWPtr m_listener;
 		std::unique_ptr< EnvironmentMap > m_reflectionMap;
-		castor::ThreadPool m_animationUpdater;
 		bool m_needsSubsurfaceScattering{ false };
 		bool m_hasOpaqueObjects{ false };
 		bool m_hasTransparentObjects{ false };
@@ -411,6 +479,18 @@ namespace castor3d
 		bool m_dirtyMaterials{ true };
 		uint32_t m_directionalShadowCascades{ ShadowMapDirectionalTileCountX * ShadowMapDirectionalTileCountY };
 		castor::BoundingBox m_boundingBox;
+		// The geometries world space bounds, the user data are the Geometry pointers.
+		castor::DynamicBvh m_geometryBvh;
+		std::unordered_map< Geometry const *, uint32_t > m_geometryProxies;
+		std::atomic_bool m_bvhDirty{ true };
+		std::mutex m_dirtyNodesMutex;
+		std::unordered_set< SceneNode const * > m_dirtyNodes;
+		std::unordered_set< Geometry const * > m_removedGeometries;
+		OnCacheElementConnectionT< Geometry > m_onGeometryAdded;
+		OnCacheElementConnectionT< Geometry > m_onGeometryRemoved;
+		OnCacheElementConnectionT< SceneNode > m_onSceneNodeRemoved;
+		// The geometries which bounds have been updated during the last CPU update.
+		std::vector< Geometry * > m_movedGeometries;
 		std::atomic_bool m_needsGlobalIllumination;
 		std::array< std::atomic_bool, size_t( LightType::eCount ) > m_hasShadows;
 		std::array< std::set< GlobalIlluminationType >, size_t( LightType::eCount ) > m_giTypes;
@@ -21,6 +21,7 @@ namespace castor3d
 	CU_DeclareAttributeParser( parserRootMaterials )
 	CU_DeclareAttributeParser( parserInclude )
 	CU_DeclareAttributeParser( parserRootLpvGridSize )
+	CU_DeclareAttributeParser( parserRootFramesInFlight )
 
 	//Window parsers
 	CU_DeclareAttributeParser( parserWindowRenderTarget )
@@ -36,6 +37,7 @@ namespace castor3d
 	CU_DeclareAttributeParser( parserRenderTargetPostEffect )
 	CU_DeclareAttributeParser( parserRenderTargetToneMapping )
 	CU_DeclareAttributeParser( parserRenderTargetSsao )
+	CU_DeclareAttributeParser( parserRenderTargetOcclusionCulling )
 	CU_DeclareAttributeParser( parserRenderTargetEnd )
 
 	// Sampler parsers
@@ -150,6 +152,7 @@ namespace castor3d
 	CU_DeclareAttributeParser( parserObjectMaterials )
 	CU_DeclareAttributeParser( parserObjectCastShadows )
 	CU_DeclareAttributeParser( parserObjectReceivesShadows )
+	CU_DeclareAttributeParser( parserObjectOccluder )
 	CU_DeclareAttributeParser( parserObjectEnd )
 
 	// Object Materials Parsers
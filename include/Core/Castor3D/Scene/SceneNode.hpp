@@ -11,6 +11,8 @@ See LICENSE file in root folder
 #include <CastorUtils/Math/Quaternion.hpp>
 #include <CastorUtils/Math/SquareMatrix.hpp>
 
+#include <atomic>
+
 namespace castor3d
 {
 	class SceneNode
@@ -18,6 +20,8 @@ namespace castor3d
 		, public castor::OwnedBy< Scene >
 		, public castor::Named
 	{
+		friend class Scene;
+
 	public:
 		//!\~english	The total number of scene nodes.
 		//!\~french		Le nombre total de noeuds de scène.
@@ -69,8 +73,10 @@ namespace castor3d
 		/**
 		 *\~english
 		 *\brief		Updates the scene node matrices.
+		 *\remarks		The matrices are held in the scene's nodes transforms, this updates all the scene's changed nodes.
 		 *\~french
 		 *\brief		Met à jour les matrices du noeud.
+		 *\remarks		Les matrices sont stockées dans les transformations des noeuds de la scène, ceci met à jour tous les noeuds changés de la scène.
 		 */
 		C3D_API void update();
 		/**
@@ -239,7 +245,7 @@ namespace castor3d
 		 *\brief		Récupère la position absolue
 		 *\return		La valeur
 		 */
-		C3D_API castor::Point3f getDerivedPosition()const;
+		C3D_API castor::Point3f const & getDerivedPosition()const;
 		/**
 		 *\~english
 		 *\brief		Retrieves the absolute orientation
@@ -248,7 +254,7 @@ namespace castor3d
 		 *\brief		Récupère l'orientation absolue
 		 *\return		La valeur
 		 */
-		C3D_API castor::Quaternion getDerivedOrientation()const;
+		C3D_API castor::Quaternion const & getDerivedOrientation()const;
 		/**
 		 *\~english
 		 *\brief		Retrieves the absolute scale
@@ -257,7 +263,7 @@ namespace castor3d
 		 *\brief		Récupère l'échelle absolue
 		 *\return		La valeur
 		 */
-		C3D_API castor::Point3f getDerivedScale()const;
+		C3D_API castor::Point3f const & getDerivedScale()const;
 		/**
 		 *\~english
 		 *\brief		Retrieves the relative transformation matrix
@@ -512,7 +518,7 @@ namespace castor3d
 		 */
 		bool isModified()const
 		{
-			return m_mtxChanged || m_derivedMtxChanged;
+			return m_mtxChanged;
 		}
 		/**
 		 *\~english
@@ -526,14 +532,15 @@ namespace castor3d
 		}
 
 	private:
-		void doComputeMatrix();
+		void doMarkDirty();
+		void doMarkTransformPending();
 		/**
 		 *\~english
-		 *\brief		Sets this node's children's absolute transformation matrix to be recalculated
+		 *\brief		Applies the scene's pending nodes transforms, if this node's or one of its ancestors' transformations haven't been applied yet.
 		 *\~french
-		 *\brief		Fait que la matrice de transfomation des enfants de ce noeud doit être recalculée
+		 *\brief		Applique les transformations de noeuds en attente de la scène, si les transformations de ce noeud ou de l'un de ses ancêtres n'ont pas encore été appliquées.
 		 */
-		void doUpdateChildsDerivedTransform();
+		void doFlushPendingTransform()const;
 
 	public:
 		//!\~english	Signal used to notify attached objects that the node has changed.
@@ -550,8 +557,14 @@ namespace castor3d
 		castor::Point3f m_scale{ 1.0, 1.0f, 1.0f };
 		castor::Matrix4x4f m_transform{ 1.0f };
 		bool m_mtxChanged{ true };
+		// Set on this node and its descendants when it moves, reset by the scene when their transforms are applied.
+		std::atomic_bool m_transformPending{ false };
+		// The world transformations, copied from the scene's nodes transforms.
 		castor::Matrix4x4f m_derivedTransform{ 1.0f };
-		bool m_derivedMtxChanged{ true };
+		castor::Point3f m_derivedPosition{ 0.0f, 0.0f, 0.0f };
+		castor::Quaternion m_derivedOrientation;
+		castor::Point3f m_derivedScale{ 1.0, 1.0f, 1.0f };
+		uint32_t m_transformIndex{};
 		SceneNode * m_parent{ nullptr };
 		SceneNodePtrStrMap m_children;
 		MovableObjectArray m_objects;
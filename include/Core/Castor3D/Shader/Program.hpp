@@ -109,6 +109,19 @@ namespace castor3d
 		 *\param[in]	shader	Le shader de la source.
 		 */
 		C3D_API void setSource( VkShaderStageFlagBits target, ShaderPtr shader );
+		/**
+		 *\~english
+		 *\brief		Sets the shader's already compiled SPIR-V (loaded from a cache, for instance).
+		 *\remarks		The shader module then has no source.
+		 *\param[in]	target	The shader object concerned.
+		 *\param[in]	shader	The compiled shader.
+		 *\~french
+		 *\brief		Définit le SPIR-V déjà compilé du shader (chargé depuis un cache, par exemple).
+		 *\remarks		Le module du shader n'a alors pas de source.
+		 *\param[in]	target	Le shader object concerné.
+		 *\param[in]	shader	Le shader compilé.
+		 */
+		C3D_API void setSource( VkShaderStageFlagBits target, SpirVShader shader );
 		/**
 		 *\~english
 		 *\brief		Retrieves the shader source.
@@ -131,6 +144,17 @@ namespace castor3d
 		 *\return		\p true si le shader a un code source.
 		 */
 		C3D_API bool hasSource( VkShaderStageFlagBits target )const;
+		/**
+		 *\~english
+		 *\brief		Retrieves the compiled shader.
+		 *\param[in]	target	The shader object concerned.
+		 *\return		The SPIR-V.
+		 *\~french
+		 *\brief		Récupère le shader compilé.
+		 *\param[in]	target	Le shader object concerné.
+		 *\return		Le SPIR-V.
+		 */
+		C3D_API SpirVShader const & getCompiled( VkShaderStageFlagBits target )const;
 		/**
 		*\~english
 		*name
@@ -160,6 +160,15 @@ namespace castor3d
 	/**
 	*\~english
 	*\brief
+	*	On disk cache of SPIR-V shader programs, indexed by a key.
+	*\~french
+	*\brief
+	*	Cache sur disque de programmes shader en SPIR-V, indexés par une clé.
+	*/
+	class SpirVCache;
+	/**
+	*\~english
+	*\brief
 	*	Wrapper class to select between SSBO or TBO.
 	*\remarks
 	*	Allows to user either one or the other in the same way.
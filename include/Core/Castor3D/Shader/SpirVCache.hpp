@@ -0,0 +1,86 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___C3D_SpirVCache_H___
+#define ___C3D_SpirVCache_H___
+
+#include "ShaderModule.hpp"
+
+#include <CastorUtils/Data/Path.hpp>
+
+namespace castor3d
+{
+	class SpirVCache
+	{
+	public:
+		using Stages = std::map< VkShaderStageFlagBits, castor::UInt32Array >;
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	folder	The cache folder, the cache is disabled if empty.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	folder	Le dossier du cache, le cache est désactivé s'il est vide.
+		 */
+		C3D_API explicit SpirVCache( castor::Path folder = {} );
+		/**
+		 *\~english
+		 *\brief		Loads a program's stages from the cache.
+		 *\remarks		The file is validated (format, engine version, key and checksum) before being used.
+		 *\param[in]	key		The program key.
+		 *\param[out]	stages	Receives the SPIR-V of each stage.
+		 *\return		\p false if the program is not in the cache, or if its file is invalid.
+		 *\~french
+		 *\brief		Charge les étapes d'un programme depuis le cache.
+		 *\remarks		Le fichier est validé (format, version du moteur, clé et checksum) avant d'être utilisé.
+		 *\param[in]	key		La clé du programme.
+		 *\param[out]	stages	Reçoit le SPIR-V de chaque étape.
+		 *\return		\p false si le programme n'est pas dans le cache, ou si son fichier est invalide.
+		 */
+		C3D_API bool load( uint64_t key
+			, Stages & stages )const;
+		/**
+		 *\~english
+		 *\brief		Saves a program's stages in the cache.
+		 *\param[in]	key		The program key.
+		 *\param[in]	stages	The SPIR-V of each stage.
+		 *\return		\p false if the file couldn't be written.
+		 *\~french
+		 *\brief		Sauvegarde les étapes d'un programme dans le cache.
+		 *\param[in]	key		La clé du programme.
+		 *\param[in]	stages	Le SPIR-V de chaque étape.
+		 *\return		\p false si le fichier n'a pas pu être écrit.
+		 */
+		C3D_API bool save( uint64_t key
+			, Stages const & stages )const;
+		/**
+		*\~english
+		*name
+		*	Getters.
+		*\~french
+		*name
+		*	Accesseurs.
+		**/
+		/**@{*/
+		bool isEnabled()const
+		{
+			return !m_folder.empty();
+		}
+
+		castor::Path const & getFolder()const
+		{
+			return m_folder;
+		}
+		/**@}*/
+
+	private:
+		castor::Path doGetFilePath( uint64_t key )const;
+
+	private:
+		castor::Path m_folder;
+	};
+}
+
+#endif
@@ -129,6 +129,13 @@ namespace castor
 	class LoaderException;
 	/**
 	\~english
+	\brief		Read only memory mapped file.
+	\~french
+	\brief		Fichier mappé en mémoire, en lecture seule.
+	*/
+	class MappedFile;
+	/**
+	\~english
 	\brief		Path management class
 	\remark		Defines platform dependant paths.
 	\~french
@@ -0,0 +1,70 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CASTOR_MAPPED_FILE_H___
+#define ___CASTOR_MAPPED_FILE_H___
+
+#include "CastorUtils/Data/DataModule.hpp"
+
+#include "CastorUtils/Data/Path.hpp"
+#include "CastorUtils/Design/NonCopyable.hpp"
+
+namespace castor
+{
+	class MappedFile
+		: public NonCopyable
+	{
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor, maps the whole file in read only mode.
+		 *\remarks		If the file can't be mapped, isMapped() returns \p false.
+		 *\param[in]	path	The file path.
+		 *\~french
+		 *\brief		Constructeur, mappe tout le fichier en lecture seule.
+		 *\remarks		Si le fichier ne peut pas être mappé, isMapped() retourne \p false.
+		 *\param[in]	path	Le chemin du fichier.
+		 */
+		CU_API explicit MappedFile( Path const & path );
+		/**
+		 *\~english
+		 *\brief		Destructor, unmaps the file.
+		 *\~french
+		 *\brief		Destructeur, démappe le fichier.
+		 */
+		CU_API ~MappedFile();
+		/**
+		*\~english
+		*name
+		*	Getters.
+		*\~french
+		*name
+		*	Accesseurs.
+		**/
+		/**@{*/
+		bool isMapped()const
+		{
+			return m_data != nullptr;
+		}
+
+		uint8_t const * getData()const
+		{
+			return m_data;
+		}
+
+		size_t getSize()const
+		{
+			return m_size;
+		}
+		/**@}*/
+
+	private:
+		uint8_t const * m_data{ nullptr };
+		size_t m_size{ 0u };
+		// Platform specific handles, unused on POSIX systems (the descriptor is closed once mapped).
+		void * m_file{ nullptr };
+		void * m_mapping{ nullptr };
+	};
+}
+
+#endif
@@ -48,6 +48,9 @@ namespace castor
 		inline bool none()const;
 		inline bool any()const;
 		inline bool all()const;
+		inline size_t count()const;
+		template< typename FuncT >
+		inline void forEachSet( FuncT func )const;
 		/**@}*/
 		/**
 		*\~english
@@ -1,6 +1,8 @@
 #include "CastorUtils/Design/DynamicBitset.hpp"
+#include "CastorUtils/Exception/Assertion.hpp"
 
 #include <algorithm>
+#include <bitset>
 #include <cstring>
 
 #pragma warning( push )
@@ -38,6 +40,12 @@ namespace castor
 		{
 			return getBlockIndex< BlockType >( index ) + ( getBitIndex< BlockType >( index ) ? 1u : 0u );
 		}
+
+		template< typename BlockType >
+		size_t getSetBitCount( BlockType block )
+		{
+			return std::bitset< DynamicBitsetT< BlockType >::bitsPerBlock >( block ).count();
+		}
 	}
 
 	//*************************************************************************
@@ -50,6 +58,7 @@ namespace castor
 
 	template< typename BlockType >
 	inline DynamicBitsetT< BlockType >::DynamicBitsetT( size_t size, bool value )
+		: m_bitCount{ 0u }
 	{
 		resize( size, value );
 	}
@@ -183,6 +192,39 @@ namespace castor
 		return result;
 	}
 
+	template< typename BlockType >
+	inline size_t DynamicBitsetT< BlockType >::count()const
+	{
+		size_t result = 0u;
+
+		for ( auto block : m_blocks )
+		{
+			result += details::getSetBitCount( block );
+		}
+
+		return result;
+	}
+
+	template< typename BlockType >
+	template< typename FuncT >
+	inline void DynamicBitsetT< BlockType >::forEachSet( FuncT func )const
+	{
+		size_t base = 0u;
+
+		for ( auto block : m_blocks )
+		{
+			// Empty blocks are skipped at once, set bits are extracted from the lowest one.
+			while ( block )
+			{
+				BlockType lowest = BlockType( block & BlockType( ~block + 1u ) );
+				func( base + details::getSetBitCount< BlockType >( BlockType( lowest - 1u ) ) );
+				block = BlockType( block ^ lowest );
+			}
+
+			base += bitsPerBlock;
+		}
+	}
+
 	template< typename BlockType >
 	inline typename DynamicBitsetT< BlockType >::Bit DynamicBitsetT< BlockType >::operator[]( size_t index )
 	{
@@ -376,7 +418,7 @@ namespace castor
 	template< typename BlockType >
 	inline DynamicBitsetT< BlockType > DynamicBitsetT< BlockType >::operator~()const
 	{
-		DynamicBitsetT result;
+		DynamicBitsetT result{ *this };
 
 		for ( auto & block : result.m_blocks )
 		{
@@ -0,0 +1,164 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_BoundingBoxArray_H___
+#define ___CU_BoundingBoxArray_H___
+
+#include "CastorUtils/Graphics/BoundingBox.hpp"
+#include "CastorUtils/Design/ArrayView.hpp"
+#include "CastorUtils/Math/PlaneEquation.hpp"
+
+#include <vector>
+
+namespace castor
+{
+	class BoundingBoxArray
+	{
+	public:
+		struct Range
+		{
+			uint32_t first;
+			uint32_t count;
+		};
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Removes all the boxes.
+		 *\~french
+		 *\brief		Supprime toutes les boîtes.
+		 */
+		CU_API void clear();
+		/**
+		 *\~english
+		 *\brief		Reserves memory for given boxes count.
+		 *\param[in]	count	The boxes count.
+		 *\~french
+		 *\brief		Réserve la mémoire pour le nombre de boîtes donné.
+		 *\param[in]	count	Le nombre de boîtes.
+		 */
+		CU_API void reserve( size_t count );
+		/**
+		 *\~english
+		 *\brief		Adds a box, transformed to world space.
+		 *\param[in]	box				The object space box.
+		 *\param[in]	transformations	The box transformations matrix.
+		 *\return		The box index.
+		 *\~french
+		 *\brief		Ajoute une boîte, transformée en espace monde.
+		 *\param[in]	box				La boîte en espace objet.
+		 *\param[in]	transformations	La matrice de transformations de la boîte.
+		 *\return		L'indice de la boîte.
+		 */
+		CU_API uint32_t add( BoundingBox const & box
+			, Matrix4x4f const & transformations );
+		/**
+		 *\~english
+		 *\brief		Updates a box, transformed to world space.
+		 *\param[in]	index			The box index.
+		 *\param[in]	box				The object space box.
+		 *\param[in]	transformations	The box transformations matrix.
+		 *\~french
+		 *\brief		Met à jour une boîte, transformée en espace monde.
+		 *\param[in]	index			L'indice de la boîte.
+		 *\param[in]	box				La boîte en espace objet.
+		 *\param[in]	transformations	La matrice de transformations de la boîte.
+		 */
+		CU_API void set( uint32_t index
+			, BoundingBox const & box
+			, Matrix4x4f const & transformations );
+		/**
+		 *\~english
+		 *\brief		Tests all the boxes against given planes, 4 boxes at once.
+		 *\remarks		A box is visible if it is not completely on the negative side of any of the planes.
+		 *\param[in]	planes	The planes.
+		 *\param[out]	visible	Receives, for each box, 1 if it is visible, 0 if not.
+		 *\~french
+		 *\brief		Teste toutes les boîtes contre les plans donnés, 4 boîtes à la fois.
+		 *\remarks		Une boîte est visible si elle n'est pas complètement du côté négatif d'un des plans.
+		 *\param[in]	planes	Les plans.
+		 *\param[out]	visible	Reçoit, pour chaque boîte, 1 si elle est visible, 0 sinon.
+		 */
+		CU_API void cull( ArrayView< PlaneEquation const > planes
+			, std::vector< uint8_t > & visible )const;
+		/**
+		 *\~english
+		 *\brief		Tests the boxes in the given ranges against given planes, 4 boxes at once.
+		 *\param[in]	planes	The planes.
+		 *\param[in]	ranges	The boxes ranges.
+		 *\param[out]	visible	Receives, for each box, 1 if it is in a range and visible, 0 if not.
+		 *\~french
+		 *\brief		Teste les boîtes des intervalles donnés contre les plans donnés, 4 boîtes à la fois.
+		 *\param[in]	planes	Les plans.
+		 *\param[in]	ranges	Les intervalles de boîtes.
+		 *\param[out]	visible	Reçoit, pour chaque boîte, 1 si elle est dans un intervalle et visible, 0 sinon.
+		 */
+		CU_API void cull( ArrayView< PlaneEquation const > planes
+			, ArrayView< Range const > ranges
+			, std::vector< uint8_t > & visible )const;
+		/**
+		 *\~english
+		 *\brief		Tests one box against given planes, without SIMD.
+		 *\param[in]	index	The box index.
+		 *\param[in]	planes	The planes.
+		 *\return		\p true if the box is visible.
+		 *\~french
+		 *\brief		Teste une boîte contre les plans donnés, sans SIMD.
+		 *\param[in]	index	L'indice de la boîte.
+		 *\param[in]	planes	Les plans.
+		 *\return		\p true si la boîte est visible.
+		 */
+		CU_API bool isVisible( uint32_t index
+			, ArrayView< PlaneEquation const > planes )const;
+		/**
+		 *\~english
+		 *\param[in]	index	The box index.
+		 *\return		The world space box.
+		 *\~french
+		 *\param[in]	index	L'indice de la boîte.
+		 *\return		La boîte en espace monde.
+		 */
+		CU_API BoundingBox getBoundingBox( uint32_t index )const;
+		/**
+		 *\~english
+		 *\return		The boxes count.
+		 *\~french
+		 *\return		Le nombre de boîtes.
+		 */
+		uint32_t size()const
+		{
+			return m_count;
+		}
+		/**
+		 *\~english
+		 *\return		\p true if there is no box.
+		 *\~french
+		 *\return		\p true s'il n'y a aucune boîte.
+		 */
+		bool empty()const
+		{
+			return m_count == 0u;
+		}
+
+	private:
+		struct SimdPlane;
+
+		static std::vector< SimdPlane > doGetSimdPlanes( ArrayView< PlaneEquation const > planes );
+		uint32_t doCullBatch( std::vector< SimdPlane > const & planes
+			, uint32_t index )const;
+		void doResize( uint32_t count );
+
+	private:
+		uint32_t m_count{ 0u };
+		// Boxes centers and half extents, one array per component.
+		// The arrays are padded to a multiple of 4, with empty boxes.
+		std::vector< float > m_centerX;
+		std::vector< float > m_centerY;
+		std::vector< float > m_centerZ;
+		std::vector< float > m_extentX;
+		std::vector< float > m_extentY;
+		std::vector< float > m_extentZ;
+	};
+}
+
+#endif
@@ -0,0 +1,233 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_DynamicBvh_H___
+#define ___CU_DynamicBvh_H___
+
+#include "CastorUtils/Graphics/BoundingBox.hpp"
+#include "CastorUtils/Design/ArrayView.hpp"
+#include "CastorUtils/Math/PlaneEquation.hpp"
+
+#include <vector>
+
+namespace castor
+{
+	class DynamicBvh
+	{
+	public:
+		static uint32_t constexpr InvalidProxy = ~0u;
+
+	private:
+		struct Node
+		{
+			bool isLeaf()const
+			{
+				return left == InvalidProxy;
+			}
+
+			Point3f min;
+			Point3f max;
+			// Parent index for allocated nodes, next free node index for free ones.
+			uint32_t parent{ InvalidProxy };
+			uint32_t left{ InvalidProxy };
+			uint32_t right{ InvalidProxy };
+			// Leaves have height 0, free nodes -1.
+			int32_t height{ -1 };
+			void * data{ nullptr };
+		};
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Removes all the objects.
+		 *\~french
+		 *\brief		Supprime tous les objets.
+		 */
+		CU_API void clear();
+		/**
+		 *\~english
+		 *\brief		Inserts an object.
+		 *\param[in]	box		The object's world space bounding box.
+		 *\param[in]	data	The object's user data.
+		 *\return		The object's proxy, to use in update and remove.
+		 *\~french
+		 *\brief		Insère un objet.
+		 *\param[in]	box		La bounding box de l'objet, en espace monde.
+		 *\param[in]	data	Les données utilisateur de l'objet.
+		 *\return		Le proxy de l'objet, à utiliser dans update et remove.
+		 */
+		CU_API uint32_t insert( BoundingBox const & box
+			, void * data );
+		/**
+		 *\~english
+		 *\brief		Removes an object.
+		 *\param[in]	proxy	The object's proxy.
+		 *\~french
+		 *\brief		Retire un objet.
+		 *\param[in]	proxy	Le proxy de l'objet.
+		 */
+		CU_API void remove( uint32_t proxy );
+		/**
+		 *\~english
+		 *\brief		Updates an object's bounding box.
+		 *\remarks		If the new box still overlaps the old one, the object's ancestors are refitted,
+		 *				otherwise the object is reinserted, to keep the hierarchy efficient.
+		 *\param[in]	proxy	The object's proxy.
+		 *\param[in]	box		The object's new world space bounding box.
+		 *\~french
+		 *\brief		Met à jour la bounding box d'un objet.
+		 *\remarks		Si la nouvelle boîte chevauche toujours l'ancienne, les ancêtres de l'objet sont réajustés,
+		 *				sinon l'objet est réinséré, pour garder la hiérarchie efficace.
+		 *\param[in]	proxy	Le proxy de l'objet.
+		 *\param[in]	box		La nouvelle bounding box de l'objet, en espace monde.
+		 */
+		CU_API void update( uint32_t proxy
+			, BoundingBox const & box );
+		/**
+		 *\~english
+		 *\brief		Checks the hierarchy's consistency (parents, heights and boxes).
+		 *\return		\p true if the hierarchy is consistent.
+		 *\~french
+		 *\brief		Vérifie la cohérence de la hiérarchie (parents, hauteurs et boîtes).
+		 *\return		\p true si la hiérarchie est cohérente.
+		 */
+		CU_API bool validate()const;
+		/**
+		 *\~english
+		 *\brief		Calls the given function for each object whose box intersects the given one.
+		 *\param[in]	box		The box.
+		 *\param[in]	func	The function, receives the object's user data.
+		 *\~french
+		 *\brief		Appelle la fonction donnée pour chaque objet dont la boîte intersecte celle donnée.
+		 *\param[in]	box		La boîte.
+		 *\param[in]	func	La fonction, reçoit les données utilisateur de l'objet.
+		 */
+		template< typename FuncT >
+		void query( BoundingBox const & box
+			, FuncT func )const;
+		/**
+		 *\~english
+		 *\brief		Calls the given function for each object whose box is not completely on the negative side of any of the planes.
+		 *\remarks		Subtrees completely on the positive side of all the planes are reported without further tests.
+		 *\param[in]	planes	The planes.
+		 *\param[in]	func	The function, receives the object's user data.
+		 *\~french
+		 *\brief		Appelle la fonction donnée pour chaque objet dont la boîte n'est complètement du côté négatif d'aucun des plans.
+		 *\remarks		Les sous-arbres complètement du côté positif de tous les plans sont reportés sans autre test.
+		 *\param[in]	planes	Les plans.
+		 *\param[in]	func	La fonction, reçoit les données utilisateur de l'objet.
+		 */
+		template< typename FuncT >
+		void query( ArrayView< PlaneEquation const > planes
+			, FuncT func )const;
+		/**
+		 *\~english
+		 *\brief		Calls the given function for each object whose box is hit by the given ray.
+		 *\remarks		The function returns the new maximum distance, allowing to only look for nearer objects.
+		 *\param[in]	origin		The ray origin.
+		 *\param[in]	direction	The ray direction.
+		 *\param[in]	maxDistance	The maximum distance along the ray.
+		 *\param[in]	func		The function, receives the object's user data and the box hit distance.
+		 *\~french
+		 *\brief		Appelle la fonction donnée pour chaque objet dont la boîte est touchée par le rayon donné.
+		 *\remarks		La fonction retourne la nouvelle distance maximale, permettant de ne chercher que des objets plus proches.
+		 *\param[in]	origin		L'origine du rayon.
+		 *\param[in]	direction	La direction du rayon.
+		 *\param[in]	maxDistance	La distance maximale le long du rayon.
+		 *\param[in]	func		La fonction, reçoit les données utilisateur de l'objet et la distance d'impact de la boîte.
+		 */
+		template< typename FuncT >
+		void raycast( Point3f const & origin
+			, Point3f const & direction
+			, float maxDistance
+			, FuncT func )const;
+		/**
+		 *\~english
+		 *\return		\p true if there is no object.
+		 *\~french
+		 *\return		\p true s'il n'y a aucun objet.
+		 */
+		bool empty()const
+		{
+			return m_root == InvalidProxy;
+		}
+		/**
+		 *\~english
+		 *\return		The objects count.
+		 *\~french
+		 *\return		Le nombre d'objets.
+		 */
+		uint32_t size()const
+		{
+			return m_count;
+		}
+		/**
+		 *\~english
+		 *\return		The hierarchy height.
+		 *\~french
+		 *\return		La hauteur de la hiérarchie.
+		 */
+		uint32_t getHeight()const
+		{
+			return empty()
+				? 0u
+				: uint32_t( m_nodes[m_root].height );
+		}
+		/**
+		 *\~english
+		 *\return		The box containing all the objects.
+		 *\~french
+		 *\return		La boîte contenant tous les objets.
+		 */
+		BoundingBox getBoundingBox()const
+		{
+			return empty()
+				? BoundingBox{}
+				: BoundingBox{ m_nodes[m_root].min, m_nodes[m_root].max };
+		}
+		/**
+		 *\~english
+		 *\param[in]	proxy	The object's proxy.
+		 *\return		The object's bounding box.
+		 *\~french
+		 *\param[in]	proxy	Le proxy de l'objet.
+		 *\return		La bounding box de l'objet.
+		 */
+		BoundingBox getBoundingBox( uint32_t proxy )const
+		{
+			return BoundingBox{ m_nodes[proxy].min, m_nodes[proxy].max };
+		}
+		/**
+		 *\~english
+		 *\param[in]	proxy	The object's proxy.
+		 *\return		The object's user data.
+		 *\~french
+		 *\param[in]	proxy	Le proxy de l'objet.
+		 *\return		Les données utilisateur de l'objet.
+		 */
+		void * getData( uint32_t proxy )const
+		{
+			return m_nodes[proxy].data;
+		}
+
+	private:
+		uint32_t doAllocateNode();
+		void doFreeNode( uint32_t index );
+		void doInsertLeaf( uint32_t leaf );
+		void doRemoveLeaf( uint32_t leaf );
+		void doRefit( uint32_t index );
+		uint32_t doBalance( uint32_t index );
+		void doFitNode( uint32_t index );
+		bool doValidate( uint32_t index )const;
+
+	private:
+		std::vector< Node > m_nodes;
+		uint32_t m_root{ InvalidProxy };
+		uint32_t m_freeList{ InvalidProxy };
+		uint32_t m_count{ 0u };
+	};
+}
+
+#include "DynamicBvh.inl"
+
+#endif
@@ -0,0 +1,155 @@
+#include <cmath>
+
+namespace castor
+{
+	template< typename FuncT >
+	void DynamicBvh::query( BoundingBox const & box
+		, FuncT func )const
+	{
+		if ( empty() )
+		{
+			return;
+		}
+
+		auto min = box.getMin();
+		auto max = box.getMax();
+		std::vector< uint32_t > stack;
+		stack.push_back( m_root );
+
+		while ( !stack.empty() )
+		{
+			auto & node = m_nodes[stack.back()];
+			stack.pop_back();
+
+			if ( node.min[0] <= max[0] && node.max[0] >= min[0]
+				&& node.min[1] <= max[1] && node.max[1] >= min[1]
+				&& node.min[2] <= max[2] && node.max[2] >= min[2] )
+			{
+				if ( node.isLeaf() )
+				{
+					func( node.data );
+				}
+				else
+				{
+					stack.push_back( node.left );
+					stack.push_back( node.right );
+				}
+			}
+		}
+	}
+
+	template< typename FuncT >
+	void DynamicBvh::query( ArrayView< PlaneEquation const > planes
+		, FuncT func )const
+	{
+		if ( empty() )
+		{
+			return;
+		}
+
+		// Each entry holds a node and whether its parent was completely inside the planes.
+		std::vector< std::pair< uint32_t, bool > > stack;
+		stack.emplace_back( m_root, false );
+
+		while ( !stack.empty() )
+		{
+			auto entry = stack.back();
+			stack.pop_back();
+			auto & node = m_nodes[entry.first];
+			bool inside = entry.second;
+
+			if ( !inside )
+			{
+				Point3f center{ ( node.min + node.max ) * 0.5f };
+				Point3f extent{ ( node.max - node.min ) * 0.5f };
+				bool outside = false;
+				inside = true;
+				auto it = planes.begin();
+
+				while ( !outside && it != planes.end() )
+				{
+					auto & normal = it->getNormal();
+					auto distance = it->distance( center );
+					auto radius = std::abs( normal[0] ) * extent[0]
+						+ std::abs( normal[1] ) * extent[1]
+						+ std::abs( normal[2] ) * extent[2];
+					outside = distance + radius < 0.0f;
+					inside = inside && distance - radius >= 0.0f;
+					++it;
+				}
+
+				if ( outside )
+				{
+					continue;
+				}
+			}
+
+			if ( node.isLeaf() )
+			{
+				func( node.data );
+			}
+			else
+			{
+				stack.emplace_back( node.left, inside );
+				stack.emplace_back( node.right, inside );
+			}
+		}
+	}
+
+	template< typename FuncT >
+	void DynamicBvh::raycast( Point3f const & origin
+		, Point3f const & direction
+		, float maxDistance
+		, FuncT func )const
+	{
+		if ( empty() )
+		{
+			return;
+		}
+
+		Point3f invDirection{ 1.0f / direction[0]
+			, 1.0f / direction[1]
+			, 1.0f / direction[2] };
+		// Slabs test, returns the entry distance, or a negative value if missed.
+		auto hit = [&origin, &invDirection]( Node const & node
+			, float maxDist )
+		{
+			float tmin = 0.0f;
+			float tmax = maxDist;
+
+			for ( uint32_t i = 0u; i < 3u; ++i )
+			{
+				auto t1 = ( node.min[i] - origin[i] ) * invDirection[i];
+				auto t2 = ( node.max[i] - origin[i] ) * invDirection[i];
+				tmin = std::max( tmin, std::min( t1, t2 ) );
+				tmax = std::min( tmax, std::max( t1, t2 ) );
+			}
+
+			return tmin <= tmax
+				? tmin
+				: -1.0f;
+		};
+		std::vector< uint32_t > stack;
+		stack.push_back( m_root );
+
+		while ( !stack.empty() )
+		{
+			auto & node = m_nodes[stack.back()];
+			stack.pop_back();
+			auto distance = hit( node, maxDistance );
+
+			if ( distance >= 0.0f )
+			{
+				if ( node.isLeaf() )
+				{
+					maxDistance = std::min( maxDistance, func( node.data, distance ) );
+				}
+				else
+				{
+					stack.push_back( node.left );
+					stack.push_back( node.right );
+				}
+			}
+		}
+	}
+}
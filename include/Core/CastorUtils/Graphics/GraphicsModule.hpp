@@ -219,6 +219,27 @@ namespace castor
 	class BoundingBox;
 	/**
 	\~english
+	\brief		World space axis aligned boxes, stored as structure of arrays, to be tested in batches against planes.
+	\~french
+	\brief		Boîtes alignées sur les axes en espace monde, stockées en structure de tableaux, pour être testées en lots contre des plans.
+	*/
+	class BoundingBoxArray;
+	/**
+	\~english
+	\brief		Dynamic bounding volume hierarchy, over world space axis aligned boxes.
+	\~french
+	\brief		Hiérarchie dynamique de volumes englobants, sur des boîtes alignées sur les axes en espace monde.
+	*/
+	class DynamicBvh;
+	/**
+	\~english
+	\brief		Low resolution software depth buffer, with a depth hierarchy, used to test boxes against occluders.
+	\~french
+	\brief		Tampon de profondeur logiciel basse résolution, avec une hiérarchie de profondeur, utilisé pour tester des boîtes contre des occultants.
+	*/
+	class OcclusionBuffer;
+	/**
+	\~english
 	\brief		Sphere container class.
 	\~french
 	\brief		Classe de conteneur sphérique.
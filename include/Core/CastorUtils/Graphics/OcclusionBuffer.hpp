@@ -0,0 +1,144 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_OcclusionBuffer_H___
+#define ___CU_OcclusionBuffer_H___
+
+#include "CastorUtils/Graphics/BoundingBox.hpp"
+#include "CastorUtils/Design/ArrayView.hpp"
+#include "CastorUtils/Math/SquareMatrix.hpp"
+
+#include <vector>
+
+namespace castor
+{
+	class OcclusionBuffer
+	{
+	private:
+		// Level 0 holds the rasterised depths, each other level holds the farthest depth of 2x2 texels of the previous one.
+		struct Level
+		{
+			uint32_t width;
+			uint32_t height;
+			uint32_t stride;
+			std::vector< float > depths;
+		};
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	width, height	The buffer dimensions, in pixels.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	width, height	Les dimensions du tampon, en pixels.
+		 */
+		CU_API OcclusionBuffer( uint32_t width
+			, uint32_t height );
+		/**
+		 *\~english
+		 *\brief		Removes all the occluders.
+		 *\~french
+		 *\brief		Supprime tous les occultants.
+		 */
+		CU_API void clear();
+		/**
+		 *\~english
+		 *\brief		Rasterises an occluder's triangles, 4 pixels at once.
+		 *\remarks		Triangles crossing the near plane are ignored, so that the buffer stays conservative.
+		 *\param[in]	positions	The occluder's vertices positions.
+		 *\param[in]	indices		The occluder's triangles indices.
+		 *\param[in]	transform	The matrix transforming the positions to clip space.
+		 *\return		The rasterised triangles count.
+		 *\~french
+		 *\brief		Rastérise les triangles d'un occultant, 4 pixels à la fois.
+		 *\remarks		Les triangles traversant le plan proche sont ignorés, pour que le tampon reste conservatif.
+		 *\param[in]	positions	Les positions des sommets de l'occultant.
+		 *\param[in]	indices		Les indices des triangles de l'occultant.
+		 *\param[in]	transform	La matrice transformant les positions en espace de découpage.
+		 *\return		Le nombre de triangles rastérisés.
+		 */
+		CU_API uint32_t rasterise( ArrayView< Point3f const > positions
+			, ArrayView< uint32_t const > indices
+			, Matrix4x4f const & transform );
+		/**
+		 *\~english
+		 *\brief		Builds the depth hierarchy, to call once all the occluders are rasterised.
+		 *\~french
+		 *\brief		Construit la hiérarchie de profondeur, à appeler une fois tous les occultants rastérisés.
+		 */
+		CU_API void buildHierarchy();
+		/**
+		 *\~english
+		 *\brief		Tests a box against the occluders.
+		 *\remarks		The box's screen rectangle is tested against the hierarchy level where it covers at most 2x2 texels.
+		 *				Boxes crossing the near plane are always visible.
+		 *\param[in]	box			The box.
+		 *\param[in]	transform	The matrix transforming the box to clip space.
+		 *\return		\p false if the box is completely behind the occluders.
+		 *\~french
+		 *\brief		Teste une boîte contre les occultants.
+		 *\remarks		Le rectangle écran de la boîte est testé contre le niveau de la hiérarchie où il couvre au plus 2x2 texels.
+		 *				Les boîtes traversant le plan proche sont toujours visibles.
+		 *\param[in]	box			La boîte.
+		 *\param[in]	transform	La matrice transformant la boîte en espace de découpage.
+		 *\return		\p false si la boîte est complètement derrière les occultants.
+		 */
+		CU_API bool isVisible( BoundingBox const & box
+			, Matrix4x4f const & transform )const;
+		/**
+		 *\~english
+		 *\param[in]	x, y	The pixel coordinates.
+		 *\return		The rasterised depth, std::numeric_limits< float >::max() if there is no occluder.
+		 *\~french
+		 *\param[in]	x, y	Les coordonnées du pixel.
+		 *\return		La profondeur rastérisée, std::numeric_limits< float >::max() s'il n'y a pas d'occultant.
+		 */
+		float getDepth( uint32_t x
+			, uint32_t y )const
+		{
+			auto & level = m_levels.front();
+			return level.depths[y * level.stride + x];
+		}
+		/**
+		 *\~english
+		 *\return		The buffer width.
+		 *\~french
+		 *\return		La largeur du tampon.
+		 */
+		uint32_t getWidth()const
+		{
+			return m_levels.front().width;
+		}
+		/**
+		 *\~english
+		 *\return		The buffer height.
+		 *\~french
+		 *\return		La hauteur du tampon.
+		 */
+		uint32_t getHeight()const
+		{
+			return m_levels.front().height;
+		}
+		/**
+		 *\~english
+		 *\return		The depth hierarchy levels count.
+		 *\~french
+		 *\return		Le nombre de niveaux de la hiérarchie de profondeur.
+		 */
+		uint32_t getLevelCount()const
+		{
+			return uint32_t( m_levels.size() );
+		}
+
+	private:
+		void doRasteriseTriangle( Point3f const & a
+			, Point3f const & b
+			, Point3f const & c );
+
+	private:
+		std::vector< Level > m_levels;
+	};
+}
+
+#endif
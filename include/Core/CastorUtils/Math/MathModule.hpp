@@ -191,6 +191,13 @@ namespace castor
 	*/
 	template< typename T, uint32_t Count >
 	class SquareMatrix;
+	/**
+	\~english
+	\brief		Flat transforms hierarchy, sorted by depth.
+	\~french
+	\brief		Hiérarchie de transformations à plat, triée par profondeur.
+	*/
+	class TransformHierarchy;
 
 	template< typename T > using Point2 = Point< T, 2 >;
 	template< typename T > using Point3 = Point< T, 3 >;
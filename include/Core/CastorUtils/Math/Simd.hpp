@@ -6,9 +6,29 @@ See LICENSE file in root folder
 
 #include "CastorUtils/Math/MathModule.hpp"
 
-#	if CU_UseSSE2
+#if !defined( CU_UseSSE2 )
+#	if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#		define CU_UseSSE2 1
+#	else
+#		define CU_UseSSE2 0
+#	endif
+#endif
+
+#if !defined( CU_UseNEON )
+#	if !CU_UseSSE2 && ( defined( __ARM_NEON ) || defined( __ARM_NEON__ ) )
+#		define CU_UseNEON 1
+#	else
+#		define CU_UseNEON 0
+#	endif
+#endif
 
-#	include <xmmintrin.h>
+#if CU_UseSSE2
+#	include <emmintrin.h>
+#elif CU_UseNEON
+#	include <arm_neon.h>
+#else
+#	include <array>
+#endif
 
 namespace castor
 {
@@ -17,11 +37,22 @@ namespace castor
 	\date		06/10/2016
 	\~english
 	\brief		SIMD 4 floats abstraction.
+	\remarks	Uses SSE2 or NEON when available, and falls back to scalar code otherwise.
 	\~french
 	\brief		Abstraction de 4 floats SIMD.
+	\remarks	Utilise SSE2 ou NEON lorsque disponibles, et du code scalaire sinon.
 	*/
 	class Float4
 	{
+	private:
+#if CU_UseSSE2
+		using Native = __m128;
+#elif CU_UseNEON
+		using Native = float32x4_t;
+#else
+		using Native = std::array< float, 4u >;
+#endif
+
 	public:
 		/**
 		 *\~english
@@ -50,6 +81,37 @@ namespace castor
 		 *\param[out]	values	Un pointeur sur 4 flottants alignés sur 16 bits.
 		 */
 		inline void toPtr( float * values );
+		/**
+		 *\~english
+		 *\brief		Loads 4 floats from a pointer without alignment requirement.
+		 *\param[in]	values	A pointer to 4 floats.
+		 *\return		The loaded values.
+		 *\~french
+		 *\brief		Charge 4 floats depuis un pointeur, sans contrainte d'alignement.
+		 *\param[in]	values	Un pointeur sur 4 flottants.
+		 *\return		Les valeurs chargées.
+		 */
+		static inline Float4 loadUnaligned( float const * values );
+		/**
+		 *\~english
+		 *\brief		Puts the values into a pointer without alignment requirement.
+		 *\param[out]	values	A pointer to 4 floats.
+		 *\~french
+		 *\brief		Met les valeurs dans un pointeur, sans contrainte d'alignement.
+		 *\param[out]	values	Un pointeur sur 4 flottants.
+		 */
+		inline void storeUnaligned( float * values )const;
+		/**
+		 *\~english
+		 *\brief		Retrieves the sign bits of the 4 values.
+		 *\remarks		Used on comparison results, to know which lanes passed.
+		 *\return		The mask, bit i being set if value i is negative.
+		 *\~french
+		 *\brief		Récupère les bits de signe des 4 valeurs.
+		 *\remarks		Utilisée sur les résultats de comparaison, pour savoir quelles valeurs l'ont passée.
+		 *\return		Le masque, le bit i étant mis si la valeur i est négative.
+		 */
+		inline uint32_t getMask()const;
 		/**
 		 *\~english
 		 *\brief		addition assignment operator.
@@ -94,9 +156,28 @@ namespace castor
 		 *\return		Une référence sur cet objet.
 		 */
 		inline Float4 & operator/=( Float4 const & rhs );
+		/**
+		 *\~english
+		 *\brief		Bitwise OR assignment operator, used to combine comparison masks.
+		 *\param[in]	rhs	The right hand side operand.
+		 *\return		A reference to this object.
+		 *\~french
+		 *\brief		Opérateur d'affectation par OU binaire, utilisé pour combiner des masques de comparaison.
+		 *\param[in]	rhs	L'opérande de droite dans l'opération.
+		 *\return		Une référence sur cet objet.
+		 */
+		inline Float4 & operator|=( Float4 const & rhs );
+
+		friend inline Float4 lessThan( Float4 const & lhs, Float4 const & rhs );
+
+	private:
+		explicit Float4( Native value )
+			: m_value( value )
+		{
+		}
 
 	private:
-		__m128 m_value;
+		Native m_value;
 	};
 	/**
 	 *\~english
@@ -142,10 +223,31 @@ namespace castor
 	 *\return		Le résultat de la division.
 	 */
 	inline Float4 operator/( Float4 const & lhs, Float4 const & rhs );
+	/**
+	 *\~english
+	 *\brief		Bitwise OR operator, used to combine comparison masks.
+	 *\param[in]	lhs, rhs	The operands.
+	 *\return		The OR result.
+	 *\~french
+	 *\brief		Opérateur OU binaire, utilisé pour combiner des masques de comparaison.
+	 *\param[in]	lhs, rhs	Les opérandes.
+	 *\return		Le résultat du OU.
+	 */
+	inline Float4 operator|( Float4 const & lhs, Float4 const & rhs );
+	/**
+	 *\~english
+	 *\brief		Per value less than comparison.
+	 *\param[in]	lhs, rhs	The operands.
+	 *\return		A mask, with all bits of value i set if lhs[i] < rhs[i], 0 otherwise.
+	 *\~french
+	 *\brief		Comparaison inférieur à, par valeur.
+	 *\param[in]	lhs, rhs	Les opérandes.
+	 *\return		Un masque, avec tous les bits de la valeur i mis si lhs[i] < rhs[i], 0 sinon.
+	 */
+	inline Float4 lessThan( Float4 const & lhs, Float4 const & rhs );
 }
 
 #include "Simd.inl"
 
-#	endif
 #endif
 
@@ -1,5 +1,11 @@
+#if !CU_UseSSE2 && !CU_UseNEON
+#	include <cstring>
+#endif
+
 namespace castor
 {
+#if CU_UseSSE2
+
 	inline Float4::Float4( float const * p_values )
 		: m_value( _mm_load_ps( p_values ) )
 	{
@@ -15,6 +21,21 @@ namespace castor
 		_mm_store_ps( p_values, m_value );
 	}
 
+	inline Float4 Float4::loadUnaligned( float const * values )
+	{
+		return Float4{ _mm_loadu_ps( values ) };
+	}
+
+	inline void Float4::storeUnaligned( float * values )const
+	{
+		_mm_storeu_ps( values, m_value );
+	}
+
+	inline uint32_t Float4::getMask()const
+	{
+		return uint32_t( _mm_movemask_ps( m_value ) );
+	}
+
 	inline Float4 & Float4::operator+=( Float4 const & p_rhs )
 	{
 		m_value = _mm_add_ps( m_value, p_rhs.m_value );
@@ -39,6 +60,213 @@ namespace castor
 		return *this;
 	}
 
+	inline Float4 & Float4::operator|=( Float4 const & rhs )
+	{
+		m_value = _mm_or_ps( m_value, rhs.m_value );
+		return *this;
+	}
+
+	inline Float4 lessThan( Float4 const & lhs, Float4 const & rhs )
+	{
+		return Float4{ _mm_cmplt_ps( lhs.m_value, rhs.m_value ) };
+	}
+
+#elif CU_UseNEON
+
+	inline Float4::Float4( float const * p_values )
+		: m_value( vld1q_f32( p_values ) )
+	{
+	}
+
+	inline Float4::Float4( float p_value )
+		: m_value( vdupq_n_f32( p_value ) )
+	{
+	}
+
+	inline void Float4::toPtr( float * p_values )
+	{
+		vst1q_f32( p_values, m_value );
+	}
+
+	inline Float4 Float4::loadUnaligned( float const * values )
+	{
+		return Float4{ vld1q_f32( values ) };
+	}
+
+	inline void Float4::storeUnaligned( float * values )const
+	{
+		vst1q_f32( values, m_value );
+	}
+
+	inline uint32_t Float4::getMask()const
+	{
+		// NEON has no movemask, move each sign bit to its lane's position then add the lanes.
+		static int32_t const shifts[4]{ 0, 1, 2, 3 };
+		uint32x4_t bits = vshrq_n_u32( vreinterpretq_u32_f32( m_value ), 31 );
+		bits = vshlq_u32( bits, vld1q_s32( shifts ) );
+		return vgetq_lane_u32( bits, 0 )
+			| vgetq_lane_u32( bits, 1 )
+			| vgetq_lane_u32( bits, 2 )
+			| vgetq_lane_u32( bits, 3 );
+	}
+
+	inline Float4 & Float4::operator+=( Float4 const & p_rhs )
+	{
+		m_value = vaddq_f32( m_value, p_rhs.m_value );
+		return *this;
+	}
+
+	inline Float4 & Float4::operator-=( Float4 const & p_rhs )
+	{
+		m_value = vsubq_f32( m_value, p_rhs.m_value );
+		return *this;
+	}
+
+	inline Float4 & Float4::operator*=( Float4 const & p_rhs )
+	{
+		m_value = vmulq_f32( m_value, p_rhs.m_value );
+		return *this;
+	}
+
+	inline Float4 & Float4::operator/=( Float4 const & p_rhs )
+	{
+#	if defined( __aarch64__ ) || defined( _M_ARM64 )
+		m_value = vdivq_f32( m_value, p_rhs.m_value );
+#	else
+		// ARMv7 NEON has no division, use two Newton-Raphson steps on the reciprocal estimate.
+		float32x4_t inv = vrecpeq_f32( p_rhs.m_value );
+		inv = vmulq_f32( vrecpsq_f32( p_rhs.m_value, inv ), inv );
+		inv = vmulq_f32( vrecpsq_f32( p_rhs.m_value, inv ), inv );
+		m_value = vmulq_f32( m_value, inv );
+#	endif
+		return *this;
+	}
+
+	inline Float4 & Float4::operator|=( Float4 const & rhs )
+	{
+		m_value = vreinterpretq_f32_u32( vorrq_u32( vreinterpretq_u32_f32( m_value )
+			, vreinterpretq_u32_f32( rhs.m_value ) ) );
+		return *this;
+	}
+
+	inline Float4 lessThan( Float4 const & lhs, Float4 const & rhs )
+	{
+		return Float4{ vreinterpretq_f32_u32( vcltq_f32( lhs.m_value, rhs.m_value ) ) };
+	}
+
+#else
+
+	inline Float4::Float4( float const * p_values )
+		: m_value{ p_values[0], p_values[1], p_values[2], p_values[3] }
+	{
+	}
+
+	inline Float4::Float4( float p_value )
+		: m_value{ p_value, p_value, p_value, p_value }
+	{
+	}
+
+	inline void Float4::toPtr( float * p_values )
+	{
+		std::memcpy( p_values, m_value.data(), sizeof( m_value ) );
+	}
+
+	inline Float4 Float4::loadUnaligned( float const * values )
+	{
+		return Float4{ values };
+	}
+
+	inline void Float4::storeUnaligned( float * values )const
+	{
+		std::memcpy( values, m_value.data(), sizeof( m_value ) );
+	}
+
+	inline uint32_t Float4::getMask()const
+	{
+		uint32_t result{};
+
+		for ( uint32_t i = 0u; i < 4u; ++i )
+		{
+			uint32_t bits;
+			std::memcpy( &bits, &m_value[i], sizeof( bits ) );
+			result |= ( bits >> 31u ) << i;
+		}
+
+		return result;
+	}
+
+	inline Float4 & Float4::operator+=( Float4 const & p_rhs )
+	{
+		for ( size_t i = 0u; i < 4u; ++i )
+		{
+			m_value[i] += p_rhs.m_value[i];
+		}
+
+		return *this;
+	}
+
+	inline Float4 & Float4::operator-=( Float4 const & p_rhs )
+	{
+		for ( size_t i = 0u; i < 4u; ++i )
+		{
+			m_value[i] -= p_rhs.m_value[i];
+		}
+
+		return *this;
+	}
+
+	inline Float4 & Float4::operator*=( Float4 const & p_rhs )
+	{
+		for ( size_t i = 0u; i < 4u; ++i )
+		{
+			m_value[i] *= p_rhs.m_value[i];
+		}
+
+		return *this;
+	}
+
+	inline Float4 & Float4::operator/=( Float4 const & p_rhs )
+	{
+		for ( size_t i = 0u; i < 4u; ++i )
+		{
+			m_value[i] /= p_rhs.m_value[i];
+		}
+
+		return *this;
+	}
+
+	inline Float4 & Float4::operator|=( Float4 const & rhs )
+	{
+		for ( size_t i = 0u; i < 4u; ++i )
+		{
+			uint32_t lhsBits;
+			uint32_t rhsBits;
+			std::memcpy( &lhsBits, &m_value[i], sizeof( lhsBits ) );
+			std::memcpy( &rhsBits, &rhs.m_value[i], sizeof( rhsBits ) );
+			lhsBits |= rhsBits;
+			std::memcpy( &m_value[i], &lhsBits, sizeof( lhsBits ) );
+		}
+
+		return *this;
+	}
+
+	inline Float4 lessThan( Float4 const & lhs, Float4 const & rhs )
+	{
+		Float4::Native result;
+
+		for ( size_t i = 0u; i < 4u; ++i )
+		{
+			uint32_t bits = lhs.m_value[i] < rhs.m_value[i]
+				? 0xFFFFFFFFu
+				: 0u;
+			std::memcpy( &result[i], &bits, sizeof( bits ) );
+		}
+
+		return Float4{ result };
+	}
+
+#endif
+
 	inline Float4 operator+( Float4 const & p_lhs, Float4 const & p_rhs )
 	{
 		Float4 lhs{ p_lhs };
@@ -62,4 +290,10 @@ namespace castor
 		Float4 lhs{ p_lhs };
 		return lhs /= p_rhs;
 	}
+
+	inline Float4 operator|( Float4 const & lhs, Float4 const & rhs )
+	{
+		Float4 result{ lhs };
+		return result |= rhs;
+	}
 }
@@ -0,0 +1,211 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_TransformHierarchy_H___
+#define ___CU_TransformHierarchy_H___
+
+#include "CastorUtils/Design/ArrayView.hpp"
+#include "CastorUtils/Math/Quaternion.hpp"
+#include "CastorUtils/Math/SquareMatrix.hpp"
+
+#include <vector>
+
+namespace castor
+{
+	class TransformHierarchy
+	{
+	public:
+		static uint32_t constexpr InvalidIndex = ~0u;
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Removes all the transforms.
+		 *\~french
+		 *\brief		Supprime toutes les transformations.
+		 */
+		CU_API void clear();
+		/**
+		 *\~english
+		 *\brief		Adds a root transform, with identity local transformations.
+		 *\param[in]	data	The transform's user data.
+		 *\return		The transform index, stable until its removal.
+		 *\~french
+		 *\brief		Ajoute une transformation racine, avec des transformations locales identité.
+		 *\param[in]	data	Les données utilisateur de la transformation.
+		 *\return		L'indice de la transformation, stable jusqu'à sa suppression.
+		 */
+		CU_API uint32_t add( void * data );
+		/**
+		 *\~english
+		 *\brief		Removes a transform, its children become roots.
+		 *\param[in]	index	The transform index.
+		 *\~french
+		 *\brief		Supprime une transformation, ses enfants deviennent des racines.
+		 *\param[in]	index	L'indice de la transformation.
+		 */
+		CU_API void remove( uint32_t index );
+		/**
+		 *\~english
+		 *\brief		Defines a transform's parent.
+		 *\param[in]	index	The transform index.
+		 *\param[in]	parent	The parent index, InvalidIndex to make it a root.
+		 *\~french
+		 *\brief		Définit le parent d'une transformation.
+		 *\param[in]	index	L'indice de la transformation.
+		 *\param[in]	parent	L'indice du parent, InvalidIndex pour en faire une racine.
+		 */
+		CU_API void setParent( uint32_t index
+			, uint32_t parent );
+		/**
+		 *\~english
+		 *\brief		Defines a transform's local transformations.
+		 *\param[in]	index		The transform index.
+		 *\param[in]	position	The position, relative to the parent.
+		 *\param[in]	orientation	The orientation, relative to the parent.
+		 *\param[in]	scale		The scale, relative to the parent.
+		 *\~french
+		 *\brief		Définit les transformations locales d'une transformation.
+		 *\param[in]	index		L'indice de la transformation.
+		 *\param[in]	position	La position, relative au parent.
+		 *\param[in]	orientation	L'orientation, relative au parent.
+		 *\param[in]	scale		L'échelle, relative au parent.
+		 */
+		CU_API void setLocal( uint32_t index
+			, Point3f const & position
+			, Quaternion const & orientation
+			, Point3f const & scale );
+		/**
+		 *\~english
+		 *\brief		Computes the world transformations of the transforms changed since the last update, and of their descendants.
+		 *\remarks		The changed transforms are processed depth by depth, so that parents come before their children,
+		 *				and only them and their descendants are visited.
+		 *\~french
+		 *\brief		Calcule les transformations monde des transformations changées depuis la dernière mise à jour, et de leurs descendants.
+		 *\remarks		Les transformations changées sont traitées profondeur par profondeur, pour que les parents soient avant leurs enfants,
+		 *				et seules elles et leurs descendants sont visités.
+		 */
+		CU_API void update();
+		/**
+		 *\~english
+		 *\brief		Multiplies two matrices, one SIMD column at a time.
+		 *\param[in]	lhs, rhs	The matrices.
+		 *\param[out]	result		Receives the product, may be \p rhs but not \p lhs.
+		 *\~french
+		 *\brief		Multiplie deux matrices, une colonne SIMD à la fois.
+		 *\param[in]	lhs, rhs	Les matrices.
+		 *\param[out]	result		Reçoit le produit, peut être \p rhs mais pas \p lhs.
+		 */
+		CU_API static void multiply( Matrix4x4f const & lhs
+			, Matrix4x4f const & rhs
+			, Matrix4x4f & result );
+		/**
+		 *\~english
+		 *\return		The transforms whose world transformations changed during the last update.
+		 *\~french
+		 *\return		Les transformations dont les transformations monde ont changé pendant la dernière mise à jour.
+		 */
+		ArrayView< uint32_t const > getChanged()const
+		{
+			return makeArrayView( m_changed.data(), m_changed.data() + m_changed.size() );
+		}
+		/**
+		 *\~english
+		 *\return		\p true if some transforms changed since the last update.
+		 *\~french
+		 *\return		\p true si des transformations ont changé depuis la dernière mise à jour.
+		 */
+		bool isDirty()const
+		{
+			return !m_dirty.empty();
+		}
+
+		void * getData( uint32_t index )const
+		{
+			return m_data[index];
+		}
+
+		uint32_t getParent( uint32_t index )const
+		{
+			return m_parents[index];
+		}
+
+		uint32_t getDepth( uint32_t index )const
+		{
+			return m_depths[index];
+		}
+
+		Matrix4x4f const & getLocalMatrix( uint32_t index )const
+		{
+			return m_localMatrices[index];
+		}
+
+		Matrix4x4f const & getWorldMatrix( uint32_t index )const
+		{
+			return m_worldMatrices[index];
+		}
+
+		Quaternion const & getWorldOrientation( uint32_t index )const
+		{
+			return m_worldOrientations[index];
+		}
+
+		Point3f const & getWorldScale( uint32_t index )const
+		{
+			return m_worldScales[index];
+		}
+
+		Point3f getWorldPosition( uint32_t index )const
+		{
+			auto & column = m_worldMatrices[index][3];
+			return Point3f{ column[0], column[1], column[2] };
+		}
+
+		uint32_t size()const
+		{
+			return m_count;
+		}
+
+		bool empty()const
+		{
+			return m_count == 0u;
+		}
+
+	private:
+		void doMarkDirty( uint32_t index );
+		void doUnlink( uint32_t index );
+		void doUpdateDepths( uint32_t index
+			, uint32_t depth );
+		std::vector< uint32_t > & doGetLevel( uint32_t depth );
+
+	private:
+		uint32_t m_count{ 0u };
+		// One array per attribute, indexed by the transform index.
+		// Removed transforms leave holes, reused by the next additions.
+		std::vector< uint32_t > m_parents;
+		// The children lists, as a first child and doubly linked siblings.
+		std::vector< uint32_t > m_firstChildren;
+		std::vector< uint32_t > m_nextSiblings;
+		std::vector< uint32_t > m_previousSiblings;
+		std::vector< uint32_t > m_depths;
+		std::vector< Point3f > m_positions;
+		std::vector< Quaternion > m_orientations;
+		std::vector< Point3f > m_scales;
+		std::vector< Matrix4x4f > m_localMatrices;
+		std::vector< Matrix4x4f > m_worldMatrices;
+		std::vector< Quaternion > m_worldOrientations;
+		std::vector< Point3f > m_worldScales;
+		std::vector< void * > m_data;
+		std::vector< uint8_t > m_alive;
+		std::vector< uint8_t > m_localDirty;
+		std::vector< uint8_t > m_worldChanged;
+		std::vector< uint32_t > m_free;
+		// The transforms changed since the last update.
+		std::vector< uint32_t > m_dirty;
+		// The transforms to process during the update, one list per depth.
+		std::vector< std::vector< uint32_t > > m_levels;
+		std::vector< uint32_t > m_changed;
+	};
+}
+
+#endif
@@ -45,6 +45,29 @@ namespace castor
 		hash = static_cast< std::size_t >( b * kMul );
 		return hash;
 	}
+	/**
+	 *\~english
+	 *\brief		Computes the FNV-1a hash of a bytes buffer.
+	 *\param[in]	data	The buffer.
+	 *\param[in]	size	The buffer size.
+	 *\~french
+	 *\brief		Calcule le hash FNV-1a d'un tampon d'octets.
+	 *\param[in]	data	Le tampon.
+	 *\param[in]	size	La taille du tampon.
+	 */
+	inline uint64_t hashBytes( uint8_t const * data
+		, size_t size )
+	{
+		uint64_t result = 0xcbf29ce484222325ULL;
+
+		for ( auto it = data; it != data + size; ++it )
+		{
+			result ^= *it;
+			result *= 0x100000001b3ULL;
+		}
+
+		return result;
+	}
 }
 
 #endif
@@ -4,46 +4,213 @@ See LICENSE file in root folder
 #ifndef ___CU_AsyncJobQueue_H___
 #define ___CU_AsyncJobQueue_H___
 
-#include "CastorUtils/Multithreading/ThreadPool.hpp"
+#include "CastorUtils/Multithreading/MpmcQueue.hpp"
 
+#include <array>
 #include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace castor
 {
+	/**
+	\~english
+	\brief		The priority classes of the AsyncJobQueue, from highest to lowest.
+	\~french
+	\brief		Les classes de priorité de l'AsyncJobQueue, de la plus haute à la plus basse.
+	*/
+	enum class JobPriority
+		: uint8_t
+	{
+		//!\~english	Jobs blocking user interaction.
+		//!\~french		Jobs bloquant l'interaction utilisateur.
+		eInteractive,
+		//!\~english	Resources streaming jobs (textures preparation, ...).
+		//!\~french		Jobs de streaming de ressources (préparation des textures, ...).
+		eStreaming,
+		//!\~english	Anything else.
+		//!\~french		Tout le reste.
+		eBackground,
+		CU_ScopedEnumBounds( eInteractive )
+	};
+
 	class AsyncJobQueue
 	{
 	public:
 		using Job = std::function< void() >;
-		using JobArray = std::vector< Job >;
+
+	private:
+		enum class Status
+			: uint8_t
+		{
+			ePending,
+			eRunning,
+			eDone,
+			eCancelled,
+		};
+
+		struct State;
+		using StatePtr = std::shared_ptr< State >;
+		// The queue internals, shared with the jobs states, so that the handles may outlive the queue.
+		struct Shared;
+		using SharedPtr = std::shared_ptr< Shared >;
+
+		struct Continuation
+		{
+			StatePtr state;
+			JobPriority priority;
+		};
+
+		struct State
+		{
+			State( SharedPtr queue
+				, Job job )
+				: queue{ std::move( queue ) }
+				, job{ std::move( job ) }
+			{
+			}
+
+			SharedPtr queue;
+			Job job;
+			std::atomic< Status > status{ Status::ePending };
+			std::mutex mutex;
+			std::condition_variable finished;
+			std::vector< Continuation > continuations;
+		};
+
+	public:
+		/**
+		\~english
+		\brief		Handle to a job pushed in an AsyncJobQueue.
+		\~french
+		\brief		Handle sur un job ajouté à une AsyncJobQueue.
+		*/
+		class Handle
+		{
+			friend class AsyncJobQueue;
+
+		public:
+			Handle() = default;
+			/**
+			 *\~english
+			 *\brief		Cancels the job, if it has not started yet.
+			 *\remarks		The job's continuations are cancelled as well.
+			 *\return		\p true if the job has been cancelled.
+			 *\~french
+			 *\brief		Annule le job, s'il n'a pas encore démarré.
+			 *\remarks		Les continuations du job sont aussi annulées.
+			 *\return		\p true si le job a été annulé.
+			 */
+			CU_API bool cancel();
+			/**
+			 *\~english
+			 *\brief		Waits for the job to be either done or cancelled.
+			 *\remarks		Must not be called from a job of the same queue.
+			 *\~french
+			 *\brief		Attend que le job soit terminé ou annulé.
+			 *\remarks		Ne doit pas être appelée depuis un job de la même file.
+			 */
+			CU_API void wait()const;
+			/**
+			 *\~english
+			 *\brief		Registers a job to run once this one is done.
+			 *\remarks		If this job is cancelled, the continuation is cancelled too.
+			 *\param[in]	job			The continuation.
+			 *\param[in]	priority	The continuation's priority.
+			 *\return		The continuation's handle.
+			 *\~french
+			 *\brief		Enregistre un job à lancer une fois que celui-ci est terminé.
+			 *\remarks		Si ce job est annulé, la continuation l'est aussi.
+			 *\param[in]	job			La continuation.
+			 *\param[in]	priority	La priorité de la continuation.
+			 *\return		Le handle de la continuation.
+			 */
+			CU_API Handle then( Job job
+				, JobPriority priority = JobPriority::eBackground );
+			/**
+			 *\~english
+			 *\return		\p true if the job has run.
+			 *\~french
+			 *\return		\p true si le job a été exécuté.
+			 */
+			bool isDone()const
+			{
+				return m_state
+					&& m_state->status == Status::eDone;
+			}
+			/**
+			 *\~english
+			 *\return		\p true if the job has been cancelled.
+			 *\~french
+			 *\return		\p true si le job a été annulé.
+			 */
+			bool isCancelled()const
+			{
+				return m_state
+					&& m_state->status == Status::eCancelled;
+			}
+			/**
+			 *\~english
+			 *\return		\p false if the handle is empty.
+			 *\~french
+			 *\return		\p false si le handle est vide.
+			 */
+			bool isValid()const
+			{
+				return m_state != nullptr;
+			}
+
+		private:
+			explicit Handle( StatePtr state )
+				: m_state{ std::move( state ) }
+			{
+			}
+
+		private:
+			StatePtr m_state;
+		};
 
 	public:
 		/**
 		 *\~english
-		 *\brief		Constructor, initialises the pool with given threads count.
-		 *\param[in]	count	The threads count.
+		 *\brief		Constructor, initialises the queue with given threads count.
+		 *\param[in]	count		The threads count.
+		 *\param[in]	capacity	The capacity of each priority queue.
 		 *\~french
-		 *\brief		Constructeur, initialise le pool au nombre de threads donné.
-		 *\param[in]	count	Le nombre de threads du pool.
+		 *\brief		Constructeur, initialise la file au nombre de threads donné.
+		 *\param[in]	count		Le nombre de threads.
+		 *\param[in]	capacity	La capacité de chaque file de priorité.
 		 */
-		CU_API explicit AsyncJobQueue( size_t count );
+		CU_API explicit AsyncJobQueue( size_t count
+			, size_t capacity = 1024u );
 		/**
 		 *\~english
-		 *\brief		Destructor.
+		 *\brief		Destructor, cancels the jobs that have not started yet.
+		 *\remarks		The handles remain usable, jobs continued from them afterwards are cancelled.
 		 *\~french
-		 *\brief		Destructeur.
+		 *\brief		Destructeur, annule les jobs qui n'ont pas encore démarré.
+		 *\remarks		Les handles restent utilisables, les jobs qui en sont continués ensuite sont annulés.
 		 */
 		CU_API ~AsyncJobQueue()noexcept;
 		/**
 		 *\~english
-		 *\brief		Feeds a worker thread with the given job.
-		 *\remarks		If no thread is available, waits for one to finish its job.
-		 *\param[in]	job	The job.
+		 *\brief		Enqueues the given job.
+		 *\remarks		If the priority queue is full, the calling thread runs pending jobs until there is room.
+		 *\param[in]	job			The job.
+		 *\param[in]	priority	The job priority.
+		 *\return		The job's handle.
 		 *\~french
-		 *\brief		donne à un thread de travail la tâche donnée.
-		 *\remarks		Si aucun thread n'est disponible, attend que l'un d'eux finisse sa tâche.
-		 *\param[in]	job	La tâche.
+		 *\brief		Met dans la file la tâche donnée.
+		 *\remarks		Si la file de priorité est pleine, le thread appelant exécute des tâches en attente jusqu'à ce qu'il y ait de la place.
+		 *\param[in]	job			La tâche.
+		 *\param[in]	priority	La priorité de la tâche.
+		 *\return		Le handle de la tâche.
 		 */
-		CU_API void pushJob( Job job );
+		CU_API Handle pushJob( Job job
+			, JobPriority priority = JobPriority::eBackground );
 		/**
 		 *\~english
 		 *\brief		Waits for all the jobs to be run.
@@ -53,16 +220,8 @@ namespace castor
 		CU_API void waitAll();
 
 	private:
-		void doRun();
-		Job doPopJob();
-		bool doCheckEnded();
-
-	private:
-		std::atomic_bool m_ended;
-		JobArray m_pending;
-		ThreadPool m_pool;
-		std::mutex m_mutex;
-		std::thread m_worker;
+		SharedPtr m_shared;
+		std::vector< std::thread > m_workers;
 	};
 }
 
@@ -0,0 +1,176 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_JobScheduler_H___
+#define ___CU_JobScheduler_H___
+
+#include "CastorUtils/Multithreading/MultithreadingModule.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace castor
+{
+	class JobCounter
+	{
+		friend class JobScheduler;
+
+	public:
+		JobCounter() = default;
+		JobCounter( JobCounter const & ) = delete;
+		JobCounter & operator=( JobCounter const & ) = delete;
+		/**
+		 *\~english
+		 *\return		\p true if all the jobs tracked by this counter are done.
+		 *\~french
+		 *\return		\p true si tous les jobs suivis par ce compteur sont terminés.
+		 */
+		bool isDone()const
+		{
+			return m_pending.load( std::memory_order_acquire ) == 0u;
+		}
+		/**
+		 *\~english
+		 *\return		The number of jobs tracked by this counter that are still pending.
+		 *\~french
+		 *\return		Le nombre de jobs suivis par ce compteur qui sont encore en attente.
+		 */
+		uint32_t getPending()const
+		{
+			return m_pending.load( std::memory_order_acquire );
+		}
+
+	private:
+		void doAdd()
+		{
+			m_pending.fetch_add( 1u, std::memory_order_relaxed );
+		}
+
+		bool doRelease()
+		{
+			return m_pending.fetch_sub( 1u, std::memory_order_acq_rel ) == 1u;
+		}
+
+	private:
+		std::atomic< uint32_t > m_pending{ 0u };
+	};
+
+	class JobScheduler
+	{
+	public:
+		using Job = std::function< void() >;
+
+	private:
+		struct Entry
+		{
+			Job job;
+			JobCounter * counter{ nullptr };
+		};
+
+		struct Worker
+		{
+			std::mutex mutex;
+			std::deque< Entry > jobs;
+			std::thread thread;
+		};
+
+		using WorkerPtr = std::unique_ptr< Worker >;
+		using WorkerArray = std::vector< WorkerPtr >;
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor, initialises the scheduler with given threads count.
+		 *\param[in]	count	The threads count.
+		 *\~french
+		 *\brief		Constructeur, initialise l'ordonnanceur au nombre de threads donné.
+		 *\param[in]	count	Le nombre de threads.
+		 */
+		CU_API explicit JobScheduler( size_t count );
+		/**
+		 *\~english
+		 *\brief		Destructor, waits for all pending jobs.
+		 *\~french
+		 *\brief		Destructeur, attend la fin de tous les jobs en attente.
+		 */
+		CU_API ~JobScheduler()noexcept;
+		/**
+		 *\~english
+		 *\brief		Pushes a job in the scheduler.
+		 *\remarks		Never blocks. When called from one of the scheduler's threads, the job goes to that thread's own queue.
+		 *\param[in]	job		The job.
+		 *\param[in]	counter	Optional counter, incremented now and decremented once the job has run.
+		 *\~french
+		 *\brief		Ajoute un job à l'ordonnanceur.
+		 *\remarks		Ne bloque jamais. Appelée depuis l'un des threads de l'ordonnanceur, le job va dans la file de ce thread.
+		 *\param[in]	job		Le job.
+		 *\param[in]	counter	Compteur optionnel, incrémenté maintenant et décrémenté une fois le job exécuté.
+		 */
+		CU_API void pushJob( Job job
+			, JobCounter * counter = nullptr );
+		/**
+		 *\~english
+		 *\brief		Waits for all the jobs tracked by the given counter.
+		 *\remarks		The calling thread runs pending jobs while waiting, and blocks (without polling) when there are none left.
+		 *\param[in]	counter	The counter.
+		 *\~french
+		 *\brief		Attend la fin de tous les jobs suivis par le compteur donné.
+		 *\remarks		Le thread appelant exécute des jobs en attente pendant ce temps, et se bloque (sans scrutation) lorsqu'il n'y en a plus.
+		 *\param[in]	counter	Le compteur.
+		 */
+		CU_API void wait( JobCounter const & counter );
+		/**
+		 *\~english
+		 *\brief		Waits for all the jobs pushed in the scheduler.
+		 *\remarks		Must not be called from a job.
+		 *\~french
+		 *\brief		Attend la fin de tous les jobs ajoutés à l'ordonnanceur.
+		 *\remarks		Ne doit pas être appelée depuis un job.
+		 */
+		CU_API void waitAll();
+		/**
+		 *\~english
+		 *\return		\p true if no job is queued or running.
+		 *\~french
+		 *\return		\p true si aucun job n'est en attente ou en cours.
+		 */
+		bool isIdle()const
+		{
+			return m_unfinished.load( std::memory_order_acquire ) == 0u;
+		}
+		/**
+		 *\~english
+		 *\return		The threads count.
+		 *\~french
+		 *\return		Le nombre de threads.
+		 */
+		size_t getCount()const
+		{
+			return m_workers.size();
+		}
+
+	private:
+		void doRun( size_t index );
+		bool doPopJob( size_t index, Entry & result );
+		bool doStealJob( size_t thief, Entry & result );
+		void doRunJob( Entry & entry );
+		bool doRunOne();
+		template< typename PredicateT >
+		void doHelpUntil( PredicateT predicate );
+
+	private:
+		WorkerArray m_workers;
+		std::atomic< uint32_t > m_queued{ 0u };
+		std::atomic< uint32_t > m_unfinished{ 0u };
+		std::atomic< uint32_t > m_submitIndex{ 0u };
+		std::atomic_bool m_terminate{ false };
+		std::mutex m_sleepMutex;
+		std::condition_variable m_wakeup;
+	};
+}
+
+#endif
@@ -0,0 +1,170 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_MpmcQueue_H___
+#define ___CU_MpmcQueue_H___
+
+#include "CastorUtils/Multithreading/MultithreadingModule.hpp"
+
+#include <atomic>
+#include <memory>
+
+namespace castor
+{
+	/**
+	 *\~english
+	 *\brief		Bounded, lock-free, multiple producers multiple consumers queue.
+	 *\remarks		Based on Dmitry Vyukov's bounded MPMC queue.
+	 *\~french
+	 *\brief		File bornée, sans verrou, à multiples producteurs et multiples consommateurs.
+	 *\remarks		Basée sur la file MPMC bornée de Dmitry Vyukov.
+	 */
+	template< typename T >
+	class MpmcQueue
+	{
+	private:
+		struct Cell
+		{
+			std::atomic< size_t > sequence;
+			T data;
+		};
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Constructor.
+		 *\param[in]	capacity	The queue capacity, rounded up to the next power of two.
+		 *\~french
+		 *\brief		Constructeur.
+		 *\param[in]	capacity	La capacité de la file, arrondie à la puissance de deux supérieure.
+		 */
+		explicit MpmcQueue( size_t capacity )
+			: m_mask{ doGetCapacity( capacity ) - 1u }
+			, m_cells{ std::make_unique< Cell[] >( m_mask + 1u ) }
+		{
+			for ( size_t i = 0u; i <= m_mask; ++i )
+			{
+				m_cells[i].sequence.store( i, std::memory_order_relaxed );
+			}
+		}
+
+		MpmcQueue( MpmcQueue const & ) = delete;
+		MpmcQueue & operator=( MpmcQueue const & ) = delete;
+		/**
+		 *\~english
+		 *\brief		Tries to push a value in the queue.
+		 *\param[in]	value	The value, moved from only on success.
+		 *\return		\p false if the queue is full.
+		 *\~french
+		 *\brief		Essaie d'ajouter une valeur à la file.
+		 *\param[in]	value	La valeur, déplacée uniquement en cas de succès.
+		 *\return		\p false si la file est pleine.
+		 */
+		bool tryPush( T & value )
+		{
+			Cell * cell;
+			size_t pos = m_enqueuePos.load( std::memory_order_relaxed );
+
+			for ( ;; )
+			{
+				cell = &m_cells[pos & m_mask];
+				size_t seq = cell->sequence.load( std::memory_order_acquire );
+				auto diff = intptr_t( seq ) - intptr_t( pos );
+
+				if ( diff == 0 )
+				{
+					if ( m_enqueuePos.compare_exchange_weak( pos, pos + 1u, std::memory_order_relaxed ) )
+					{
+						break;
+					}
+				}
+				else if ( diff < 0 )
+				{
+					return false;
+				}
+				else
+				{
+					pos = m_enqueuePos.load( std::memory_order_relaxed );
+				}
+			}
+
+			cell->data = std::move( value );
+			cell->sequence.store( pos + 1u, std::memory_order_release );
+			return true;
+		}
+		/**
+		 *\~english
+		 *\brief		Tries to pop a value from the queue.
+		 *\param[out]	value	Receives the value.
+		 *\return		\p false if the queue is empty.
+		 *\~french
+		 *\brief		Essaie de retirer une valeur de la file.
+		 *\param[out]	value	Reçoit la valeur.
+		 *\return		\p false si la file est vide.
+		 */
+		bool tryPop( T & value )
+		{
+			Cell * cell;
+			size_t pos = m_dequeuePos.load( std::memory_order_relaxed );
+
+			for ( ;; )
+			{
+				cell = &m_cells[pos & m_mask];
+				size_t seq = cell->sequence.load( std::memory_order_acquire );
+				auto diff = intptr_t( seq ) - intptr_t( pos + 1u );
+
+				if ( diff == 0 )
+				{
+					if ( m_dequeuePos.compare_exchange_weak( pos, pos + 1u, std::memory_order_relaxed ) )
+					{
+						break;
+					}
+				}
+				else if ( diff < 0 )
+				{
+					return false;
+				}
+				else
+				{
+					pos = m_dequeuePos.load( std::memory_order_relaxed );
+				}
+			}
+
+			value = std::move( cell->data );
+			cell->data = T{};
+			cell->sequence.store( pos + m_mask + 1u, std::memory_order_release );
+			return true;
+		}
+		/**
+		 *\~english
+		 *\return		The queue capacity.
+		 *\~french
+		 *\return		La capacité de la file.
+		 */
+		size_t getCapacity()const
+		{
+			return m_mask + 1u;
+		}
+
+	private:
+		static size_t doGetCapacity( size_t capacity )
+		{
+			size_t result = 2u;
+
+			while ( result < capacity )
+			{
+				result <<= 1u;
+			}
+
+			return result;
+		}
+
+	private:
+		size_t const m_mask;
+		std::unique_ptr< Cell[] > m_cells;
+		alignas( 64 ) std::atomic< size_t > m_enqueuePos{ 0u };
+		alignas( 64 ) std::atomic< size_t > m_dequeuePos{ 0u };
+	};
+}
+
+#endif
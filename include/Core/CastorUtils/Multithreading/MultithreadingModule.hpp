@@ -13,6 +13,42 @@ namespace castor
 	//@{
 	/**
 	\~english
+	\brief		Prioritised asynchronous jobs queue, returning cancellable job handles.
+	\~french
+	\brief		File de jobs asynchrones priorisés, retournant des handles de job annulables.
+	*/
+	class AsyncJobQueue;
+	/**
+	\~english
+	\brief		Counter of pending jobs, that can be waited on through a JobScheduler.
+	\~french
+	\brief		Compteur de jobs en attente, pouvant être attendu via un JobScheduler.
+	*/
+	class JobCounter;
+	/**
+	\~english
+	\brief		Work stealing job scheduler, with per thread job queues.
+	\~french
+	\brief		Ordonnanceur de jobs à vol de travail, avec une file de jobs par thread.
+	*/
+	class JobScheduler;
+	/**
+	\~english
+	\brief		Bounded lock-free multiple producers multiple consumers queue.
+	\~french
+	\brief		File bornée sans verrou à multiples producteurs et consommateurs.
+	*/
+	template< typename T >
+	class MpmcQueue;
+	/**
+	\~english
+	\brief		Graph of tasks with explicit dependencies, run on a JobScheduler.
+	\~french
+	\brief		Graphe de tâches aux dépendances explicites, exécuté sur un JobScheduler.
+	*/
+	class TaskGraph;
+	/**
+	\~english
 	\brief		Thread pool implementation, using WorkerThreads.
 	\~french
 	\brief		Implémentation de pool de thread, utilisant des WorkerThread.
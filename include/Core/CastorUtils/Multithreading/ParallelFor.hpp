@@ -0,0 +1,114 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_ParallelFor_H___
+#define ___CU_ParallelFor_H___
+
+#include "CastorUtils/Multithreading/JobScheduler.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace castor
+{
+	/**
+	 *\~english
+	 *\brief		Calls \p func for each index in [begin, end), splitting the range in chunks run on the given scheduler.
+	 *\remarks		The calling thread takes part in the execution, and the function returns once all chunks are processed.
+	 *\param[in]	scheduler	The scheduler.
+	 *\param[in]	begin, end	The indices range.
+	 *\param[in]	func		The function, called with each index.
+	 *\param[in]	grain		The minimal number of indices per chunk.
+	 *\~french
+	 *\brief		Appelle \p func pour chaque indice de [begin, end), en découpant l'intervalle en morceaux exécutés sur l'ordonnanceur donné.
+	 *\remarks		Le thread appelant participe à l'exécution, et la fonction retourne une fois tous les morceaux traités.
+	 *\param[in]	scheduler	L'ordonnanceur.
+	 *\param[in]	begin, end	L'intervalle d'indices.
+	 *\param[in]	func		La fonction, appelée avec chaque indice.
+	 *\param[in]	grain		Le nombre minimal d'indices par morceau.
+	 */
+	template< typename IndexT, typename FuncT >
+	void parallelFor( JobScheduler & scheduler
+		, IndexT begin
+		, IndexT end
+		, FuncT const & func
+		, IndexT grain = IndexT{ 1 } )
+	{
+		if ( begin >= end )
+		{
+			return;
+		}
+
+		auto count = size_t( end - begin );
+		grain = std::max( IndexT{ 1 }, grain );
+		auto maxChunks = scheduler.getCount() * 4u;
+		auto chunks = std::min( maxChunks, ( count + size_t( grain ) - 1u ) / size_t( grain ) );
+
+		if ( chunks <= 1u )
+		{
+			for ( auto i = begin; i < end; ++i )
+			{
+				func( i );
+			}
+
+			return;
+		}
+
+		auto chunkSize = ( count + chunks - 1u ) / chunks;
+		JobCounter counter;
+
+		// The first chunk is kept for the calling thread.
+		for ( size_t offset = chunkSize; offset < count; offset += chunkSize )
+		{
+			auto chunkBegin = IndexT( begin + IndexT( offset ) );
+			auto chunkEnd = IndexT( begin + IndexT( std::min( offset + chunkSize, count ) ) );
+			scheduler.pushJob( [&func, chunkBegin, chunkEnd]()
+				{
+					for ( auto i = chunkBegin; i < chunkEnd; ++i )
+					{
+						func( i );
+					}
+				}
+				, &counter );
+		}
+
+		for ( auto i = begin; i < IndexT( begin + IndexT( chunkSize ) ); ++i )
+		{
+			func( i );
+		}
+
+		scheduler.wait( counter );
+	}
+	/**
+	 *\~english
+	 *\brief		Calls \p func for each element in [begin, end), splitting the range in chunks run on the given scheduler.
+	 *\param[in]	scheduler	The scheduler.
+	 *\param[in]	begin, end	The random access iterators range.
+	 *\param[in]	func		The function, called with each element.
+	 *\param[in]	grain		The minimal number of elements per chunk.
+	 *\~french
+	 *\brief		Appelle \p func pour chaque élément de [begin, end), en découpant l'intervalle en morceaux exécutés sur l'ordonnanceur donné.
+	 *\param[in]	scheduler	L'ordonnanceur.
+	 *\param[in]	begin, end	L'intervalle d'itérateurs à accès aléatoire.
+	 *\param[in]	func		La fonction, appelée avec chaque élément.
+	 *\param[in]	grain		Le nombre minimal d'éléments par morceau.
+	 */
+	template< typename IterT, typename FuncT >
+	void parallelForEach( JobScheduler & scheduler
+		, IterT begin
+		, IterT end
+		, FuncT const & func
+		, size_t grain = 1u )
+	{
+		parallelFor( scheduler
+			, size_t{ 0u }
+			, size_t( std::distance( begin, end ) )
+			, [&begin, &func]( size_t index )
+			{
+				func( *std::next( begin, ptrdiff_t( index ) ) );
+			}
+			, grain );
+	}
+}
+
+#endif
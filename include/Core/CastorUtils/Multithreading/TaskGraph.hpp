@@ -0,0 +1,109 @@
+/*
+See LICENSE file in root folder
+*/
+#ifndef ___CU_TaskGraph_H___
+#define ___CU_TaskGraph_H___
+
+#include "CastorUtils/Multithreading/JobScheduler.hpp"
+
+#include <initializer_list>
+#include <vector>
+
+namespace castor
+{
+	class TaskGraph
+	{
+	public:
+		using Task = std::function< void() >;
+		using TaskId = uint32_t;
+
+	private:
+		struct Node
+		{
+			Task task;
+			std::vector< TaskId > successors;
+			uint32_t dependencies{ 0u };
+		};
+
+	public:
+		/**
+		 *\~english
+		 *\brief		Adds a task to the graph.
+		 *\remarks		Dependencies must be tasks already added to the graph, which makes the graph acyclic by construction.
+		 *\param[in]	task			The task.
+		 *\param[in]	dependencies	The tasks that must be completed before this one starts.
+		 *\return		The task ID, to use as other tasks dependency.
+		 *\~french
+		 *\brief		Ajoute une tâche au graphe.
+		 *\remarks		Les dépendances doivent être des tâches déjà ajoutées au graphe, ce qui le rend acyclique par construction.
+		 *\param[in]	task			La tâche.
+		 *\param[in]	dependencies	Les tâches devant être terminées avant que celle-ci ne démarre.
+		 *\return		L'ID de la tâche, à utiliser comme dépendance d'autres tâches.
+		 */
+		CU_API TaskId add( Task task
+			, std::initializer_list< TaskId > dependencies = {} );
+		/**
+		 *\~english
+		 *\brief		Adds a task to the graph.
+		 *\param[in]	task			The task.
+		 *\param[in]	dependencies	The tasks that must be completed before this one starts.
+		 *\return		The task ID.
+		 *\~french
+		 *\brief		Ajoute une tâche au graphe.
+		 *\param[in]	task			La tâche.
+		 *\param[in]	dependencies	Les tâches devant être terminées avant que celle-ci ne démarre.
+		 *\return		L'ID de la tâche.
+		 */
+		CU_API TaskId add( Task task
+			, std::vector< TaskId > const & dependencies );
+		/**
+		 *\~english
+		 *\brief		Runs the whole graph on the given scheduler, and waits for its completion.
+		 *\remarks		The calling thread takes part in the execution. The graph can be run several times.
+		 *\param[in]	scheduler	The scheduler.
+		 *\~french
+		 *\brief		Exécute tout le graphe sur l'ordonnanceur donné, et attend sa complétion.
+		 *\remarks		Le thread appelant participe à l'exécution. Le graphe peut être exécuté plusieurs fois.
+		 *\param[in]	scheduler	L'ordonnanceur.
+		 */
+		CU_API void run( JobScheduler & scheduler );
+		/**
+		 *\~english
+		 *\brief		Runs the whole graph on the calling thread, in insertion order.
+		 *\~french
+		 *\brief		Exécute tout le graphe sur le thread appelant, dans l'ordre d'insertion.
+		 */
+		CU_API void runSerial();
+		/**
+		 *\~english
+		 *\brief		Removes all the tasks.
+		 *\~french
+		 *\brief		Supprime toutes les tâches.
+		 */
+		void clear()
+		{
+			m_nodes.clear();
+		}
+		/**
+		 *\~english
+		 *\return		The tasks count.
+		 *\~french
+		 *\return		Le nombre de tâches.
+		 */
+		size_t size()const
+		{
+			return m_nodes.size();
+		}
+
+	private:
+		void doPush( JobScheduler & scheduler
+			, JobCounter & counter
+			, std::atomic< uint32_t > * remaining
+			, TaskId id );
+
+	private:
+		std::vector< Node > m_nodes;
+	};
+}
+
+#endif
@@ -49,18 +49,27 @@ namespace castor3d
 				if ( result )
 				{
 					boneCount = count;
-					bones.resize( count );
 				}
 
 				break;
 
 			case ChunkType::eSubmeshBones:
-				result = doParseChunk( bones, chunk );
-				checkError( result, "Couldn't parse bones data." );
-
-				if ( result && boneCount > 0 )
+				if ( boneCount > 0 )
 				{
-					obj.addBoneDatas( bones );
+					auto mapped = doMapChunk< VertexBoneData >( boneCount, chunk );
+
+					if ( !mapped )
+					{
+						bones.resize( boneCount );
+						result = doParseChunk( bones, chunk );
+						checkError( result, "Couldn't parse bones data." );
+						mapped = bones.data();
+					}
+
+					if ( result )
+					{
+						obj.addBoneDatas( mapped, mapped + boneCount );
+					}
 				}
 
 				boneCount = 0u;
@@ -4,12 +4,47 @@
 
 #include <CastorUtils/Data/BinaryFile.hpp>
 
-#include <numeric>
+#include <algorithm>
 
 using namespace castor;
 
 namespace castor3d
 {
+	namespace
+	{
+		// cmsh 1.x: type + size.
+		uint32_t constexpr LegacyHeaderSize = uint32_t( sizeof( ChunkType ) + sizeof( uint32_t ) );
+		// cmsh 2.0: type + size + padding, to keep the payloads aligned.
+		uint32_t constexpr HeaderSize = CmshChunkAlignment;
+
+		uint32_t alignSize( uint32_t size )
+		{
+			return ( size + CmshChunkAlignment - 1u ) & ~( CmshChunkAlignment - 1u );
+		}
+
+		bool checkEndianness( ChunkType & type
+			, bool & bigEndian )
+		{
+			// cmsh 1.x files are big endian, cmsh 2.0 ones are little endian:
+			// the root chunk type tells which one we are reading.
+			auto swapped = type;
+			castor::switchEndianness( swapped );
+
+			if ( type == ChunkType::eCmshFile )
+			{
+				bigEndian = castor::isBigEndian();
+			}
+			else if ( swapped == ChunkType::eCmshFile )
+			{
+				type = swapped;
+				bigEndian = !castor::isBigEndian();
+			}
+
+			return bigEndian
+				|| !castor::isBigEndian();
+		}
+	}
+
 	BinaryChunk::BinaryChunk()
 		: m_type{ ChunkType::eUnknown }
 		, m_index{ 0 }
@@ -24,11 +59,9 @@ namespace castor3d
 
 	void BinaryChunk::finalise()
 	{
-		uint32_t size = std::accumulate( m_addedData.begin(), m_addedData.end(), 0, [&]( uint32_t p_value, ByteArray const & p_array )
-		{
-			return p_value + uint32_t( p_array.size() );
-		} );
-		m_data.resize( size );
+		m_view = nullptr;
+		m_viewSize = 0u;
+		m_data.resize( m_addedSize );
 		size_t index = 0;
 
 		for ( auto const & array : m_addedData )
@@ -40,51 +73,66 @@ namespace castor3d
 
 	void BinaryChunk::add( uint8_t * p_data, uint32_t p_size )
 	{
-		ByteArray buffer( p_data, p_data + p_size );
-		m_addedData.push_back( buffer );
+		m_addedData.emplace_back( p_data, p_data + p_size );
+		m_addedSize += p_size;
 	}
 
 	void BinaryChunk::get( uint8_t * p_data, uint32_t p_size )
 	{
-		std::memcpy( p_data, &m_data[m_index], p_size );
+		std::memcpy( p_data, getRemainingData(), p_size );
 		m_index += p_size;
 	}
 
 	bool BinaryChunk::checkAvailable( uint32_t p_size )const
 	{
-		return size_t( m_index ) + p_size <= m_data.size();
+		return size_t( m_index ) + p_size <= getDataSize();
 	}
 
 	uint32_t BinaryChunk::getRemaining()const
 	{
-		return uint32_t( m_data.size() - m_index );
+		return getDataSize() - m_index;
 	}
 
 	bool BinaryChunk::getSubChunk( BinaryChunk & p_chunkDst )
 	{
-		// First we retrieve the chunk type
-		BinaryChunk subchunk;
-		bool result = doRead( &subchunk.m_type, 1 );
+		auto headerSize = m_bigEndian
+			? LegacyHeaderSize
+			: HeaderSize;
+		bool result = checkAvailable( headerSize );
+		ChunkType type{};
 		uint32_t size = 0;
 
 		if ( result )
 		{
-			// Then the chunk data size
-			result = doRead( &size, 1 );
+			// First we retrieve the chunk type, then the chunk data size
+			std::memcpy( &type, getRemainingData(), sizeof( ChunkType ) );
+			std::memcpy( &size, getRemainingData() + sizeof( ChunkType ), sizeof( uint32_t ) );
+
+			if ( m_bigEndian )
+			{
+				prepareChunkData( type );
+				prepareChunkData( size );
+			}
+
+			m_index += headerSize;
+			result = checkAvailable( size );
 		}
 
 		if ( result )
 		{
-			result = size_t( m_index ) + size <= m_data.size();
+			// Eventually we retrieve the chunk data, as a view on this chunk's data
+			BinaryChunk subchunk{ type };
+			subchunk.m_view = getRemainingData();
+			subchunk.m_viewSize = size;
+			subchunk.m_bigEndian = m_bigEndian;
+			m_index += m_bigEndian
+				? size
+				: std::min( alignSize( size ), getRemaining() );
+			p_chunkDst = std::move( subchunk );
 		}
-
-		if ( result )
+		else
 		{
-			// Eventually we retrieve the chunk data
-			subchunk.m_data.insert( subchunk.m_data.end(), m_data.begin() + m_index, m_data.begin() + m_index + size );
-			subchunk.m_index = 0;
-			m_index += size;
-			p_chunkDst = subchunk;
+			binaryError( "Not enough data in chunk" );
 		}
 
 		return result;
@@ -92,19 +140,20 @@ namespace castor3d
 
 	bool BinaryChunk::addSubChunk( BinaryChunk const & p_subchunk )
 	{
-		uint32_t size = uint32_t( p_subchunk.m_data.size() );
+		auto size = p_subchunk.getDataSize();
 		ByteArray buffer;
-		buffer.reserve( sizeof( uint32_t ) + sizeof( ChunkType ) + size );
+		buffer.reserve( HeaderSize + alignSize( size ) );
 		// write subchunk type
-		auto type = systemEndianToBigEndian( p_subchunk.m_type );
-		auto data = reinterpret_cast< uint8_t const * >( &type );
+		auto data = reinterpret_cast< uint8_t const * >( &p_subchunk.m_type );
 		buffer.insert( buffer.end(), data, data + sizeof( ChunkType ) );
 		// The its size
-		systemEndianToBigEndian( size );
-		data = reinterpret_cast< uint8_t * >( &size );
+		data = reinterpret_cast< uint8_t const * >( &size );
 		buffer.insert( buffer.end(), data, data + sizeof( uint32_t ) );
-		// And eventually its data
-		buffer.insert( buffer.end(), p_subchunk.m_data.begin(), p_subchunk.m_data.end() );
+		buffer.resize( HeaderSize, 0u );
+		// And eventually its data, padded to keep the next chunks aligned
+		buffer.insert( buffer.end(), p_subchunk.getData(), p_subchunk.getData() + size );
+		buffer.resize( HeaderSize + alignSize( size ), 0u );
+
 		// And add it to this chunk
 		add( buffer.data(), uint32_t( buffer.size() ) );
 		return true;
@@ -112,14 +161,23 @@ namespace castor3d
 
 	bool BinaryChunk::write( castor::BinaryFile & p_file )
 	{
-		auto type = systemEndianToBigEndian( getChunkType() );
-		auto result = p_file.write( type ) == sizeof( ChunkType );
+		if ( castor::isBigEndian() )
+		{
+			binaryError( "Writing cmsh files is not supported on big endian systems" );
+			return false;
+		}
+
+		auto result = p_file.write( m_type ) == sizeof( ChunkType );
 
 		if ( result )
 		{
 			finalise();
-			auto size = systemEndianToBigEndian( getDataSize() );
-			result = p_file.write( size ) == sizeof( uint32_t );
+			result = p_file.write( getDataSize() ) == sizeof( uint32_t );
+		}
+
+		if ( result )
+		{
+			result = p_file.write( uint32_t{} ) == sizeof( uint32_t );
 		}
 
 		if ( result )
@@ -133,13 +191,35 @@ namespace castor3d
 	bool BinaryChunk::read( castor::BinaryFile & p_file )
 	{
 		uint32_t size = 0;
+		m_view = nullptr;
+		m_viewSize = 0u;
+		m_index = 0u;
 		bool result = p_file.read( m_type ) == sizeof( ChunkType );
-		bigEndianToSystemEndian( m_type );
+
+		if ( result )
+		{
+			result = checkEndianness( m_type, m_bigEndian );
+
+			if ( !result )
+			{
+				binaryError( "Reading cmsh 2 files is not supported on big endian systems" );
+			}
+		}
 
 		if ( result )
 		{
 			result = p_file.read( size ) == sizeof( uint32_t );
-			bigEndianToSystemEndian( size );
+
+			if ( m_bigEndian )
+			{
+				prepareChunkData( size );
+			}
+		}
+
+		if ( result && !m_bigEndian )
+		{
+			uint32_t padding{};
+			result = p_file.read( padding ) == sizeof( uint32_t );
 		}
 
 		if ( result )
@@ -151,6 +231,52 @@ namespace castor3d
 		return result;
 	}
 
+	bool BinaryChunk::read( uint8_t const * data
+		, size_t size )
+	{
+		m_data.clear();
+		m_index = 0u;
+		bool result = size >= LegacyHeaderSize;
+		uint32_t dataSize = 0u;
+
+		if ( result )
+		{
+			std::memcpy( &m_type, data, sizeof( ChunkType ) );
+			std::memcpy( &dataSize, data + sizeof( ChunkType ), sizeof( uint32_t ) );
+			result = checkEndianness( m_type, m_bigEndian );
+
+			if ( !result )
+			{
+				binaryError( "Reading cmsh 2 files is not supported on big endian systems" );
+			}
+		}
+
+		if ( result )
+		{
+			if ( m_bigEndian )
+			{
+				prepareChunkData( dataSize );
+			}
+
+			auto headerSize = m_bigEndian
+				? LegacyHeaderSize
+				: HeaderSize;
+			result = size >= size_t( headerSize ) + dataSize;
+
+			if ( result )
+			{
+				m_view = data + headerSize;
+				m_viewSize = dataSize;
+			}
+			else
+			{
+				binaryError( "Not enough data in chunk" );
+			}
+		}
+
+		return result;
+	}
+
 	void BinaryChunk::binaryError( std::string_view view )
 	{
 		log::error << view;
@@ -7,27 +7,61 @@
 
 namespace castor3d
 {
+	namespace
+	{
+		// Rotations are stored as 16 bits snorm quaternions, with a positive w.
+		float constexpr QuantisationScale = 32767.0f;
+
+		std::array< int16_t, 4u > quantise( castor::Quaternion const & value )
+		{
+			auto sign = value.quat.w < 0.0f ? -1.0f : 1.0f;
+			return { int16_t( std::round( sign * value.quat.x * QuantisationScale ) )
+				, int16_t( std::round( sign * value.quat.y * QuantisationScale ) )
+				, int16_t( std::round( sign * value.quat.z * QuantisationScale ) )
+				, int16_t( std::round( sign * value.quat.w * QuantisationScale ) ) };
+		}
+
+		castor::Quaternion dequantise( std::array< int16_t, 4u > const & value )
+		{
+			// The constructor normalises the quaternion.
+			return castor::Quaternion{ value[0] / QuantisationScale
+				, value[1] / QuantisationScale
+				, value[2] / QuantisationScale
+				, value[3] / QuantisationScale };
+		}
+	}
+
 	//*************************************************************************************************
 
 	bool BinaryWriter< SkeletonAnimationKeyFrame >::doWrite( SkeletonAnimationKeyFrame const & obj )
 	{
 		bool result = doWriteChunk( double( obj.getTimeIndex().count() ) / 1000.0, ChunkType::eSkeletonAnimationKeyFrameTime, m_chunk );
 
-		for ( auto & it : obj.m_transforms )
+		for ( auto & local : obj.getLocalTransforms() )
 		{
 			if ( result )
 			{
-				result = doWriteChunk( uint8_t( it.first->getType() ), ChunkType::eSkeletonAnimationKeyFrameObjectType, m_chunk );
+				result = doWriteChunk( uint8_t( local.object->getType() ), ChunkType::eSkeletonAnimationKeyFrameObjectType, m_chunk );
+			}
+
+			if ( result )
+			{
+				result = doWriteChunk( local.object->getName(), ChunkType::eSkeletonAnimationKeyFrameObjectName, m_chunk );
 			}
 
 			if ( result )
 			{
-				result = doWriteChunk( it.first->getName(), ChunkType::eSkeletonAnimationKeyFrameObjectName, m_chunk );
+				result = doWriteChunk( local.translate, ChunkType::eSkeletonAnimationKeyFrameObjectTranslate, m_chunk );
 			}
 
 			if ( result )
 			{
-				result = doWriteChunk( it.second, ChunkType::eSkeletonAnimationKeyFrameObjectTransform, m_chunk );
+				result = doWriteChunk( quantise( local.rotate ), ChunkType::eSkeletonAnimationKeyFrameObjectRotate, m_chunk );
+			}
+
+			if ( result )
+			{
+				result = doWriteChunk( local.scale, ChunkType::eSkeletonAnimationKeyFrameObjectScale, m_chunk );
 			}
 		}
 
@@ -43,6 +77,9 @@ namespace castor3d
 	{
 		bool result = true;
 		castor::Matrix4x4f matrix;
+		castor::Point3f translate;
+		std::array< int16_t, 4u > rotate{};
+		castor::Point3f scale;
 		double time{ 0.0 };
 		castor::String name;
 		uint8_t type{};
@@ -83,6 +120,30 @@ namespace castor3d
 				}
 				break;
 
+			case ChunkType::eSkeletonAnimationKeyFrameObjectTranslate:
+				result = doParseChunk( translate, chunk );
+				checkError( result, "Couldn't parse object translate." );
+				break;
+
+			case ChunkType::eSkeletonAnimationKeyFrameObjectRotate:
+				result = doParseChunk( rotate, chunk );
+				checkError( result, "Couldn't parse object rotate." );
+				break;
+
+			case ChunkType::eSkeletonAnimationKeyFrameObjectScale:
+				result = doParseChunk( scale, chunk );
+				checkError( result, "Couldn't parse object scale." );
+
+				if ( result )
+				{
+					obj.addAnimationObject( *obj.getOwner()->getObject( SkeletonAnimationObjectType( type )
+						, name )
+						, translate
+						, dequantise( rotate )
+						, scale );
+				}
+				break;
+
 			default:
 				break;
 			}
@@ -140,6 +140,7 @@ namespace castor3d
 		std::vector< VertexBoneData > bones;
 		std::vector< InterleavedVertex > vertices;
 		uint32_t count{ 0u };
+		uint32_t vertexCount{ 0u };
 		uint32_t components{ 0u };
 		uint32_t faceCount{ 0u };
 		uint32_t boneCount{ 0u };
@@ -158,22 +159,33 @@ namespace castor3d
 
 					if ( result )
 					{
-						vertices.resize( count );
+						vertexCount = count;
 					}
 				}
 				break;
 
 			case ChunkType::eSubmeshVertex:
-				if ( m_fileVersion > Version{ 1, 3, 0 } )
+				if ( m_fileVersion > Version{ 1, 3, 0 }
+					&& vertexCount > 0 )
 				{
-					result = doParseChunk( vertices, chunk );
-					checkError( result, "Couldn't parse vertex data." );
+					// Little endian chunks are used in place, big endian ones need conversion.
+					auto mapped = doMapChunk< InterleavedVertex >( vertexCount, chunk );
+
+					if ( !mapped )
+					{
+						vertices.resize( vertexCount );
+						result = doParseChunk( vertices, chunk );
+						checkError( result, "Couldn't parse vertex data." );
+						mapped = vertices.data();
+					}
 
-					if ( result && !vertices.empty() )
+					if ( result )
 					{
-						obj.addPoints( vertices );
+						obj.addPoints( mapped, mapped + vertexCount );
 					}
 				}
+
+				vertexCount = 0u;
 				break;
 
 			case ChunkType::eSubmeshBoneCount:
@@ -189,18 +201,27 @@ namespace castor3d
 				if ( result )
 				{
 					boneCount = count;
-					bones.resize( count );
 				}
 
 				break;
 
 			case ChunkType::eSubmeshBones:
-				result = doParseChunk( bones, chunk );
-				checkError( result, "Couldn't parse bones data." );
-
-				if ( result && boneCount > 0 )
+				if ( boneCount > 0 )
 				{
-					bonesComponent->addBoneDatas( bones );
+					auto mapped = doMapChunk< VertexBoneData >( boneCount, chunk );
+
+					if ( !mapped )
+					{
+						bones.resize( boneCount );
+						result = doParseChunk( bones, chunk );
+						checkError( result, "Couldn't parse bones data." );
+						mapped = bones.data();
+					}
+
+					if ( result )
+					{
+						bonesComponent->addBoneDatas( mapped, mapped + boneCount );
+					}
 				}
 
 				boneCount = 0u;
@@ -230,15 +251,6 @@ namespace castor3d
 				if ( result )
 				{
 					faceCount = count;
-
-					if ( components == 3u )
-					{
-						faces.resize( count );
-					}
-					else if ( components == 2u )
-					{
-						lines.resize( count );
-					}
 				}
 
 				break;
@@ -249,25 +261,39 @@ namespace castor3d
 				{
 					if ( components == 3u )
 					{
-						result = doParseChunk( faces, chunk );
-						checkError( result, "Couldn't parse index data." );
+						auto mapped = doMapChunk< FaceIndices >( faceCount, chunk );
+
+						if ( !mapped )
+						{
+							faces.resize( faceCount );
+							result = doParseChunk( faces, chunk );
+							checkError( result, "Couldn't parse index data." );
+							mapped = faces.data();
+						}
 
 						if ( result )
 						{
 							auto indexMapping = std::make_shared< TriFaceMapping >( obj );
-							indexMapping->addFaceGroup( faces );
+							indexMapping->addFaceGroup( mapped, mapped + faceCount );
 							obj.setIndexMapping( indexMapping );
 						}
 					}
 					else if ( components == 2u )
 					{
-						result = doParseChunk( lines, chunk );
-						checkError( result, "Couldn't parse index data." );
+						auto mapped = doMapChunk< LineIndices >( faceCount, chunk );
+
+						if ( !mapped )
+						{
+							lines.resize( faceCount );
+							result = doParseChunk( lines, chunk );
+							checkError( result, "Couldn't parse index data." );
+							mapped = lines.data();
+						}
 
 						if ( result )
 						{
 							auto indexMapping = std::make_shared< LinesMapping >( obj );
-							indexMapping->addLineGroup( lines );
+							indexMapping->addLineGroup( mapped, mapped + faceCount );
 							obj.setIndexMapping( indexMapping );
 						}
 					}
@@ -51,8 +51,7 @@ namespace castor3d
 
 	bool CmshImporter::doImportMesh( Mesh & mesh )
 	{
-		BinaryFile meshFile{ m_fileName, File::OpenMode::eRead };
-		auto result = BinaryParser< Mesh >{}.parse( mesh, meshFile );
+		auto result = BinaryParser< Mesh >{}.parse( mesh, m_fileName );
 
 		castor::PathArray files;
 		File::listDirectoryFiles( m_fileName.getPath(), files );
@@ -64,9 +63,8 @@ namespace castor3d
 				&& file.getFileName() == meshName )
 			{
 				auto skeleton = std::make_shared< Skeleton >( *mesh.getScene() );
-				BinaryFile skelFile{ m_fileName.getPath() / ( meshName + cuT( ".cskl" ) )
-					, File::OpenMode::eRead };
-				result = BinaryParser< Skeleton >{}.parse( *skeleton, skelFile );
+				result = BinaryParser< Skeleton >{}.parse( *skeleton
+					, m_fileName.getPath() / ( meshName + cuT( ".cskl" ) ) );
 
 				if ( result )
 				{
@@ -80,8 +78,7 @@ namespace castor3d
 					{
 						auto animName = cleanName( file.getFileName().substr( meshName.size() ) );
 						auto animation = std::make_unique< SkeletonAnimation >( *skeleton, animName );
-						BinaryFile animFile{ file, File::OpenMode::eRead };
-						result = BinaryParser< SkeletonAnimation >{}.parse( *animation, animFile );
+						result = BinaryParser< SkeletonAnimation >{}.parse( *animation, file );
 
 						if ( result )
 						{
@@ -96,8 +93,7 @@ namespace castor3d
 			{
 				auto animName = cleanName( file.getFileName().substr( meshName.size() ) );
 				auto animation = std::make_unique< MeshAnimation >( mesh, animName );
-				BinaryFile animFile{ file, File::OpenMode::eRead };
-				result = BinaryParser< MeshAnimation >{}.parse( *animation, animFile );
+				result = BinaryParser< MeshAnimation >{}.parse( *animation, file );
 
 				if ( result )
 				{
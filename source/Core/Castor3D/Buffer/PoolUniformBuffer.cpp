@@ -5,11 +5,13 @@
 #include "Castor3D/Render/RenderSystem.hpp"
 
 #include <algorithm>
+#include <cstring>
 
 namespace castor3d
 {
 	PoolUniformBuffer::PoolUniformBuffer( RenderSystem const & renderSystem
 		, castor::ArrayView< uint8_t > data
+		, castor::ArrayView< uint8_t > uploaded
 		, VkBufferUsageFlags usage
 		, VkMemoryPropertyFlags flags
 		, castor::String debugName
@@ -20,6 +22,7 @@ namespace castor3d
 		, m_sharingMode{ std::move( sharingMode ) }
 		, m_debugName{ std::move( debugName ) }
 		, m_data{ std::move( data ) }
+		, m_uploaded{ std::move( uploaded ) }
 	{
 		if ( m_renderSystem.hasCurrentRenderDevice() )
 		{
@@ -41,6 +44,12 @@ namespace castor3d
 			, m_usage | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT
 			, m_sharingMode );
 		m_buffer->bindMemory( setupMemory( device, *m_buffer, m_flags, m_debugName + "Ubo" ) );
+
+		for ( auto & chunk : m_allocated )
+		{
+			m_pending.insert( chunk.offset );
+		}
+
 		return uint32_t( m_buffer->getBuffer().getSize() );
 	}
 
@@ -65,6 +74,7 @@ namespace castor3d
 			: m_allocated.rbegin()->offset + m_allocated.rbegin()->size;
 		size = getAlignedSize( uint32_t( size ) );
 		m_allocated.insert( { offset, size } );
+		m_pending.insert( offset );
 		return { offset / elemSize, size / elemSize };
 	}
 
@@ -76,7 +86,33 @@ namespace castor3d
 
 		if ( it != m_allocated.end() )
 		{
+			m_pending.erase( it->offset );
 			m_allocated.erase( it );
 		}
 	}
+
+	void PoolUniformBuffer::gatherModifiedRanges( std::vector< MemChunk > & ranges )
+	{
+		for ( auto & chunk : m_allocated )
+		{
+			auto src = m_data.data() + chunk.offset;
+			auto dst = m_uploaded.data() + chunk.offset;
+
+			if ( m_pending.erase( chunk.offset )
+				|| std::memcmp( src, dst, chunk.size ) )
+			{
+				std::memcpy( dst, src, chunk.size );
+
+				if ( !ranges.empty()
+					&& ranges.back().offset + ranges.back().size == chunk.offset )
+				{
+					ranges.back().size += chunk.size;
+				}
+				else
+				{
+					ranges.push_back( chunk );
+				}
+			}
+		}
+	}
 }
@@ -1,12 +1,15 @@
 #include "Castor3D/Buffer/UniformBufferPool.hpp"
 
 #include "Castor3D/Engine.hpp"
+#include "Castor3D/Render/RenderInfo.hpp"
 #include "Castor3D/Render/RenderSystem.hpp"
 
 #include <ashespp/Buffer/StagingBuffer.hpp>
 #include <ashespp/Command/CommandBuffer.hpp>
 #include <ashespp/Core/Device.hpp>
 
+#include <cstring>
+
 namespace castor3d
 {
 	namespace  details
@@ -14,18 +17,19 @@ namespace castor3d
 		inline void copyBuffer( ashes::CommandBuffer const & commandBuffer
 			, ashes::BufferBase const & src
 			, ashes::BufferBase const & dst
-			, VkDeviceSize offset
-			, VkDeviceSize size
+			, std::vector< VkBufferCopy > const & copies
 			, VkPipelineStageFlags flags )
 		{
 			auto dstSrcStage = dst.getCompatibleStageFlags();
 			commandBuffer.memoryBarrier( dstSrcStage
 				, VK_PIPELINE_STAGE_TRANSFER_BIT
 				, dst.makeTransferDestination() );
-			commandBuffer.copyBuffer( src
-				, dst
-				, uint32_t( size )
-				, uint32_t( offset ) );
+
+			for ( auto & copy : copies )
+			{
+				commandBuffer.copyBuffer( copy, src, dst );
+			}
+
 			dstSrcStage = dst.getCompatibleStageFlags();
 			commandBuffer.memoryBarrier( dstSrcStage
 				, flags
@@ -54,37 +58,77 @@ namespace castor3d
 		{
 			m_stagingBuffer->getBuffer().unlock();
 			m_stagingBuffer.reset();
+			m_mappedData = nullptr;
+			m_hostData.clear();
+			m_uploadedData.clear();
 		}
 	}
 
-	void UniformBufferPool::upload( ashes::CommandBuffer const & commandBuffer )const
+	void UniformBufferPool::upload( ashes::CommandBuffer const & commandBuffer
+		, RenderInfo & info )
 	{
-		if ( m_stagingBuffer )
+		if ( !m_stagingBuffer )
 		{
-			m_stagingBuffer->getBuffer().flush( 0u, m_currentUboIndex * m_maxUboSize );
-			auto stgSrcStage = m_stagingBuffer->getBuffer().getCompatibleStageFlags();
-			commandBuffer.memoryBarrier( stgSrcStage
-				, VK_PIPELINE_STAGE_TRANSFER_BIT
-				, m_stagingBuffer->getBuffer().makeTransferSource() );
+			return;
+		}
+
+		// Only the modified ranges are copied, packed from the start of the staging buffer.
+		// The render loop waits for the previous frame before the upload, so the whole staging buffer is available.
+		std::vector< std::pair< ashes::BufferBase const *, std::vector< VkBufferCopy > > > copies;
+		std::vector< MemChunk > ranges;
+		VkDeviceSize stagingOffset = 0u;
 
-			for ( auto & bufferIt : m_buffers )
+		for ( auto & bufferIt : m_buffers )
+		{
+			for ( auto & buffer : bufferIt.second )
 			{
-				for ( auto & buffer : bufferIt.second )
+				ranges.clear();
+				buffer.buffer->gatherModifiedRanges( ranges );
+
+				if ( ranges.empty() )
 				{
-					details::copyBuffer( commandBuffer
-						, m_stagingBuffer->getBuffer()
-						, buffer.buffer->getBuffer().getBuffer()
-						, buffer.index * m_maxUboSize
-						, m_maxUboSize
-						, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT );
+					continue;
+				}
+
+				copies.emplace_back( &buffer.buffer->getBuffer().getBuffer(), std::vector< VkBufferCopy >{} );
+
+				for ( auto & range : ranges )
+				{
+					std::memcpy( m_mappedData + stagingOffset
+						, m_hostData.data() + buffer.index * m_maxUboSize + range.offset
+						, range.size );
+					copies.back().second.push_back( { stagingOffset, range.offset, range.size } );
+					stagingOffset += range.size;
 				}
 			}
+		}
+
+		info.m_uploadedUboBytes += uint32_t( stagingOffset );
 
-			auto stgDstStage = m_stagingBuffer->getBuffer().getCompatibleStageFlags();
-			commandBuffer.memoryBarrier( stgDstStage
-				, VK_PIPELINE_STAGE_HOST_BIT
-				, m_stagingBuffer->getBuffer().makeHostWrite() );
+		if ( copies.empty() )
+		{
+			return;
+		}
+
+		m_stagingBuffer->getBuffer().flush( 0u, stagingOffset );
+		auto stgSrcStage = m_stagingBuffer->getBuffer().getCompatibleStageFlags();
+		commandBuffer.memoryBarrier( stgSrcStage
+			, VK_PIPELINE_STAGE_TRANSFER_BIT
+			, m_stagingBuffer->getBuffer().makeTransferSource() );
+
+		for ( auto & copy : copies )
+		{
+			details::copyBuffer( commandBuffer
+				, m_stagingBuffer->getBuffer()
+				, *copy.first
+				, copy.second
+				, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT );
 		}
+
+		auto stgDstStage = m_stagingBuffer->getBuffer().getCompatibleStageFlags();
+		commandBuffer.memoryBarrier( stgDstStage
+			, VK_PIPELINE_STAGE_HOST_BIT
+			, m_stagingBuffer->getBuffer().makeHostWrite() );
 	}
 
 	uint32_t UniformBufferPool::getBufferCount()const
@@ -138,10 +182,13 @@ namespace castor3d
 			, VK_BUFFER_USAGE_TRANSFER_SRC_BIT
 			, m_maxUboSize * m_maxPoolUboCount
 			, sharingMode );
-		m_stagingData = reinterpret_cast< uint8_t * >( m_stagingBuffer->getBuffer().lock( 0u
+		m_mappedData = reinterpret_cast< uint8_t * >( m_stagingBuffer->getBuffer().lock( 0u
 			, m_maxUboSize * m_maxPoolUboCount
 			, 0u ) );
-		assert( m_stagingData );
+		assert( m_mappedData );
+		// The uniform buffers write to host memory, compared at upload time to what was last uploaded.
+		m_hostData.resize( size_t( m_maxUboSize ) * m_maxPoolUboCount );
+		m_uploadedData.resize( size_t( m_maxUboSize ) * m_maxPoolUboCount );
 	}
 
 	UniformBufferPool::BufferArray::iterator UniformBufferPool::doCreatePoolBuffer( VkMemoryPropertyFlags flags
@@ -159,8 +206,10 @@ namespace castor3d
 		};
 		auto index = m_maxUboSize * m_currentUboIndex;
 		auto buffer = makePoolUniformBuffer( renderSystem
-			, castor::makeArrayView( m_stagingData + index
-				, m_stagingData + index + m_maxUboSize )
+			, castor::makeArrayView( m_hostData.data() + index
+				, m_hostData.data() + index + m_maxUboSize )
+			, castor::makeArrayView( m_uploadedData.data() + index
+				, m_uploadedData.data() + index + m_maxUboSize )
 			, VK_BUFFER_USAGE_TRANSFER_DST_BIT
 			, flags
 			, m_debugName
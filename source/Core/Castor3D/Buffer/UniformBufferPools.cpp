@@ -36,7 +36,8 @@ namespace castor3d
 		}
 	}
 
-	void UniformBufferPools::upload( ashes::CommandBuffer const & cb )const
+	void UniformBufferPools::upload( ashes::CommandBuffer const & cb
+		, RenderInfo & info )
 	{
 		cb.beginDebugBlock(
 			{
@@ -46,7 +47,7 @@ namespace castor3d
 
 		for ( auto & pool : m_pools )
 		{
-			pool.upload( cb );
+			pool.upload( cb, info );
 		}
 
 		cb.endDebugBlock();
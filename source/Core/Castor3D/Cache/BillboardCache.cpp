@@ -260,6 +260,7 @@ namespace castor3d
 			auto element = m_elements.find( name );
 			m_detach( element );
 			m_elements.erase( name );
+			onElementRemoved( *element );
 			onChanged();
 			unregisterElement( *element );
 		}
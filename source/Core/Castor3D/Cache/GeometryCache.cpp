@@ -18,6 +18,7 @@
 #include "Castor3D/Scene/SceneNode.hpp"
 
 #include <CastorUtils/Miscellaneous/Hash.hpp>
+#include <CastorUtils/Multithreading/ParallelFor.hpp>
 
 using namespace castor;
 
@@ -52,6 +53,9 @@ namespace castor3d
 			FrameListener & m_listener;
 		};
 
+		// Minimal entries count per CPU job, a model update is a few matrices products and a 3x3 inverse.
+		size_t constexpr UpdateGrain = 64u;
+
 		castor::String printhex( uint64_t v )
 		{
 			auto stream = castor::makeStringStream();
@@ -207,29 +211,99 @@ namespace castor3d
 
 	void GeometryCache::update( CpuUpdater & updater )
 	{
-		for ( auto & pair : m_baseEntries )
+		std::unordered_set< SceneNode const * > dirtyNodes;
+		std::unordered_set< PoolsEntry * > dirtyEntries;
 		{
-			auto & entry = pair.second;
+			auto lock( castor::makeUniqueLock( m_dirtyMutex ) );
+			std::swap( dirtyNodes, m_dirtyNodes );
+			std::swap( dirtyEntries, m_newEntries );
 
-			if ( entry.geometry.getParent()
-				&& bool( entry.modelUbo ) )
+			// The entries that moved during the last update keep their current matrix, if they move again it is overwritten below.
+			for ( auto entry : m_movedEntries )
 			{
-				auto & modelData = entry.modelUbo.getData();
-				modelData.nodeId = entry.id;
-				modelData.shadowReceiver = entry.geometry.isShadowReceiver();
-				modelData.materialIndex = entry.pass.getId();
-
-				if ( entry.pass.hasEnvironmentMapping() )
+				if ( entry->modelUbo )
 				{
-					modelData.environmentIndex = getScene()->getEnvironmentMapIndex( *entry.geometry.getParent() ) + 1u;
+					auto & modelData = entry->modelUbo.getData();
+					modelData.prvModel = modelData.curModel;
 				}
+			}
+		}
+
+		std::vector< PoolsEntry * > moved;
+
+		if ( getScene()->hasChanged() )
+		{
+			// Materials, environment maps or shadow receivers may have changed, update everything.
+			moved.reserve( m_baseEntries.size() );
 
-				modelData.prvModel = modelData.curModel;
-				modelData.curModel = entry.geometry.getParent()->getDerivedTransformationMatrix();
-				auto normal = castor::Matrix3x3f{ modelData.curModel };
-				modelData.normal = castor::Matrix4x4f{ normal.getInverse().getTransposed() };
+			for ( auto & pair : m_baseEntries )
+			{
+				moved.push_back( &pair.second );
 			}
 		}
+		else
+		{
+			for ( auto node : dirtyNodes )
+			{
+				for ( auto & object : node->getObjects() )
+				{
+					if ( object.get().getType() != MovableType::eGeometry )
+					{
+						continue;
+					}
+
+					auto & geometry = static_cast< Geometry const & >( object.get() );
+
+					if ( !geometry.getMesh() )
+					{
+						continue;
+					}
+
+					for ( auto & submesh : *geometry.getMesh() )
+					{
+						if ( auto material = geometry.getMaterial( *submesh ) )
+						{
+							for ( auto & pass : *material )
+							{
+								auto it = m_baseEntries.find( hash( geometry, *submesh, *pass ) );
+
+								if ( it != m_baseEntries.end() )
+								{
+									dirtyEntries.insert( &it->second );
+								}
+							}
+						}
+					}
+				}
+			}
+
+			moved.assign( dirtyEntries.begin(), dirtyEntries.end() );
+		}
+
+		castor::parallelForEach( getScene()->getEngine()->getCpuJobs()
+			, moved.begin()
+			, moved.end()
+			, [this]( PoolsEntry * entry )
+			{
+				doUpdateEntry( *entry );
+			}
+			, UpdateGrain );
+
+		auto lock( castor::makeUniqueLock( m_dirtyMutex ) );
+		m_movedEntries.clear();
+		m_movedEntries.insert( moved.begin(), moved.end() );
+	}
+
+	void GeometryCache::markNodeDirty( SceneNode const & node )
+	{
+		auto lock( castor::makeUniqueLock( m_dirtyMutex ) );
+		m_dirtyNodes.insert( &node );
+	}
+
+	void GeometryCache::removeNode( SceneNode const & node )
+	{
+		auto lock( castor::makeUniqueLock( m_dirtyMutex ) );
+		m_dirtyNodes.erase( &node );
 	}
 
 	GeometryCache::PoolsEntry GeometryCache::getUbos( Geometry const & geometry
@@ -263,6 +337,10 @@ namespace castor3d
 		m_entries.clear();
 		m_baseEntries.clear();
 		m_instances.clear();
+		auto lock( castor::makeUniqueLock( m_dirtyMutex ) );
+		m_dirtyNodes.clear();
+		m_newEntries.clear();
+		m_movedEntries.clear();
 	}
 
 	void GeometryCache::add( ElementPtr element )
@@ -290,6 +368,7 @@ namespace castor3d
 			auto element = m_elements.find( name );
 			m_detach( element );
 			m_elements.erase( name );
+			onElementRemoved( *element );
 			onChanged();
 			doUnregister( *element );
 		}
@@ -314,6 +393,10 @@ namespace castor3d
 			auto & baseEntry = iresult.first->second;
 			baseEntry.id = m_baseEntries.size();
 			baseEntry.modelUbo = uboPools.getBuffer< ModelUboConfiguration >( VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT );
+			{
+				auto lock( castor::makeUniqueLock( m_dirtyMutex ) );
+				m_newEntries.insert( &baseEntry );
+			}
 
 			for ( auto instanceMult : m_instances )
 			{
@@ -358,12 +441,39 @@ namespace castor3d
 
 		if ( it != m_baseEntries.end() )
 		{
+			{
+				auto lock( castor::makeUniqueLock( m_dirtyMutex ) );
+				m_newEntries.erase( &it->second );
+				m_movedEntries.erase( &it->second );
+			}
 			auto entry = it->second;
 			m_baseEntries.erase( it );
 			uboPools.putBuffer( entry.modelUbo );
 		}
 	}
 
+	void GeometryCache::doUpdateEntry( PoolsEntry & entry )
+	{
+		if ( entry.geometry.getParent()
+			&& bool( entry.modelUbo ) )
+		{
+			auto & modelData = entry.modelUbo.getData();
+			modelData.nodeId = entry.id;
+			modelData.shadowReceiver = entry.geometry.isShadowReceiver();
+			modelData.materialIndex = entry.pass.getId();
+
+			if ( entry.pass.hasEnvironmentMapping() )
+			{
+				modelData.environmentIndex = getScene()->getEnvironmentMapIndex( *entry.geometry.getParent() ) + 1u;
+			}
+
+			modelData.prvModel = modelData.curModel;
+			modelData.curModel = entry.geometry.getParent()->getDerivedTransformationMatrix();
+			auto normal = castor::Matrix3x3f{ modelData.curModel };
+			modelData.normal = castor::Matrix4x4f{ normal.getInverse().getTransposed() };
+		}
+	}
+
 	void GeometryCache::doRegister( Geometry & geometry )
 	{
 		auto & device = *getScene()->getEngine()->getRenderSystem()->getMainRenderDevice();
@@ -158,6 +158,7 @@ namespace castor3d
 				else
 				{
 					m_elements.insert( name, element );
+					onElementAdded( *element );
 					onChanged();
 				}
 			}
@@ -190,6 +191,7 @@ namespace castor3d
 						{
 							onLightChanged( light );
 						} ) );
+				onElementAdded( *result );
 				onChanged();
 			}
 		}
@@ -212,6 +214,7 @@ namespace castor3d
 			m_detach( element );
 			m_connections.erase( element.get() );
 			m_elements.erase( name );
+			onElementRemoved( *element );
 			onChanged();
 		}
 	}
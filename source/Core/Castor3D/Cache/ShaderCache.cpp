@@ -3,9 +3,14 @@
 #include "Castor3D/Engine.hpp"
 #include "Castor3D/Event/Frame/CleanupEvent.hpp"
 #include "Castor3D/Event/Frame/InitialiseEvent.hpp"
+#include "Castor3D/Miscellaneous/Logger.hpp"
+#include "Castor3D/Render/PipelineManifest.hpp"
 #include "Castor3D/Render/RenderPass.hpp"
 #include "Castor3D/Render/RenderSystem.hpp"
 #include "Castor3D/Shader/Program.hpp"
+#include "Castor3D/Shader/Shaders/GlslLighting.hpp"
+
+#include <CastorUtils/Miscellaneous/Hash.hpp>
 
 #include <ShaderWriter/Source.hpp>
 
@@ -13,6 +18,23 @@
 
 namespace castor3d
 {
+	namespace
+	{
+		uint64_t makeProgramKey( Engine const & engine
+			, SceneRenderPass const & renderPass
+			, PipelineFlags const & flags )
+		{
+			// The pass type ID depends on the plugins registration order, the shaders depend on the lighting model it designates.
+			auto keyFlags = flags;
+			keyFlags.passType = 0u;
+			auto result = hash( keyFlags );
+			castor::hashCombine( result, shader::getLightingModelName( engine, flags.passType ) );
+			castor::hashCombine( result, renderPass.getName() );
+			castor::hashCombine( result, renderPass.getShaderInputsHash() );
+			return uint64_t( result );
+		}
+	}
+
 	ShaderProgramCache::ShaderProgramCache( Engine & engine )
 		: OwnedBy< Engine >( engine )
 	{
@@ -38,37 +60,175 @@ namespace castor3d
 		return result;
 	}
 
-	ShaderProgramSPtr ShaderProgramCache::doFindAutomaticProgram( PipelineFlags const & flags )
+	void ShaderProgramCache::setDiskCacheFolder( castor::Path folder )
 	{
-		auto it = std::find_if( m_autogenerated.begin()
-			, m_autogenerated.end()
-			, [&flags]( AutoGeneratedProgram const & lookup )
-			{
-				return lookup.flags == flags;
-			} );
+		auto lock( castor::makeUniqueLock( m_mutex ) );
+		m_diskCache = SpirVCache{ std::move( folder ) };
+	}
+
+	void ShaderProgramCache::setPipelineManifestFile( castor::Path file )
+	{
+		std::shared_ptr< PipelineManifest > manifest;
 
-		if ( it != m_autogenerated.end() )
+		if ( !file.empty() )
 		{
-			return it->program;
+			manifest = std::make_shared< PipelineManifest >( std::move( file ) );
+			manifest->load();
 		}
 
-		return nullptr;
+		auto lock( castor::makeUniqueLock( m_mutex ) );
+		std::swap( m_manifest, manifest );
+
+		if ( manifest )
+		{
+			manifest->save();
+		}
 	}
 
-	ShaderProgramSPtr ShaderProgramCache::getAutomaticProgram( SceneRenderPass const & renderPass
-		, PipelineFlags const & flags )
+	void ShaderProgramCache::savePipelineManifest()
 	{
 		auto lock( castor::makeUniqueLock( m_mutex ) );
-		auto result = doFindAutomaticProgram( flags );
 
-		if ( result )
+		if ( m_manifest )
+		{
+			auto stats = m_manifest->getStatistics();
+			log::info << "PipelineManifest: " << stats.loaded << " loaded, "
+				<< stats.hits << " hits, "
+				<< stats.misses << " misses, "
+				<< stats.prewarmed << " prewarmed." << std::endl;
+			m_manifest->save();
+		}
+	}
+
+	std::vector< castor::AsyncJobQueue::Handle > ShaderProgramCache::prewarmAutomaticPrograms( SceneRenderPass const & renderPass )
+	{
+		std::vector< castor::AsyncJobQueue::Handle > result;
+		std::shared_ptr< PipelineManifest > manifest;
+		{
+			auto lock( castor::makeUniqueLock( m_mutex ) );
+			manifest = m_manifest;
+		}
+
+		if ( !manifest )
 		{
 			return result;
 		}
 
-		result = doCreateAutomaticProgram( renderPass, flags );
-		CU_Require( result );
-		doAddAutomaticProgram( result, flags );
+		for ( auto & flags : manifest->getVariants( renderPass.getName() ) )
+		{
+			result.push_back( getEngine()->pushJob( [this, &renderPass, flags, manifest]()
+				{
+					try
+					{
+						SpirVCache diskCache;
+						std::shared_ptr< PipelineManifest > current;
+						auto entry = doFindAutomaticProgram( flags, diskCache, current );
+						bool created{};
+						doGetAutomaticProgram( renderPass, flags, *entry, diskCache, created );
+
+						if ( created )
+						{
+							manifest->notifyPrewarmed();
+						}
+					}
+					catch ( std::exception & exc )
+					{
+						log::warn << "PipelineManifest: Couldn't prewarm a program for [" << renderPass.getName() << "]: " << exc.what() << std::endl;
+					}
+				} ) );
+		}
+
+		return result;
+	}
+
+	ShaderProgramCache::AutoGeneratedProgramPtr ShaderProgramCache::doFindAutomaticProgram( PipelineFlags const & flags
+		, SpirVCache & diskCache
+		, std::shared_ptr< PipelineManifest > & manifest )
+	{
+		auto lock( castor::makeUniqueLock( m_mutex ) );
+		diskCache = m_diskCache;
+		manifest = m_manifest;
+		auto & result = m_autogenerated.emplace( flags, nullptr ).first->second;
+
+		if ( !result )
+		{
+			result = std::make_shared< AutoGeneratedProgram >();
+		}
+
+		return result;
+	}
+
+	ShaderProgramSPtr ShaderProgramCache::getAutomaticProgram( SceneRenderPass const & renderPass
+		, PipelineFlags const & flags )
+	{
+		SpirVCache diskCache;
+		std::shared_ptr< PipelineManifest > manifest;
+		auto entry = doFindAutomaticProgram( flags, diskCache, manifest );
+
+		if ( manifest )
+		{
+			manifest->record( renderPass.getName(), flags );
+		}
+
+		bool created{};
+		return doGetAutomaticProgram( renderPass, flags, *entry, diskCache, created );
+	}
+
+	ShaderProgramSPtr ShaderProgramCache::doGetAutomaticProgram( SceneRenderPass const & renderPass
+		, PipelineFlags const & flags
+		, AutoGeneratedProgram & entry
+		, SpirVCache const & diskCache
+		, bool & created )
+	{
+		// The global lock only protects the index, the program itself is generated under its entry's lock.
+		auto lock( castor::makeUniqueLock( entry.mutex ) );
+
+		if ( entry.program )
+		{
+			return entry.program;
+		}
+
+		auto key = makeProgramKey( *getEngine(), renderPass, flags );
+		auto result = doLoadAutomaticProgram( renderPass, diskCache, key );
+
+		if ( !result )
+		{
+			result = doCreateAutomaticProgram( renderPass, flags );
+			CU_Require( result );
+			doSaveAutomaticProgram( *result, diskCache, key );
+		}
+
+		{
+			auto globalLock( castor::makeUniqueLock( m_mutex ) );
+			doAddProgram( result );
+		}
+
+		entry.program = result;
+		created = true;
+		return result;
+	}
+
+	ShaderProgramSPtr ShaderProgramCache::doLoadAutomaticProgram( SceneRenderPass const & renderPass
+		, SpirVCache const & diskCache
+		, uint64_t key )const
+	{
+		SpirVCache::Stages stages;
+
+		if ( !diskCache.load( key, stages )
+			|| stages.end() == stages.find( VK_SHADER_STAGE_VERTEX_BIT )
+			|| stages.end() == stages.find( VK_SHADER_STAGE_FRAGMENT_BIT ) )
+		{
+			return nullptr;
+		}
+
+		ShaderProgramSPtr result = std::make_shared< ShaderProgram >( renderPass.getName(), *getEngine()->getRenderSystem() );
+
+		for ( auto & stage : stages )
+		{
+			result->setSource( stage.first
+				, SpirVShader{ std::move( stage.second ), {} } );
+		}
+
 		return result;
 	}
 
@@ -91,11 +251,26 @@ namespace castor3d
 		return result;
 	}
 
-	void ShaderProgramCache::doAddAutomaticProgram( ShaderProgramSPtr program
-		, PipelineFlags const & flags )
+	void ShaderProgramCache::doSaveAutomaticProgram( ShaderProgram const & program
+		, SpirVCache const & diskCache
+		, uint64_t key )const
 	{
-		m_autogenerated.push_back( { flags, program } );
-		doAddProgram( program );
+		if ( !diskCache.isEnabled() )
+		{
+			return;
+		}
+
+		SpirVCache::Stages stages;
+
+		for ( auto stage : { VK_SHADER_STAGE_VERTEX_BIT, VK_SHADER_STAGE_GEOMETRY_BIT, VK_SHADER_STAGE_FRAGMENT_BIT } )
+		{
+			if ( program.hasSource( stage ) )
+			{
+				stages.emplace( stage, program.getCompiled( stage ).spirv );
+			}
+		}
+
+		diskCache.save( key, stages );
 	}
 
 	void ShaderProgramCache::doAddProgram( ShaderProgramSPtr program )
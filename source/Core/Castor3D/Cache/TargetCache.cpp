@@ -1,7 +1,10 @@
 #include "Castor3D/Cache/TargetCache.hpp"
 
+#include "Castor3D/Engine.hpp"
 #include "Castor3D/Render/RenderTarget.hpp"
 
+#include <CastorUtils/Multithreading/TaskGraph.hpp>
+
 using namespace castor;
 
 namespace castor3d
@@ -9,6 +12,35 @@ namespace castor3d
 	namespace
 	{
 		using LockType = std::unique_lock< RenderTargetCache >;
+
+		struct SceneTargets
+		{
+			Scene const * scene;
+			std::vector< RenderTargetSPtr > textures;
+			std::vector< RenderTargetSPtr > windows;
+			CpuUpdater updater;
+		};
+
+		SceneTargets & getSceneTargets( std::vector< SceneTargets > & scenes
+			, RenderTarget const & target
+			, CpuUpdater const & updater )
+		{
+			auto scene = target.getScene().get();
+			auto it = std::find_if( scenes.begin()
+				, scenes.end()
+				, [scene]( SceneTargets const & lookup )
+				{
+					return lookup.scene == scene;
+				} );
+
+			if ( it == scenes.end() )
+			{
+				scenes.push_back( { scene, {}, {}, updater } );
+				it = std::prev( scenes.end() );
+			}
+
+			return *it;
+		}
 	}
 
 	RenderTargetCache::RenderTargetCache( Engine & engine )
@@ -48,16 +80,58 @@ namespace castor3d
 	void RenderTargetCache::update( CpuUpdater & updater )
 	{
 		LockType lock{ castor::makeUniqueLock( *this ) };
+		auto & textures = m_renderTargets[size_t( TargetType::eTexture )];
+		auto & windows = m_renderTargets[size_t( TargetType::eWindow )];
+		// The targets of a same scene share its state (cameras, nodes, culling data), they are updated serially.
+		// Only the targets of different scenes are updated concurrently.
+		std::vector< SceneTargets > scenes;
 
-		for ( auto target : m_renderTargets[size_t( TargetType::eTexture )] )
+		for ( auto & target : textures )
 		{
-			target->update( updater );
+			getSceneTargets( scenes, *target, updater ).textures.push_back( target );
 		}
 
-		for ( auto target : m_renderTargets[size_t( TargetType::eWindow )] )
+		for ( auto & target : windows )
 		{
-			target->update( updater );
+			getSceneTargets( scenes, *target, updater ).windows.push_back( target );
 		}
+
+		castor::TaskGraph graph;
+		std::vector< castor::TaskGraph::TaskId > textureTasks;
+
+		for ( auto & sceneTargets : scenes )
+		{
+			if ( !sceneTargets.textures.empty() )
+			{
+				textureTasks.push_back( graph.add( [&sceneTargets]()
+					{
+						for ( auto & target : sceneTargets.textures )
+						{
+							target->update( sceneTargets.updater );
+						}
+					} ) );
+			}
+		}
+
+		// Window targets may display texture targets, from any scene, keep them updated after these.
+		for ( auto & sceneTargets : scenes )
+		{
+			if ( !sceneTargets.windows.empty() )
+			{
+				graph.add( [&sceneTargets]()
+					{
+						for ( auto & target : sceneTargets.windows )
+						{
+							target->update( sceneTargets.updater );
+						}
+					}
+					, textureTasks );
+			}
+		}
+
+		graph.run( getEngine()->getCpuJobs() );
+		// The only result a target writes in its updater is its own camera, which is of no use outside of it.
+		// Hence the given updater is left untouched, the techniques set their camera themselves.
 	}
 
 	void RenderTargetCache::update( GpuUpdater & updater )
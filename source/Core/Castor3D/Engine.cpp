@@ -42,6 +42,7 @@
 #include <CastorUtils/Graphics/StbImageWriter.hpp>
 #include <CastorUtils/Graphics/XpmImageLoader.hpp>
 #include <CastorUtils/Miscellaneous/DynamicLibrary.hpp>
+#include <CastorUtils/Multithreading/TaskGraph.hpp>
 #include <CastorUtils/Pool/UniqueObjectPool.hpp>
 
 #include "Castor3D/Shader/GlslToSpv.hpp"
@@ -88,6 +89,7 @@ namespace castor3d
 		, m_particleFactory{ castor::makeUnique< ParticleFactory >() }
 		, m_enableApiTrace{ C3D_EnableAPITrace }
 		, m_jobs{ castor::CpuInformations{}.getCoreCount() }
+		, m_cpuJobs{ std::max( 2u, castor::CpuInformations{}.getCoreCount() - 1u ) }
 	{
 		m_passFactory = castor::makeUnique< PassFactory >( *this );
 		m_passesType = m_passFactory->listRegisteredTypes().begin()->second;
@@ -361,6 +363,7 @@ namespace castor3d
 
 			m_renderLoop.reset();
 
+			m_shaderCache->savePipelineManifest();
 			m_targetCache->clear();
 			m_samplerCache->clear();
 			m_shaderCache->clear();
@@ -436,25 +439,48 @@ namespace castor3d
 
 	void Engine::update( CpuUpdater & updater )
 	{
-		for ( auto & window : m_renderWindows )
-		{
-			window.second->update( updater );
-		}
-
-		getMaterialCache().update( updater );
-		getSceneCache().forEach( [&updater]( Scene & scene )
+		castor::TaskGraph graph;
+		auto windows = graph.add( [this, &updater]()
 			{
-				scene.update( updater );
+				for ( auto & window : m_renderWindows )
+				{
+					window.second->update( updater );
+				}
 			} );
-		getRenderTargetCache().update( updater );
-		getRenderTechniqueCache().forEach( [&updater]( RenderTechnique & technique )
+		auto materials = graph.add( [this, &updater]()
+			{
+				getMaterialCache().update( updater );
+			}
+			, { windows } );
+		// Scenes don't depend on each other, only on materials.
+		std::vector< castor::TaskGraph::TaskId > scenes;
+		getSceneCache().forEach( [&graph, &updater, &scenes, materials]( Scene & scene )
 			{
-				TechniqueQueues techniqueQueues;
-				updater.queues = &techniqueQueues.queues;
-				technique.update( updater );
-				techniqueQueues.shadowMaps = technique.getShadowMaps();
-				updater.techniquesQueues.push_back( techniqueQueues );
+				scenes.push_back( graph.add( [&scene, &updater]()
+					{
+						scene.update( updater );
+					}
+					, { materials } ) );
 			} );
+		scenes.push_back( materials );
+		auto targets = graph.add( [this, &updater]()
+			{
+				getRenderTargetCache().update( updater );
+			}
+			, scenes );
+		graph.add( [this, &updater]()
+			{
+				getRenderTechniqueCache().forEach( [&updater]( RenderTechnique & technique )
+					{
+						TechniqueQueues techniqueQueues;
+						updater.queues = &techniqueQueues.queues;
+						technique.update( updater );
+						techniqueQueues.shadowMaps = technique.getShadowMaps();
+						updater.techniquesQueues.push_back( techniqueQueues );
+					} );
+			}
+			, { targets } );
+		graph.run( m_cpuJobs );
 	}
 
 	void Engine::update( GpuUpdater & updater )
@@ -670,20 +696,24 @@ namespace castor3d
 		pushJob( [&pass]()
 			{
 				pass.prepareTextures();
-			} );
+			}
+			, castor::JobPriority::eStreaming );
 	}
 
-	void Engine::pushJob( castor::AsyncJobQueue::Job job )
+	castor::AsyncJobQueue::Handle Engine::pushJob( castor::AsyncJobQueue::Job job
+		, castor::JobPriority priority )
 	{
-		m_jobs.pushJob( job );
+		return m_jobs.pushJob( std::move( job ), priority );
 	}
 
-	void Engine::pushGpuJob( std::function< void( RenderDevice const & ) > job )
+	castor::AsyncJobQueue::Handle Engine::pushGpuJob( std::function< void( RenderDevice const & ) > job
+		, castor::JobPriority priority )
 	{
-		pushJob( [this, job]()
+		return pushJob( [this, job]()
 			{
 				job( *m_renderSystem->getMainRenderDevice() );
-			} );
+			}
+			, priority );
 	}
 
 	void Engine::doLoadCoreData()
@@ -1356,38 +1356,44 @@ namespace castor3d
 	{
 		if ( !m_texturesReduced )
 		{
-			for ( auto & unit : m_textureUnits )
-			{
-				auto configuration = unit->getConfiguration();
+			// Passes are shared between render queues, which are parsed concurrently.
+			auto lock( castor::makeUniqueLock( m_texturesMutex ) );
 
-				if ( unit->getRenderTarget() )
-				{
-					configuration.needsGammaCorrection = 0u;
-				}
-				else if ( configuration.colourMask[0]
-					|| configuration.emissiveMask[0] )
+			if ( !m_texturesReduced )
+			{
+				for ( auto & unit : m_textureUnits )
 				{
-					auto format = unit->getTexture()->getPixelFormat();
-					configuration.needsGammaCorrection = !isFloatingPoint( convert( format ) );
-				}
+					auto configuration = unit->getConfiguration();
 
-				unit->setConfiguration( configuration );
-			}
+					if ( unit->getRenderTarget() )
+					{
+						configuration.needsGammaCorrection = 0u;
+					}
+					else if ( configuration.colourMask[0]
+						|| configuration.emissiveMask[0] )
+					{
+						auto format = unit->getTexture()->getPixelFormat();
+						configuration.needsGammaCorrection = !isFloatingPoint( convert( format ) );
+					}
 
-			TextureUnitPtrArray newUnits;
-			doJoinNmlHgt( newUnits );
-			doJoinEmsOcc( newUnits );
-			doPrepareTextures( newUnits );
-			m_textureUnits = newUnits;
+					unit->setConfiguration( configuration );
+				}
 
-			std::sort( m_textureUnits.begin()
-				, m_textureUnits.end()
-				, []( TextureUnitSPtr const & lhs, TextureUnitSPtr const & rhs )
-				{
-					return lhs->getFlags() < rhs->getFlags();
-				} );
+				TextureUnitPtrArray newUnits;
+				doJoinNmlHgt( newUnits );
+				doJoinEmsOcc( newUnits );
+				doPrepareTextures( newUnits );
+				m_textureUnits = newUnits;
 
-			m_texturesReduced = true;
+				std::sort( m_textureUnits.begin()
+					, m_textureUnits.end()
+					, []( TextureUnitSPtr const & lhs, TextureUnitSPtr const & rhs )
+					{
+						return lhs->getFlags() < rhs->getFlags();
+					} );
+
+				m_texturesReduced = true;
+			}
 		}
 	}
 
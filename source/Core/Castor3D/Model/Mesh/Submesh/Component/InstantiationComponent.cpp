@@ -227,6 +227,7 @@ namespace castor3d
 								, 0u
 								, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
 								, getOwner()->getParent().getName() + "Submesh" + castor::string::toString( getOwner()->getId() ) + "InstantiationComponentBufferMult" + string::toString( index ) );
+							data.data.resize( data.count );
 						}
 
 						++index;
@@ -261,23 +262,22 @@ namespace castor3d
 
 	void InstantiationComponent::doUpload()
 	{
-		for ( auto & data : m_instances )
+		for ( auto & datas : m_instances )
 		{
-			for ( auto & datas : m_instances )
+			for ( auto & data : datas.second )
 			{
-				for ( auto & data : datas.second )
+				if ( data.buffer
+					&& data.count )
 				{
-					if ( data.buffer
-						&& data.count )
+					auto count = std::min< VkDeviceSize >( data.data.size(), data.buffer->getCount() );
+
+					if ( auto * buffer = data.buffer->lock( 0u
+						, count
+						, 0u ) )
 					{
-						if ( auto * buffer = reinterpret_cast< InstantiationData * >( data.buffer->getBuffer().lock( 0
-							, ~( 0ull )
-							, 0u ) ) )
-						{
-							std::copy( data.data.begin(), data.data.end(), buffer );
-							data.buffer->getBuffer().flush( 0u, ~( 0ull ) );
-							data.buffer->getBuffer().unlock();
-						}
+						std::copy( data.data.begin(), data.data.begin() + ptrdiff_t( count ), buffer );
+						data.buffer->flush( 0u, count );
+						data.buffer->unlock();
 					}
 				}
 			}
@@ -407,6 +407,8 @@ namespace castor3d
 		, TextureFlagsArray const & mask )const
 	{
 		auto key = hash( material, flags, mask );
+		// Render queues are parsed concurrently, and share the submeshes.
+		auto lock( castor::makeUniqueLock( m_geometryBuffersMutex ) );
 		auto it = m_geometryBuffers.find( key );
 
 		if ( it == m_geometryBuffers.end() )
@@ -2,6 +2,7 @@
 
 #include "Castor3D/Miscellaneous/Logger.hpp"
 #include "Castor3D/Model/Skeleton/Animation/SkeletonAnimationBone.hpp"
+#include "Castor3D/Model/Skeleton/Animation/SkeletonAnimationKeyFrame.hpp"
 #include "Castor3D/Model/Skeleton/Animation/SkeletonAnimationNode.hpp"
 #include "Castor3D/Model/Skeleton/Bone.hpp"
 
@@ -22,6 +23,64 @@ namespace castor3d
 			};
 			return names.at( type );
 		}
+
+		ObjectTrs const * findLocal( SkeletonAnimationKeyFrame const & keyFrame
+			, size_t index
+			, SkeletonAnimationObject const * object )
+		{
+			auto & locals = keyFrame.getLocalTransforms();
+
+			// The keyframes usually hold the objects in the same order.
+			if ( index < locals.size() && locals[index].object == object )
+			{
+				return &locals[index];
+			}
+
+			auto it = std::find_if( locals.begin()
+				, locals.end()
+				, [object]( ObjectTrs const & lookup )
+				{
+					return lookup.object == object;
+				} );
+			return it == locals.end()
+				? nullptr
+				: &( *it );
+		}
+
+		bool isInterpolated( SkeletonAnimationKeyFrame const & prv
+			, SkeletonAnimationKeyFrame const & nxt
+			, SkeletonAnimationKeyFrame const & cur
+			, float tolerance
+			, float cosHalfAngleTolerance )
+		{
+			auto factor = float( ( cur.getTimeIndex() - prv.getTimeIndex() ).count() )
+				/ float( ( nxt.getTimeIndex() - prv.getTimeIndex() ).count() );
+			auto & locals = cur.getLocalTransforms();
+
+			for ( size_t i = 0u; i < locals.size(); ++i )
+			{
+				auto & local = locals[i];
+				auto lhs = findLocal( prv, i, local.object );
+				auto rhs = findLocal( nxt, i, local.object );
+
+				if ( !lhs || !rhs )
+				{
+					return false;
+				}
+
+				auto interpolated = interpolateTransform( *lhs, *rhs, factor );
+
+				if ( point::distance( interpolated.translate, local.translate ) > tolerance
+					|| point::distance( interpolated.scale, local.scale ) > tolerance
+					// Both q and -q are the same rotation.
+					|| std::abs( point::dot( interpolated.rotate, local.rotate ) ) < cosHalfAngleTolerance )
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
 	}
 
 	//*************************************************************************************************
@@ -83,6 +142,61 @@ namespace castor3d
 		return m_toMove.find( getMovingTypeName( type ) + name ) != m_toMove.end();
 	}
 
+	uint32_t SkeletonAnimation::reduceKeyFrames( float tolerance
+		, castor::Angle const & angleTolerance )
+	{
+		if ( m_keyframes.size() < 3u )
+		{
+			return 0u;
+		}
+
+		auto cosHalfAngleTolerance = float( std::cos( angleTolerance.radians() / 2.0f ) );
+		auto keyFrame = [this]( size_t index )-> SkeletonAnimationKeyFrame const &
+		{
+			return static_cast< SkeletonAnimationKeyFrame const & >( *m_keyframes[index] );
+		};
+		std::vector< bool > removed( m_keyframes.size(), false );
+		size_t lastKept = 0u;
+
+		// A keyframe is removed if it and all the ones removed since the last kept keyframe
+		// are rebuilt by interpolating the last kept keyframe and the following one.
+		for ( size_t i = 1u; i + 1u < m_keyframes.size(); ++i )
+		{
+			bool removable = true;
+
+			for ( size_t j = lastKept + 1u; j <= i && removable; ++j )
+			{
+				removable = isInterpolated( keyFrame( lastKept )
+					, keyFrame( i + 1u )
+					, keyFrame( j )
+					, tolerance
+					, cosHalfAngleTolerance );
+			}
+
+			if ( removable )
+			{
+				removed[i] = true;
+			}
+			else
+			{
+				lastKept = i;
+			}
+		}
+
+		uint32_t result = 0u;
+		size_t index = 0u;
+		auto end = std::remove_if( m_keyframes.begin()
+			, m_keyframes.end()
+			, [&removed, &index, &result]( AnimationKeyFrameUPtr const & )
+			{
+				bool remove = removed[index++];
+				result += remove ? 1u : 0u;
+				return remove;
+			} );
+		m_keyframes.erase( end, m_keyframes.end() );
+		return result;
+	}
+
 	SkeletonAnimationObjectSPtr SkeletonAnimation::getObject( Bone const & bone )const
 	{
 		return getObject( SkeletonAnimationObjectType::eBone, bone.getName() );
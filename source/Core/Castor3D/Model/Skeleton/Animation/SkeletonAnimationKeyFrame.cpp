@@ -70,38 +70,17 @@ namespace castor3d
 		, castor::Quaternion const & rotate
 		, castor::Point3f const & scale )
 	{
-		castor::Matrix4x4f transform{ 1.0f };
-		castor::matrix::translate( transform, translate );
-		doRotate( transform, rotate );
-		castor::matrix::scale( transform, scale );
-		addAnimationObject( object, transform );
+		doAddAnimationObject( object
+			, composeTransform( translate, rotate, scale )
+			, ObjectTrs{ &object, translate, rotate, scale } );
 	}
 
 	void SkeletonAnimationKeyFrame::addAnimationObject( SkeletonAnimationObject & object
 		, castor::Matrix4x4f const & transform )
 	{
-		auto findTransform = [this]( SkeletonAnimationObject & object )
-		{
-			return std::find_if( m_transforms.begin()
-				, m_transforms.end()
-				, [&object]( auto const & lookup )
-				{
-					return lookup.first == &object;
-				} );
-		};
-		auto it = findTransform( object );
-
-		if ( it == m_transforms.end() )
-		{
-			auto parent = object.getParent();
-
-			if ( parent && findTransform( *parent ) == m_transforms.end() )
-			{
-				addAnimationObject( *parent, parent->getNodeTransform() );
-			}
-
-			m_transforms.emplace_back( &object, transform );
-		}
+		ObjectTrs local{ &object };
+		decomposeTransform( transform, local.translate, local.rotate, local.scale );
+		doAddAnimationObject( object, transform, local );
 	}
 
 	bool SkeletonAnimationKeyFrame::hasObject( SkeletonAnimationObject const & object )const
@@ -135,6 +114,35 @@ namespace castor3d
 		} );
 	}
 
+	void SkeletonAnimationKeyFrame::doAddAnimationObject( SkeletonAnimationObject & object
+		, castor::Matrix4x4f const & transform
+		, ObjectTrs const & local )
+	{
+		auto findTransform = [this]( SkeletonAnimationObject & object )
+		{
+			return std::find_if( m_transforms.begin()
+				, m_transforms.end()
+				, [&object]( auto const & lookup )
+				{
+					return lookup.first == &object;
+				} );
+		};
+		auto it = findTransform( object );
+
+		if ( it == m_transforms.end() )
+		{
+			auto parent = object.getParent();
+
+			if ( parent && findTransform( *parent ) == m_transforms.end() )
+			{
+				addAnimationObject( *parent, parent->getNodeTransform() );
+			}
+
+			m_transforms.emplace_back( &object, transform );
+			m_locals.push_back( local );
+		}
+	}
+
 	void SkeletonAnimationKeyFrame::initialise()
 	{
 		m_cumulative.clear();
@@ -157,4 +165,50 @@ namespace castor3d
 	}
 
 	//*************************************************************************************************
+
+	castor::Matrix4x4f composeTransform( castor::Point3f const & translate
+		, castor::Quaternion const & rotate
+		, castor::Point3f const & scale )
+	{
+		castor::Matrix4x4f result{ 1.0f };
+		castor::matrix::translate( result, translate );
+		doRotate( result, rotate );
+		castor::matrix::scale( result, scale );
+		return result;
+	}
+
+	void decomposeTransform( castor::Matrix4x4f const & transform
+		, castor::Point3f & translate
+		, castor::Quaternion & rotate
+		, castor::Point3f & scale )
+	{
+		castor::Matrix4x4f rotation{ 1.0f };
+
+		for ( uint32_t i = 0u; i < 3u; ++i )
+		{
+			auto & column = transform[i];
+			scale[i] = float( castor::point::length( castor::Point3f{ column[0], column[1], column[2] } ) );
+			auto invScale = scale[i] == 0.0f
+				? 0.0f
+				: 1.0f / scale[i];
+			rotation[i][0] = column[0] * invScale;
+			rotation[i][1] = column[1] * invScale;
+			rotation[i][2] = column[2] * invScale;
+		}
+
+		translate = castor::Point3f{ transform[3][0], transform[3][1], transform[3][2] };
+		rotate = castor::Quaternion::fromMatrix( rotation );
+	}
+
+	ObjectTrs interpolateTransform( ObjectTrs const & lhs
+		, ObjectTrs const & rhs
+		, float factor )
+	{
+		return ObjectTrs{ lhs.object
+			, lhs.translate + ( rhs.translate - lhs.translate ) * factor
+			, lhs.rotate.slerp( rhs.rotate, factor )
+			, lhs.scale + ( rhs.scale - lhs.scale ) * factor };
+	}
+
+	//*************************************************************************************************
 }
@@ -203,8 +203,9 @@ namespace castor3d
 
 	void DebugOverlays::PassOverlays::update()
 	{
-		m_cpu.time = 0_ns;
+		m_cpu.time = m_cpuOnlyTime;
 		m_gpu.time = 0_ns;
+		m_cpuOnlyTime = 0_ns;
 
 		for ( auto timer : m_timers )
 		{
@@ -481,6 +482,33 @@ namespace castor3d
 		return m_passes.empty();
 	}
 
+	bool DebugOverlays::CategoryOverlays::addCpuTime( castor::String const & name
+		, castor::Nanoseconds time )
+	{
+		auto it = std::find_if( m_passes.begin()
+			, m_passes.end()
+			, [&name]( auto const & lookup )
+			{
+				return lookup->getName() == name;
+			} );
+		bool added = it == m_passes.end();
+
+		if ( added )
+		{
+			auto index = uint32_t( m_passes.size() );
+			m_passes.emplace_back( std::make_unique< PassOverlays >( m_cache
+				, m_container->getOverlay().shared_from_this()
+				, m_categoryName
+				, name
+				, index
+				, m_detailed ) );
+			it = m_passes.begin() + m_passes.size() - 1;
+		}
+
+		( *it )->addCpuTime( time );
+		return added;
+	}
+
 	void DebugOverlays::CategoryOverlays::update()
 	{
 		m_cpu.time = 0_ns;
@@ -630,6 +658,31 @@ namespace castor3d
 		}
 	}
 
+	void DebugOverlays::addCpuTime( castor::String const & category
+		, castor::String const & name
+		, castor::Nanoseconds time )
+	{
+		if ( !m_visible )
+		{
+			return;
+		}
+
+		auto & cache = getEngine()->getOverlayCache();
+		auto it = m_renderPasses.find( category );
+
+		if ( it == m_renderPasses.end() )
+		{
+			it = m_renderPasses.emplace( category
+				, CategoryOverlays{ category, cache, m_detailed } ).first;
+			it->second.setVisible( m_visible );
+		}
+
+		if ( it->second.addCpuTime( name, time ) )
+		{
+			m_dirty = true;
+		}
+	}
+
 	castor::Microseconds DebugOverlays::endFrame()
 	{
 		m_totalTime = m_frameTimer.getElapsed() + m_externalTime;
@@ -737,6 +790,12 @@ namespace castor3d
 		m_debugPanel->addCountPanel( cuT( "VisibleObjectCount" )
 			, cuT( "Visible Objects Count:" )
 			, m_renderInfo.m_visibleObjectsCount );
+		m_debugPanel->addCountPanel( cuT( "OccludedObjectCount" )
+			, cuT( "Occluded Objects Count:" )
+			, m_renderInfo.m_occludedObjectsCount );
+		m_debugPanel->addCountPanel( cuT( "OccluderTriangleCount" )
+			, cuT( "Occluder Triangles Count:" )
+			, m_renderInfo.m_occluderTrianglesCount );
 		m_debugPanel->addCountPanel( cuT( "ParticlesCount" )
 			, cuT( "Particles Count:" )
 			, m_renderInfo.m_particlesCount );
@@ -749,6 +808,21 @@ namespace castor3d
 		m_debugPanel->addCountPanel( cuT( "DrawCalls" )
 			, cuT( "Draw calls:" )
 			, m_renderInfo.m_drawCalls );
+		m_debugPanel->addCountPanel( cuT( "PipelineBinds" )
+			, cuT( "Pipeline binds:" )
+			, m_renderInfo.m_pipelineBinds );
+		m_debugPanel->addCountPanel( cuT( "DescriptorSetBinds" )
+			, cuT( "Descriptor set binds:" )
+			, m_renderInfo.m_descriptorSetBinds );
+		m_debugPanel->addCountPanel( cuT( "BufferBinds" )
+			, cuT( "Buffer binds:" )
+			, m_renderInfo.m_bufferBinds );
+		m_debugPanel->addCountPanel( cuT( "SkippedBinds" )
+			, cuT( "Skipped binds:" )
+			, m_renderInfo.m_skippedBinds );
+		m_debugPanel->addCountPanel( cuT( "UploadedUboBytes" )
+			, cuT( "Uploaded UBO bytes:" )
+			, m_renderInfo.m_uploadedUboBytes );
 		m_debugPanel->updatePosition();
 		m_debugPanel->setVisible( m_visible );
 	}
@@ -13,7 +13,7 @@ namespace castor3d
 	namespace
 	{
 		template< typename CulledT >
-		void cullNodes( Camera const & camera
+		void cullNodes( std::vector< uint8_t > const & inFrustum
 			, SceneCuller::CulledInstancesT< CulledT > & all
 			, SceneCuller::CulledInstancesPtrT< CulledT > & culled )
 		{
@@ -25,7 +25,7 @@ namespace castor3d
 				CulledT & node = *objectIt;
 				UInt32Array & instances = *instanceIt;
 
-				if ( isVisible( camera, node ) )
+				if ( isVisible( inFrustum, node ) )
 				{
 					culled.push_back( &node, &instances );
 				}
@@ -36,13 +36,13 @@ namespace castor3d
 		}
 
 		template< typename CulledT >
-		void cullNodes( Camera const & camera
+		void cullNodes( std::vector< uint8_t > const & inFrustum
 			, SceneCuller::CulledInstanceArrayT< CulledT > & all
 			, SceneCuller::CulledInstancePtrArrayT< CulledT > & culled )
 		{
 			for ( size_t i = 0; i < size_t( RenderMode::eCount ); ++i )
 			{
-				cullNodes( camera, all[i], culled[i] );
+				cullNodes( inFrustum, all[i], culled[i] );
 			}
 		}
 	}
@@ -60,11 +60,12 @@ namespace castor3d
 
 	void FrustumCuller::doCullGeometries()
 	{
-		cullNodes( getCamera(), m_allSubmeshes, m_culledSubmeshes );
+		doCullBounds( getCamera().getFrustum(), m_inFrustum );
+		cullNodes( m_inFrustum, m_allSubmeshes, m_culledSubmeshes );
 	}
 
 	void FrustumCuller::doCullBillboards()
 	{
-		cullNodes( getCamera(), m_allBillboards, m_culledBillboards );
+		cullNodes( m_inFrustum, m_allBillboards, m_culledBillboards );
 	}
 }
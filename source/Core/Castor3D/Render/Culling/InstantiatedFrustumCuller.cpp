@@ -13,7 +13,7 @@ namespace castor3d
 	namespace
 	{
 		template< typename CulledT >
-		void cullNodes( std::vector< Frustum > const & frustums
+		void cullNodes( std::vector< std::vector< uint8_t > > const & inFrustums
 			, SceneCuller::CulledInstancesT< CulledT > & all
 			, SceneCuller::CulledInstancesPtrT< CulledT > & culled )
 		{
@@ -22,7 +22,13 @@ namespace castor3d
 			curIndex.resize( all.objects.size(), 0u );
 			CU_Require( all.objects.size() == all.instances.size() );
 
-			for ( auto & frustum : frustums )
+			// The instances arrays are kept between computes, and were shrunk by the previous one.
+			for ( auto & instances : all.instances )
+			{
+				instances.resize( inFrustums.size() );
+			}
+
+			for ( auto & inFrustum : inFrustums )
 			{
 				auto indexIt = curIndex.begin();
 				auto objectIt = all.objects.begin();
@@ -32,7 +38,7 @@ namespace castor3d
 				{
 					CulledT & node = *objectIt;
 
-					if ( isVisible( frustum, node ) )
+					if ( isVisible( inFrustum, node ) )
 					{
 						UInt32Array & instances = *instanceIt;
 						instances[*indexIt] = frustumIndex;
@@ -68,13 +74,13 @@ namespace castor3d
 		}
 
 		template< typename CulledT >
-		void cullNodes( std::vector< Frustum > const & frustums
+		void cullNodes( std::vector< std::vector< uint8_t > > const & inFrustums
 			, SceneCuller::CulledInstanceArrayT< CulledT > & all
 			, SceneCuller::CulledInstancePtrArrayT< CulledT > & culled )
 		{
 			for ( size_t i = 0; i < size_t( RenderMode::eCount ); ++i )
 			{
-				cullNodes( frustums, all[i], culled[i] );
+				cullNodes( inFrustums, all[i], culled[i] );
 			}
 		}
 	}
@@ -88,11 +94,20 @@ namespace castor3d
 
 	void InstantiatedFrustumCuller::doCullGeometries()
 	{
-		cullNodes( m_frustums, m_allSubmeshes, m_culledSubmeshes );
+		m_inFrustums.resize( m_frustums.size() );
+		auto inFrustumIt = m_inFrustums.begin();
+
+		for ( auto & frustum : m_frustums )
+		{
+			doCullBounds( frustum, *inFrustumIt );
+			++inFrustumIt;
+		}
+
+		cullNodes( m_inFrustums, m_allSubmeshes, m_culledSubmeshes );
 	}
 
 	void InstantiatedFrustumCuller::doCullBillboards()
 	{
-		cullNodes( m_frustums, m_allBillboards, m_culledBillboards );
+		cullNodes( m_inFrustums, m_allBillboards, m_culledBillboards );
 	}
 }
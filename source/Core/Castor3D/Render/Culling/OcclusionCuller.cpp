@@ -0,0 +1,174 @@
+#include "Castor3D/Render/Culling/OcclusionCuller.hpp"
+
+#include "Castor3D/Material/Material.hpp"
+#include "Castor3D/Material/Pass/Pass.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Submesh.hpp"
+#include "Castor3D/Model/Mesh/Submesh/Component/TriFaceMapping.hpp"
+#include "Castor3D/Render/RenderInfo.hpp"
+#include "Castor3D/Scene/Camera.hpp"
+#include "Castor3D/Scene/Geometry.hpp"
+#include "Castor3D/Scene/SceneNode.hpp"
+
+namespace castor3d
+{
+	namespace
+	{
+		// The occlusion buffer is much smaller than the render target, the hierarchical test stays conservative.
+		uint32_t constexpr BufferWidth = 256u;
+		uint32_t constexpr BufferHeight = 128u;
+
+		enum class Occlusion : uint8_t
+		{
+			eUnknown,
+			eVisible,
+			eOccluded,
+		};
+
+		bool isInstanced( CulledSubmesh const & node )
+		{
+			return node.data.getInstantiation().isInstanced( node.pass->getOwner()->shared_from_this() );
+		}
+	}
+
+	OcclusionCuller::OcclusionCuller( Scene & scene
+		, Camera & camera )
+		: FrustumCuller{ scene, camera }
+		, m_buffer{ BufferWidth, BufferHeight }
+	{
+	}
+
+	OcclusionCuller::OcclusionCuller( Camera & camera )
+		: OcclusionCuller{ *camera.getScene(), camera }
+	{
+	}
+
+	void OcclusionCuller::fillInfo( RenderInfo & info )const
+	{
+		info.m_occlusionTestedObjectsCount += m_stats.tested;
+		info.m_occludedObjectsCount += m_stats.occluded;
+		info.m_occluderTrianglesCount += m_stats.triangles;
+	}
+
+	void OcclusionCuller::doCullGeometries()
+	{
+		FrustumCuller::doCullGeometries();
+		m_stats = {};
+
+		if ( areAllChanged() )
+		{
+			m_proxies.clear();
+		}
+
+		auto & camera = getCamera();
+		auto viewProj = camera.getProjection( false ) * camera.getView();
+		doRasteriseOccluders( viewProj );
+		doCullOccluded( viewProj );
+	}
+
+	OcclusionCuller::OccluderProxy const & OcclusionCuller::doGetProxy( Submesh const & submesh )
+	{
+		auto & proxy = m_proxies[&submesh];
+		auto & points = submesh.getPoints();
+
+		if ( proxy.positions.size() == points.size() )
+		{
+			return proxy;
+		}
+
+		proxy.positions.clear();
+		proxy.indices.clear();
+		proxy.positions.reserve( points.size() );
+
+		for ( auto & point : points )
+		{
+			proxy.positions.push_back( point.pos );
+		}
+
+		// Only triangle lists can occlude.
+		if ( auto mapping = std::dynamic_pointer_cast< TriFaceMapping >( submesh.getIndexMapping() ) )
+		{
+			auto & faces = mapping->getFaces();
+			proxy.indices.reserve( faces.size() * 3u );
+
+			for ( auto & face : faces )
+			{
+				proxy.indices.push_back( face[0] );
+				proxy.indices.push_back( face[1] );
+				proxy.indices.push_back( face[2] );
+			}
+		}
+
+		return proxy;
+	}
+
+	void OcclusionCuller::doRasteriseOccluders( castor::Matrix4x4f const & viewProj )
+	{
+		m_buffer.clear();
+		// A submesh is listed once per pass, it is rasterised only once.
+		m_rasterised.assign( m_submeshBounds.size(), 0u );
+
+		for ( auto & culled : m_culledSubmeshes )
+		{
+			for ( auto node : culled.objects )
+			{
+				if ( node->instance.isOccluder()
+					&& !isInstanced( *node )
+					&& !m_rasterised[node->boundsIndex] )
+				{
+					m_rasterised[node->boundsIndex] = 1u;
+					auto & proxy = doGetProxy( node->data );
+					m_stats.triangles += m_buffer.rasterise( castor::makeArrayView( proxy.positions.data(), proxy.positions.data() + proxy.positions.size() )
+						, castor::makeArrayView( proxy.indices.data(), proxy.indices.data() + proxy.indices.size() )
+						, viewProj * node->sceneNode.getDerivedTransformationMatrix() );
+				}
+			}
+		}
+
+		m_buffer.buildHierarchy();
+	}
+
+	void OcclusionCuller::doCullOccluded( castor::Matrix4x4f const & viewProj )
+	{
+		if ( !m_stats.triangles )
+		{
+			return;
+		}
+
+		m_occlusion.assign( m_submeshBounds.size(), uint8_t( Occlusion::eUnknown ) );
+
+		for ( auto & culled : m_culledSubmeshes )
+		{
+			size_t kept = 0u;
+
+			for ( size_t i = 0u; i < culled.objects.size(); ++i )
+			{
+				auto & node = *culled.objects[i];
+				auto & occlusion = m_occlusion[node.boundsIndex];
+
+				if ( occlusion == uint8_t( Occlusion::eUnknown ) )
+				{
+					// Instanced submeshes bounds don't cover all their instances.
+					occlusion = ( isInstanced( node )
+						|| m_buffer.isVisible( m_submeshBounds.getBoundingBox( node.boundsIndex ), viewProj ) )
+						? uint8_t( Occlusion::eVisible )
+						: uint8_t( Occlusion::eOccluded );
+					++m_stats.tested;
+				}
+
+				if ( occlusion == uint8_t( Occlusion::eOccluded ) )
+				{
+					++m_stats.occluded;
+				}
+				else
+				{
+					culled.objects[kept] = culled.objects[i];
+					culled.instances[kept] = culled.instances[i];
+					++kept;
+				}
+			}
+
+			culled.objects.resize( kept );
+			culled.instances.resize( kept );
+		}
+	}
+}
@@ -7,6 +7,7 @@
 #include "Castor3D/Material/Pass/Pass.hpp"
 #include "Castor3D/Model/Mesh/Mesh.hpp"
 #include "Castor3D/Model/Mesh/Submesh/Submesh.hpp"
+#include "Castor3D/Render/Frustum.hpp"
 #include "Castor3D/Scene/BillboardList.hpp"
 #include "Castor3D/Scene/Camera.hpp"
 #include "Castor3D/Scene/Geometry.hpp"
@@ -22,27 +23,106 @@ namespace castor3d
 
 	namespace
 	{
+		// Removed geometries leave their bounds unused, above this count they are compacted by a full listing.
+		uint32_t constexpr MinCompactedBounds = 1024u;
+
 		template< typename CulledT >
 		void doAddNode( PassFlags const & passFlags
 			, CulledT const & node
 			, UInt32Array const & instances
-			, SceneCuller::CulledInstanceArrayT< CulledT > & nodes )
+			, SceneCuller::CulledInstanceArrayT< CulledT > & nodes
+			, std::array< std::vector< typename SceneCuller::CulledInstancesT< CulledT >::Entry >, size_t( RenderMode::eCount ) > & entries
+			, SceneCuller::CulledDeltaArrayT< CulledT > & deltas
+			, SceneCuller::NodeIds & ids )
 		{
+			auto add = [&]( RenderMode mode )
+			{
+				auto index = size_t( mode );
+				auto entry = nodes[index].push_back( node, instances );
+				entry.object->id = ids.allocate();
+				deltas[index].add( &( *entry.object ) );
+				entries[index].push_back( entry );
+			};
+
 			if ( checkFlag( passFlags, PassFlag::eAlphaBlending ) )
 			{
 				if ( checkFlag( passFlags, PassFlag::eAlphaTest ) )
 				{
-					nodes[size_t( RenderMode::eOpaqueOnly )].push_back( node, instances );
+					add( RenderMode::eOpaqueOnly );
 				}
 
-				nodes[size_t( RenderMode::eTransparentOnly )].push_back( node, instances );
+				add( RenderMode::eTransparentOnly );
 			}
 			else
 			{
-				nodes[size_t( RenderMode::eOpaqueOnly )].push_back( node, instances );
+				add( RenderMode::eOpaqueOnly );
+			}
+
+			add( RenderMode::eBoth );
+		}
+
+		template< typename CulledT >
+		void doRemoveNodes( std::array< std::vector< typename SceneCuller::CulledInstancesT< CulledT >::Entry >, size_t( RenderMode::eCount ) > & entries
+			, SceneCuller::CulledInstanceArrayT< CulledT > & nodes
+			, SceneCuller::CulledDeltaArrayT< CulledT > & deltas
+			, SceneCuller::NodeIds & ids )
+		{
+			for ( size_t i = 0; i < size_t( RenderMode::eCount ); ++i )
+			{
+				for ( auto & entry : entries[i] )
+				{
+					ids.release( entry.object->id );
+					deltas[i].remove( &( *entry.object ) );
+					nodes[i].erase( entry );
+				}
+
+				entries[i].clear();
+			}
+		}
+
+		template< typename CulledT >
+		void fillVisibility( SceneCuller::CulledInstancePtrArrayT< CulledT > const & culled
+			, SceneCuller::NodeIds const & ids
+			, SceneCuller::VisibilityArray & visible )
+		{
+			for ( size_t i = 0; i < size_t( RenderMode::eCount ); ++i )
+			{
+				visible[i].reset();
+				visible[i].resize( ids.count, false );
+
+				for ( auto node : culled[i].objects )
+				{
+					visible[i].set( node->id );
+				}
+			}
+		}
+
+		uint32_t getRenderedSubmeshCount( Geometry const & geometry )
+		{
+			uint32_t result = 0u;
+
+			if ( auto mesh = geometry.getMesh() )
+			{
+				for ( auto & submesh : *mesh )
+				{
+					if ( geometry.getMaterial( *submesh ) )
+					{
+						++result;
+					}
+				}
 			}
 
-			nodes[size_t( RenderMode::eBoth )].push_back( node, instances );
+			return result;
+		}
+
+		BillboardBase * getBillboards( BillboardList & owner )
+		{
+			return &owner;
+		}
+
+		BillboardBase * getBillboards( ParticleSystem & owner )
+		{
+			return owner.getBillboards().get();
 		}
 	}
 
@@ -59,23 +139,13 @@ namespace castor3d
 		return hash( culled.instance, culled.data, *culled.pass, instanceMult );
 	}
 
-	bool isVisible( Camera const & camera
-		, CulledSubmesh const & node )
-	{
-		return isVisible( camera.getFrustum(), node );
-	}
-
-	bool isVisible( Frustum const & frustum
+	bool isVisible( std::vector< uint8_t > const & inFrustum
 		, CulledSubmesh const & node )
 	{
 		return node.sceneNode.isDisplayable()
 			&& node.sceneNode.isVisible()
-			&& ( node.data.getInstantiation().isInstanced( node.pass->getOwner()->shared_from_this() )
-				|| ( frustum.isVisible( node.instance.getBoundingSphere( node.data )
-					, node.sceneNode.getDerivedTransformationMatrix()
-					, node.sceneNode.getDerivedScale() )
-					&& frustum.isVisible( node.instance.getBoundingBox( node.data )
-						, node.sceneNode.getDerivedTransformationMatrix() ) ) );
+			&& ( inFrustum[node.boundsIndex]
+				|| node.data.getInstantiation().isInstanced( node.pass->getOwner()->shared_from_this() ) );
 	}
 
 	//*********************************************************************************************
@@ -91,13 +161,7 @@ namespace castor3d
 		return hash( culled.data, *culled.pass, instanceMult );
 	}
 
-	bool isVisible( Camera const & camera
-		, CulledBillboard const & node )
-	{
-		return isVisible( camera.getFrustum(), node );
-	}
-
-	bool isVisible( Frustum const & frustum
+	bool isVisible( std::vector< uint8_t > const & inFrustum
 		, CulledBillboard const & node )
 	{
 		return node.sceneNode.isDisplayable()
@@ -117,6 +181,44 @@ namespace castor3d
 			{
 				onSceneChanged( m_scene );
 			} );
+		m_sceneUpdated = m_scene.onUpdate.connect( [this]( Scene const & scene )
+			{
+				onSceneUpdated( scene );
+			} );
+		m_geometryAdded = m_scene.getGeometryCache().onElementAdded.connect( [this]( Geometry & geometry )
+			{
+				auto lock( castor::makeUniqueLock( m_pendingMutex ) );
+				m_dirtyGeometries.insert( &geometry );
+			} );
+		m_geometryRemoved = m_scene.getGeometryCache().onElementRemoved.connect( [this]( Geometry & geometry )
+			{
+				auto lock( castor::makeUniqueLock( m_pendingMutex ) );
+				m_dirtyGeometries.erase( &geometry );
+				m_movedGeometries.erase( &geometry );
+				m_removedGeometries.insert( &geometry );
+			} );
+		m_billboardListAdded = m_scene.getBillboardListCache().onElementAdded.connect( [this]( BillboardList & billboards )
+			{
+				auto lock( castor::makeUniqueLock( m_pendingMutex ) );
+				m_pendingBillboardLists.dirty.insert( &billboards );
+			} );
+		m_billboardListRemoved = m_scene.getBillboardListCache().onElementRemoved.connect( [this]( BillboardList & billboards )
+			{
+				auto lock( castor::makeUniqueLock( m_pendingMutex ) );
+				m_pendingBillboardLists.dirty.erase( &billboards );
+				m_pendingBillboardLists.removed.insert( &billboards );
+			} );
+		m_particleSystemAdded = m_scene.getParticleSystemCache().onElementAdded.connect( [this]( ParticleSystem & particleSystem )
+			{
+				auto lock( castor::makeUniqueLock( m_pendingMutex ) );
+				m_pendingParticleSystems.dirty.insert( &particleSystem );
+			} );
+		m_particleSystemRemoved = m_scene.getParticleSystemCache().onElementRemoved.connect( [this]( ParticleSystem & particleSystem )
+			{
+				auto lock( castor::makeUniqueLock( m_pendingMutex ) );
+				m_pendingParticleSystems.dirty.erase( &particleSystem );
+				m_pendingParticleSystems.removed.insert( &particleSystem );
+			} );
 
 		if ( m_camera )
 		{
@@ -129,16 +231,30 @@ namespace castor3d
 
 	void SceneCuller::compute()
 	{
+		for ( size_t i = 0; i < size_t( RenderMode::eCount ); ++i )
+		{
+			m_submeshesDelta[i].clear();
+			m_billboardsDelta[i].clear();
+		}
+
 		m_allChanged = m_sceneDirty;
 
 		if ( m_allChanged )
 		{
-			m_minCullersZ = std::numeric_limits< float >::max();
 			doClearAll();
-			doListGeometries();
-			doListBillboards();
-			doListParticles();
-			m_cameraDirty = true;
+			doListAll();
+		}
+		else
+		{
+			doApplyChanges();
+
+			if ( m_freeBounds > MinCompactedBounds
+				&& m_freeBounds > m_submeshBounds.size() / 2u )
+			{
+				m_allChanged = true;
+				doClearAll();
+				doListAll();
+			}
 		}
 
 		m_culledChanged = m_cameraDirty;
@@ -148,6 +264,7 @@ namespace castor3d
 			doClearCulled();
 			doCullGeometries();
 			doCullBillboards();
+			doUpdateVisibility();
 		}
 
 		m_sceneDirty = false;
@@ -167,9 +284,42 @@ namespace castor3d
 		return instances;
 	}
 
+	void SceneCuller::doCullBounds( Frustum const & frustum
+		, std::vector< uint8_t > & inFrustum )const
+	{
+		auto & planes = frustum.getPlanes();
+		auto planesView = castor::makeArrayView( planes.data(), planes.data() + planes.size() );
+		std::vector< castor::BoundingBoxArray::Range > ranges;
+		getScene().getGeometryBvh().query( planesView
+			, [this, &ranges]( void * data )
+			{
+				auto it = m_geometries.find( static_cast< Geometry const * >( data ) );
+
+				if ( it != m_geometries.end() )
+				{
+					ranges.push_back( it->second.bounds );
+				}
+			} );
+		m_submeshBounds.cull( planesView
+			, castor::makeArrayView( ranges.data(), ranges.data() + ranges.size() )
+			, inFrustum );
+	}
+
 	void SceneCuller::onSceneChanged( Scene const & scene )
 	{
-		m_sceneDirty = true;
+		// Objects additions, removals and material changes come from the caches,
+		// the other scene changes (nodes visibility, lights...) only need a new culling.
+		m_cameraDirty = true;
+	}
+
+	void SceneCuller::onSceneUpdated( Scene const & scene )
+	{
+		auto lock( castor::makeUniqueLock( m_pendingMutex ) );
+
+		for ( auto geometry : scene.getMovedGeometries() )
+		{
+			m_movedGeometries.insert( geometry );
+		}
 	}
 
 	void SceneCuller::onCameraChanged( Camera const & camera )
@@ -183,7 +333,19 @@ namespace castor3d
 		{
 			m_allSubmeshes[i].clear();
 			m_allBillboards[i].clear();
+			m_submeshesDelta[i].clear();
+			m_billboardsDelta[i].clear();
 		}
+
+		m_submeshIds.clear();
+		m_billboardIds.clear();
+		m_submeshBounds.clear();
+		m_freeBounds = 0u;
+		m_geometries.clear();
+		m_billboardLists.listed.clear();
+		m_billboardLists.dirty.clear();
+		m_particleSystems.listed.clear();
+		m_particleSystems.dirty.clear();
 	}
 
 	void SceneCuller::doClearCulled()
@@ -195,139 +357,295 @@ namespace castor3d
 		}
 	}
 
-	void SceneCuller::doListGeometries()
+	void SceneCuller::doUpdateVisibility()
+	{
+		fillVisibility( m_culledSubmeshes, m_submeshIds, m_visibleSubmeshes );
+		fillVisibility( m_culledBillboards, m_billboardIds, m_visibleBillboards );
+	}
+
+	void SceneCuller::doListAll()
 	{
 		auto & scene = getScene();
-		auto lock( castor::makeUniqueLock( scene.getGeometryCache() ) );
-		auto instances = getInitialInstances();
+		{
+			// The listing below covers the pending changes.
+			auto lock( castor::makeUniqueLock( m_pendingMutex ) );
+			m_dirtyGeometries.clear();
+			m_removedGeometries.clear();
+			m_movedGeometries.clear();
+			m_pendingBillboardLists.dirty.clear();
+			m_pendingBillboardLists.removed.clear();
+			m_pendingParticleSystems.dirty.clear();
+			m_pendingParticleSystems.removed.clear();
+		}
+		{
+			auto lock( castor::makeUniqueLock( scene.getGeometryCache() ) );
 
-		for ( auto primitive : scene.getGeometryCache() )
+			for ( auto primitive : scene.getGeometryCache() )
+			{
+				if ( primitive.second )
+				{
+					doAddGeometry( *primitive.second );
+				}
+			}
+		}
 		{
-			if ( primitive.second
-				&& primitive.second->getParent() )
+			auto lock( castor::makeUniqueLock( scene.getBillboardListCache() ) );
+
+			for ( auto billboard : scene.getBillboardListCache() )
 			{
-				auto & geometry = *primitive.second;
-				auto & node = *geometry.getParent();
+				if ( billboard.second )
+				{
+					doAddBillboards( *billboard.second, m_billboardLists );
+				}
+			}
+		}
+		{
+			auto lock( castor::makeUniqueLock( scene.getParticleSystemCache() ) );
 
-				if ( primitive.second->getMesh() )
+			for ( auto particleSystem : scene.getParticleSystemCache() )
+			{
+				if ( particleSystem.second )
 				{
-					auto & mesh = *geometry.getMesh();
+					doAddBillboards( *particleSystem.second, m_particleSystems );
+				}
+			}
+		}
 
-					for ( auto submesh : mesh )
-					{
-						auto material = geometry.getMaterial( *submesh );
-
-						if ( material )
-						{
-							for ( auto & pass : *material )
-							{
-								doAddNode( pass->getPassFlags()
-									, CulledSubmesh{ geometry
-										, *submesh
-										, pass
-										, node }
-									, instances
-									, m_allSubmeshes );
-							}
-						}
-					}
+		m_cameraDirty = true;
+	}
 
-					if ( m_camera )
-					{
-						auto aabbMin = mesh.getBoundingBox().getMin();
-						auto aabbMax = mesh.getBoundingBox().getMax();
-						auto & camera = getCamera();
-						castor::Point3f corners[8]
-						{
-							castor::Point3f{ aabbMin[0], aabbMin[1], aabbMin[2] },
-							castor::Point3f{ aabbMin[0], aabbMin[1], aabbMax[2] },
-							castor::Point3f{ aabbMin[0], aabbMax[1], aabbMin[2] },
-							castor::Point3f{ aabbMin[0], aabbMax[1], aabbMax[2] },
-							castor::Point3f{ aabbMax[0], aabbMin[1], aabbMin[2] },
-							castor::Point3f{ aabbMax[0], aabbMin[1], aabbMax[2] },
-							castor::Point3f{ aabbMax[0], aabbMax[1], aabbMin[2] },
-							castor::Point3f{ aabbMax[0], aabbMax[1], aabbMax[2] },
-						};
-						for ( auto & corner : corners )
-						{
-							m_minCullersZ = std::min( m_minCullersZ
-								, ( camera.getView() * node.getDerivedTransformationMatrix() * corner )[2] );
-						}
-					}
-					else
-					{
-						m_minCullersZ = std::min( m_minCullersZ
-							, node.getDerivedPosition()[2] - mesh.getBoundingSphere().getRadius() );
-					}
-				}
+	void SceneCuller::doApplyChanges()
+	{
+		std::unordered_set< Geometry * > dirtyGeometries;
+		std::unordered_set< Geometry const * > removedGeometries;
+		std::unordered_set< Geometry * > movedGeometries;
+		BillboardOwnersT< BillboardList > billboardLists;
+		BillboardOwnersT< ParticleSystem > particleSystems;
+		{
+			auto lock( castor::makeUniqueLock( m_pendingMutex ) );
+			std::swap( dirtyGeometries, m_dirtyGeometries );
+			std::swap( removedGeometries, m_removedGeometries );
+			std::swap( movedGeometries, m_movedGeometries );
+			std::swap( billboardLists, m_pendingBillboardLists );
+			std::swap( particleSystems, m_pendingParticleSystems );
+		}
+
+		// Removals first, a new object may have been allocated at a removed one's address.
+		for ( auto geometry : removedGeometries )
+		{
+			doRemoveGeometry( geometry );
+		}
+
+		for ( auto geometry : dirtyGeometries )
+		{
+			doRemoveGeometry( geometry );
+			doAddGeometry( *geometry );
+			movedGeometries.erase( geometry );
+		}
+
+		for ( auto geometry : movedGeometries )
+		{
+			auto it = m_geometries.find( geometry );
+
+			if ( it == m_geometries.end() )
+			{
+				continue;
+			}
+
+			if ( it->second.node != geometry->getParent()
+				|| it->second.mesh != geometry->getMesh().get()
+				|| it->second.bounds.count != getRenderedSubmeshCount( *geometry ) )
+			{
+				// Attached to another node, or its mesh has changed.
+				doRemoveGeometry( geometry );
+				doAddGeometry( *geometry );
+			}
+			else
+			{
+				doUpdateGeometryBounds( *geometry, it->second );
+			}
+
+			m_cameraDirty = true;
+		}
+
+		doApplyBillboardsChanges( m_billboardLists, billboardLists );
+		doApplyBillboardsChanges( m_particleSystems, particleSystems );
+
+		for ( size_t i = 0; i < size_t( RenderMode::eCount ); ++i )
+		{
+			if ( !m_submeshesDelta[i].empty()
+				|| !m_billboardsDelta[i].empty() )
+			{
+				m_cameraDirty = true;
 			}
 		}
 	}
 
-	void SceneCuller::doListBillboards()
+	void SceneCuller::doAddGeometry( Geometry & geometry )
 	{
-		auto & scene = getScene();
-		auto lock( castor::makeUniqueLock( scene.getBillboardListCache() ) );
+		auto & entries = m_geometries.emplace( &geometry, GeometryEntries{} ).first->second;
+		entries.onMaterialChanged = geometry.onMaterialChanged.connect( [this, &geometry]( Geometry const &
+			, Submesh const &
+			, MaterialSPtr
+			, MaterialSPtr )
+			{
+				auto lock( castor::makeUniqueLock( m_pendingMutex ) );
+				m_dirtyGeometries.insert( &geometry );
+			} );
+		auto node = geometry.getParent();
+		auto mesh = geometry.getMesh();
+
+		if ( !node || !mesh )
+		{
+			// Listed once attached to a node, through the scene's moved geometries.
+			return;
+		}
+
+		entries.node = node;
+		entries.mesh = mesh.get();
+		entries.bounds = { m_submeshBounds.size(), 0u };
 		auto instances = getInitialInstances();
 
-		for ( auto billboard : scene.getBillboardListCache() )
+		for ( auto submesh : *mesh )
 		{
-			if ( billboard.second
-				&& billboard.second->getParent() )
+			auto material = geometry.getMaterial( *submesh );
+
+			if ( material )
 			{
-				auto & billboards = *billboard.second;
-				MaterialSPtr material( billboards.getMaterial() );
+				auto boundsIndex = m_submeshBounds.add( geometry.getBoundingBox( *submesh )
+					, node->getDerivedTransformationMatrix() );
+				++entries.bounds.count;
 
-				if ( material )
+				for ( auto & pass : *material )
 				{
-					auto & node = *billboards.getParent();
-
-					for ( auto & pass : *material )
-					{
-						doAddNode( pass->getPassFlags()
-							, CulledBillboard{ billboards
-								, billboards
-								, pass
-								, node }
-							, instances
-							, m_allBillboards );
-					}
+					doAddNode( pass->getPassFlags()
+						, CulledSubmesh{ geometry
+							, *submesh
+							, pass
+							, *node
+							, boundsIndex }
+						, instances
+						, m_allSubmeshes
+						, entries.entries
+						, m_submeshesDelta
+						, m_submeshIds );
 				}
 			}
 		}
 	}
 
-	void SceneCuller::doListParticles()
+	void SceneCuller::doRemoveGeometry( Geometry const * geometry )
 	{
-		auto & scene = getScene();
-		auto lock( castor::makeUniqueLock( scene.getParticleSystemCache() ) );
-		auto instances = getInitialInstances();
+		// The geometry may already be destroyed, it is only used as a key.
+		auto it = m_geometries.find( geometry );
 
-		for ( auto particleSystem : scene.getParticleSystemCache() )
+		if ( it != m_geometries.end() )
 		{
-			if ( particleSystem.second
-				&& particleSystem.second->getBillboards()
-				&& particleSystem.second->getParent() )
+			doRemoveNodes( it->second.entries, m_allSubmeshes, m_submeshesDelta, m_submeshIds );
+			m_freeBounds += it->second.bounds.count;
+			m_geometries.erase( it );
+		}
+	}
+
+	void SceneCuller::doUpdateGeometryBounds( Geometry const & geometry
+		, GeometryEntries const & entries )
+	{
+		// Same submeshes order as in doAddGeometry.
+		auto index = entries.bounds.first;
+
+		for ( auto submesh : *geometry.getMesh() )
+		{
+			if ( geometry.getMaterial( *submesh ) )
 			{
-				MaterialSPtr material( particleSystem.second->getMaterial() );
+				m_submeshBounds.set( index
+					, geometry.getBoundingBox( *submesh )
+					, entries.node->getDerivedTransformationMatrix() );
+				++index;
+			}
+		}
+	}
 
-				if ( material )
-				{
-					auto & billboards = *particleSystem.second->getBillboards();
-					auto & node = *particleSystem.second->getParent();
+	template< typename OwnerT >
+	void SceneCuller::doAddBillboards( OwnerT & owner
+		, BillboardOwnersT< OwnerT > & owners )
+	{
+		auto billboards = getBillboards( owner );
+		auto node = owner.getParent();
+		auto material = owner.getMaterial();
 
-					for ( auto & pass : *material )
-					{
-						doAddNode( pass->getPassFlags()
-							, CulledBillboard{ billboards
-								, billboards
-								, pass
-								, node }
-							, instances
-							, m_allBillboards );
-					}
+		if ( !billboards || !node || !material )
+		{
+			// Not renderable yet, checked again at next compute.
+			owners.dirty.insert( &owner );
+			return;
+		}
+
+		auto & entries = owners.listed.emplace( &owner, BillboardEntries{} ).first->second;
+		entries.onMaterialChanged = billboards->onMaterialChanged.connect( [this, &owner]( BillboardBase const &
+			, MaterialSPtr
+			, MaterialSPtr )
+			{
+				auto lock( castor::makeUniqueLock( m_pendingMutex ) );
+
+				if constexpr ( std::is_same_v< OwnerT, BillboardList > )
+				{
+					m_pendingBillboardLists.dirty.insert( &owner );
 				}
-			}
+				else
+				{
+					m_pendingParticleSystems.dirty.insert( &owner );
+				}
+			} );
+		auto instances = getInitialInstances();
+
+		for ( auto & pass : *material )
+		{
+			doAddNode( pass->getPassFlags()
+				, CulledBillboard{ *billboards
+					, *billboards
+					, pass
+					, *node }
+				, instances
+				, m_allBillboards
+				, entries.entries
+				, m_billboardsDelta
+				, m_billboardIds );
+		}
+	}
+
+	template< typename OwnerT >
+	void SceneCuller::doRemoveBillboards( OwnerT const * owner
+		, BillboardOwnersT< OwnerT > & owners )
+	{
+		// The owner may already be destroyed, it is only used as a key.
+		owners.dirty.erase( const_cast< OwnerT * >( owner ) );
+		auto it = owners.listed.find( owner );
+
+		if ( it != owners.listed.end() )
+		{
+			doRemoveNodes( it->second.entries, m_allBillboards, m_billboardsDelta, m_billboardIds );
+			owners.listed.erase( it );
+		}
+	}
+
+	template< typename OwnerT >
+	void SceneCuller::doApplyBillboardsChanges( BillboardOwnersT< OwnerT > & owners
+		, BillboardOwnersT< OwnerT > & pending )
+	{
+		for ( auto owner : pending.removed )
+		{
+			doRemoveBillboards( owner, owners );
+		}
+
+		// The owners listed while not renderable are checked again.
+		std::unordered_set< OwnerT * > dirty;
+		std::swap( dirty, owners.dirty );
+		dirty.insert( pending.dirty.begin(), pending.dirty.end() );
+
+		for ( auto owner : dirty )
+		{
+			doRemoveBillboards( owner, owners );
+			doAddBillboards( *owner, owners );
 		}
 	}
 
@@ -35,6 +35,8 @@
 #include "Castor3D/Shader/Ubos/SkinningUbo.hpp"
 #include "Castor3D/Shader/Ubos/VoxelizerUbo.hpp"
 
+#include <CastorUtils/Miscellaneous/Hash.hpp>
+
 #include <ShaderWriter/Source.hpp>
 
 CU_ImplementCUSmartPtr( castor3d, VoxelizePass )
@@ -67,6 +69,7 @@ namespace castor3d
 
 	VoxelizePass::~VoxelizePass()
 	{
+		cleanupPrewarm();
 	}
 
 	void VoxelizePass::accept( RenderTechniqueVisitor & visitor )
@@ -640,4 +643,9 @@ namespace castor3d
 
 		return std::make_unique< ast::Shader >( std::move( writer.getShader() ) );
 	}
+
+	void VoxelizePass::doHashShaderInputs( size_t & hash )const
+	{
+		castor::hashCombine( hash, m_voxelConfig.gridSize.value() );
+	}
 }
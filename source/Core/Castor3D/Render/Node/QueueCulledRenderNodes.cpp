@@ -4,6 +4,7 @@
 
 #include "Castor3D/Render/Node/QueueCulledRenderNodes.hpp"
 
+#include "Castor3D/Engine.hpp"
 #include "Castor3D/Cache/AnimatedObjectGroupCache.hpp"
 #include "Castor3D/Material/Material.hpp"
 #include "Castor3D/Material/Pass/Pass.hpp"
@@ -11,13 +12,17 @@
 #include "Castor3D/Model/Mesh/Submesh/Submesh.hpp"
 #include "Castor3D/Model/Skeleton/Skeleton.hpp"
 #include "Castor3D/Miscellaneous/makeVkType.hpp"
+#include "Castor3D/Render/RenderDevice.hpp"
+#include "Castor3D/Render/RenderInfo.hpp"
 #include "Castor3D/Render/RenderPass.hpp"
 #include "Castor3D/Render/RenderPipeline.hpp"
+#include "Castor3D/Render/RenderSystem.hpp"
 #include "Castor3D/Render/Culling/CullingModule.hpp"
 #include "Castor3D/Render/Culling/SceneCuller.hpp"
 #include "Castor3D/Render/Node/BillboardRenderNode.hpp"
 #include "Castor3D/Render/Node/SubmeshRenderNode.hpp"
 #include "Castor3D/Scene/BillboardList.hpp"
+#include "Castor3D/Scene/Camera.hpp"
 #include "Castor3D/Scene/Geometry.hpp"
 #include "Castor3D/Scene/Scene.hpp"
 #include "Castor3D/Scene/Animation/AnimatedMesh.hpp"
@@ -29,10 +34,16 @@
 #include "Castor3D/Shader/Program.hpp"
 #include "Castor3D/Material/Texture/TextureLayout.hpp"
 
+#include <CastorUtils/Multithreading/ParallelFor.hpp>
+
 #include <ShaderWriter/Source.hpp>
 
 #include <ashespp/Command/CommandBufferInheritanceInfo.hpp>
 
+#include <array>
+#include <limits>
+#include <unordered_map>
+
 CU_ImplementCUSmartPtr( castor3d, QueueCulledRenderNodes )
 
 using ashes::operator==;
@@ -43,31 +54,46 @@ namespace castor3d
 	namespace
 	{
 		template< typename NodeT >
-		void doAddRenderNode( RenderPipeline & pipeline
-			, NodeT * node
-			, NodePtrByPipelineMapT< NodeT > & nodes )
-		{
-			auto & pipelineMap = nodes.emplace( &pipeline, NodePtrArrayT< NodeT >{} ).first->second;
-			pipelineMap.emplace_back( node );
-		}
-
-		template< typename NodeT >
-		void doParseRenderNodes( NodeByPipelineMapT< NodeT > & inputNodes
+		void doParseRenderNodes( castor::JobScheduler & jobs
+			, NodeByPipelineMapT< NodeT > & inputNodes
 			, NodePtrByPipelineMapT< NodeT > & outputNodes
-			, SceneCuller::CulledInstancesPtrT< NodeCulledT< NodeT > > const & culledNodes )
+			, castor::DynamicBitset const & visible )
 		{
-			for ( auto & pipelines : inputNodes )
+			// The output arrays are created beforehand, each pipeline then fills its own one.
+			using PipelineNodes = std::pair< NodeMapT< NodeT > const *, NodePtrArrayT< NodeT > * >;
+			std::vector< PipelineNodes > pipelines;
+			pipelines.reserve( inputNodes.size() );
+
+			for ( auto & pipeline : inputNodes )
 			{
-				for ( auto & node : pipelines.second )
-				{
-					auto it = std::find( culledNodes.objects.begin()
-						, culledNodes.objects.end()
-						, node.first );
+				pipelines.emplace_back( &pipeline.second
+					, &outputNodes.emplace( pipeline.first, NodePtrArrayT< NodeT >{} ).first->second );
+			}
 
-					if ( it != culledNodes.objects.end() )
+			castor::parallelForEach( jobs
+				, pipelines.begin()
+				, pipelines.end()
+				, [&visible]( PipelineNodes const & pipeline )
+				{
+					for ( auto & node : *pipeline.first )
 					{
-						doAddRenderNode( *pipelines.first, node.second, outputNodes );
+						if ( visible.get( node.first->id ) )
+						{
+							pipeline.second->push_back( node.second );
+						}
 					}
+				} );
+
+			// Only the pipelines with visible nodes are kept.
+			for ( auto it = outputNodes.begin(); it != outputNodes.end(); )
+			{
+				if ( it->second.empty() )
+				{
+					it = outputNodes.erase( it );
+				}
+				else
+				{
+					++it;
 				}
 			}
 		}
@@ -90,17 +116,13 @@ namespace castor3d
 			, RenderPipeline & pipeline
 			, Pass & pass
 			, NodeMapT< NodeT > & renderNodes
-			, SceneCuller::CulledInstancesPtrT< CulledSubmesh > const & culledNodes )
+			, castor::DynamicBitset const & visible )
 		{
 			for ( auto & node : renderNodes )
 			{
-				auto it = std::find( culledNodes.objects.begin()
-					, culledNodes.objects.end()
-					, node.first );
-
-				if ( it != culledNodes.objects.end() )
+				if ( visible.get( node.first->id ) )
 				{
-					doAddInstantiatedRenderNode( pass, pipeline, node.second, ( *it )->data, outputNodes );
+					doAddInstantiatedRenderNode( pass, pipeline, node.second, node.first->data, outputNodes );
 				}
 			}
 		}
@@ -126,222 +148,431 @@ namespace castor3d
 			return billboard.getGeometryBuffers();
 		}
 
+		// The state bound in a command buffer, to skip the redundant binds.
+		struct BindState
+		{
+			RenderPipeline const * pipeline{};
+			VkPipelineLayout pipelineLayout{};
+			// Indexed by binding point.
+			std::vector< VkDescriptorSet > descriptorSets;
+			// Indexed by binding.
+			std::vector< std::pair< VkBuffer, VkDeviceSize > > vertexBuffers;
+			VkBuffer indexBuffer{};
+			VkDeviceSize indexOffset{};
+			QueueCulledRenderNodes::BindCounts counts;
+		};
+
+		void doBindDescriptorSet( RenderPipeline const & pipeline
+			, ashes::DescriptorSet const & descriptorSet
+			, ashes::CommandBuffer const & commandBuffer
+			, BindState & state )
+		{
+			auto bindingPoint = descriptorSet.getBindingPoint();
+
+			if ( state.descriptorSets.size() <= bindingPoint )
+			{
+				state.descriptorSets.resize( bindingPoint + 1u, VK_NULL_HANDLE );
+			}
+
+			if ( state.descriptorSets[bindingPoint] == VkDescriptorSet( descriptorSet ) )
+			{
+				++state.counts.skipped;
+				return;
+			}
+
+			commandBuffer.bindDescriptorSet( descriptorSet, pipeline.getPipelineLayout() );
+			state.descriptorSets[bindingPoint] = descriptorSet;
+			++state.counts.descriptorSets;
+		}
+
 		template< typename NodeT >
-		void doAddRenderNodeCommands( RenderPipeline & pipeline
-			, ShaderFlags const & shaderFlags
+		void doBindNodeDescriptorSets( RenderPipeline const & pipeline
 			, NodeT const & node
+			, ashes::CommandBuffer const & commandBuffer
+			, BindState & state )
+		{
+			if ( node.uboDescriptorSet )
+			{
+				doBindDescriptorSet( pipeline, *node.uboDescriptorSet, commandBuffer, state );
+			}
+
+			if ( node.texDescriptorSet )
+			{
+				doBindDescriptorSet( pipeline, *node.texDescriptorSet, commandBuffer, state );
+			}
+
+			if ( pipeline.hasDescriptorSetLayout() )
+			{
+				doBindDescriptorSet( pipeline, pipeline.getAdditionalDescriptorSet( node ), commandBuffer, state );
+			}
+		}
+
+		void doBindPipeline( RenderPipeline const & pipeline
 			, ashes::CommandBuffer const & commandBuffer
 			, ashes::Optional< VkViewport > const & viewport
 			, ashes::Optional< VkRect2D > const & scissor
-			, uint32_t instanceCount )
+			, BindState & state )
 		{
-			if ( instanceCount )
+			if ( state.pipeline == &pipeline )
 			{
-				GeometryBuffers const & geometryBuffers = getGeometryBuffers( shaderFlags
-					, node.data
-					, node.passNode.pass
-					, instanceCount );
+				++state.counts.skipped;
+				return;
+			}
 
-				commandBuffer.bindPipeline( pipeline.getPipeline() );
+			auto & device = pipeline.getRenderSystem().getCurrentRenderDevice();
+			device->vkCmdBindPipeline( commandBuffer
+				, VK_PIPELINE_BIND_POINT_GRAPHICS
+				, pipeline.getPipeline() );
+			++state.counts.pipelines;
 
-				if ( viewport )
-				{
-					commandBuffer.setViewport( *viewport );
-				}
+			if ( viewport )
+			{
+				commandBuffer.setViewport( *viewport );
+			}
 
-				if ( scissor )
-				{
-					commandBuffer.setScissor( *scissor );
-				}
+			if ( scissor )
+			{
+				commandBuffer.setScissor( *scissor );
+			}
 
-				if ( node.uboDescriptorSet )
-				{
-					commandBuffer.bindDescriptorSet( *node.uboDescriptorSet, pipeline.getPipelineLayout() );
-				}
+			VkPipelineLayout pipelineLayout = pipeline.getPipelineLayout();
 
-				if ( node.texDescriptorSet )
+			if ( state.pipelineLayout != pipelineLayout )
+			{
+				// The bound descriptor sets may not be compatible with the new layout.
+				state.descriptorSets.clear();
+				state.pipelineLayout = pipelineLayout;
+			}
+
+			state.pipeline = &pipeline;
+		}
+
+		void doBindGeometryBuffers( GeometryBuffers const & geometryBuffers
+			, ashes::CommandBuffer const & commandBuffer
+			, BindState & state )
+		{
+			for ( uint32_t i = 0; i < geometryBuffers.vbo.size(); ++i )
+			{
+				auto binding = geometryBuffers.layouts[i].get().vertexBindingDescriptions[0].binding;
+				std::pair< VkBuffer, VkDeviceSize > vertexBuffer{ VkBuffer( geometryBuffers.vbo[i].get() ), geometryBuffers.vboOffsets[i] };
+
+				if ( state.vertexBuffers.size() <= binding )
 				{
-					commandBuffer.bindDescriptorSet( *node.texDescriptorSet, pipeline.getPipelineLayout() );
+					state.vertexBuffers.resize( binding + 1u, { VK_NULL_HANDLE, 0u } );
 				}
 
-				if ( pipeline.hasDescriptorSetLayout() )
+				if ( state.vertexBuffers[binding] == vertexBuffer )
 				{
-					commandBuffer.bindDescriptorSet( pipeline.getAdditionalDescriptorSet( node ), pipeline.getPipelineLayout() );
+					++state.counts.skipped;
 				}
-
-				for ( uint32_t i = 0; i < geometryBuffers.vbo.size(); ++i )
+				else
 				{
-					commandBuffer.bindVertexBuffer( geometryBuffers.layouts[i].get().vertexBindingDescriptions[0].binding
+					commandBuffer.bindVertexBuffer( binding
 						, geometryBuffers.vbo[i]
 						, geometryBuffers.vboOffsets[i] );
+					state.vertexBuffers[binding] = vertexBuffer;
+					++state.counts.buffers;
 				}
+			}
 
-				if ( geometryBuffers.ibo )
+			if ( geometryBuffers.ibo )
+			{
+				VkBuffer indexBuffer = *geometryBuffers.ibo;
+
+				if ( state.indexBuffer == indexBuffer
+					&& state.indexOffset == geometryBuffers.iboOffset )
 				{
-					commandBuffer.bindIndexBuffer( *geometryBuffers.ibo
-						, geometryBuffers.iboOffset
-						, VK_INDEX_TYPE_UINT32 );
-					commandBuffer.drawIndexed( geometryBuffers.idxCount
-						, instanceCount );
+					++state.counts.skipped;
 				}
 				else
 				{
-					commandBuffer.draw( geometryBuffers.vtxCount
-						, instanceCount );
+					commandBuffer.bindIndexBuffer( *geometryBuffers.ibo
+						, geometryBuffers.iboOffset
+						, VK_INDEX_TYPE_UINT32 );
+					state.indexBuffer = indexBuffer;
+					state.indexOffset = geometryBuffers.iboOffset;
+					++state.counts.buffers;
 				}
 			}
 		}
 
-		template< typename NodeT >
-		void doAddRenderNodeCommands( Pass & pass
-			, RenderPipeline & pipeline
+		void doAddRenderNodeCommands( QueueCulledRenderNodes::Draw const & draw
 			, ShaderFlags const & shaderFlags
-			, NodeT const & node
-			, Submesh & object
 			, ashes::CommandBuffer const & commandBuffer
 			, ashes::Optional< VkViewport > const & viewport
 			, ashes::Optional< VkRect2D > const & scissor
-			, uint32_t instanceCount )
+			, BindState & state )
 		{
-			if ( instanceCount )
+			auto & pipeline = *draw.pipeline;
+			GeometryBuffers const & geometryBuffers = ( draw.billboardNode
+				? getGeometryBuffers( shaderFlags
+					, draw.billboardNode->data
+					, *draw.pass
+					, draw.instanceCount )
+				: getGeometryBuffers( shaderFlags
+					, *draw.submesh
+					, *draw.pass
+					, draw.instanceCount ) );
+			doBindPipeline( pipeline, commandBuffer, viewport, scissor, state );
+
+			if ( draw.billboardNode )
+			{
+				doBindNodeDescriptorSets( pipeline, *draw.billboardNode, commandBuffer, state );
+			}
+			else
 			{
-				GeometryBuffers const & geometryBuffers = object.getGeometryBuffers( shaderFlags
-					, pass.getOwner()->shared_from_this()
-					, instanceCount
-					, pass.getTexturesMask() );
+				doBindNodeDescriptorSets( pipeline, *draw.submeshNode, commandBuffer, state );
+			}
 
-				commandBuffer.bindPipeline( pipeline.getPipeline() );
+			doBindGeometryBuffers( geometryBuffers, commandBuffer, state );
 
-				if ( viewport )
-				{
-					commandBuffer.setViewport( *viewport );
-				}
+			if ( geometryBuffers.ibo )
+			{
+				commandBuffer.drawIndexed( geometryBuffers.idxCount
+					, draw.instanceCount );
+			}
+			else
+			{
+				commandBuffer.draw( geometryBuffers.vtxCount
+					, draw.instanceCount );
+			}
+		}
+
+		QueueCulledRenderNodes::BindCounts doRecordDraws( RenderQueue const & queue
+			, QueueCulledRenderNodes::Draw const * begin
+			, QueueCulledRenderNodes::Draw const * end
+			, ashes::CommandBuffer const & commandBuffer
+			, ashes::Optional< VkViewport > const & viewport
+			, ashes::Optional< VkRect2D > const & scissor )
+		{
+			commandBuffer.begin( VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT
+				, makeVkType< VkCommandBufferInheritanceInfo >( VkRenderPass( queue.getOwner()->getRenderPass() )
+					, 0u
+					, VkFramebuffer( VK_NULL_HANDLE )
+					, VkBool32( VK_FALSE )
+					, 0u
+					, 0u ) );
+			auto & shaderFlags = queue.getOwner()->getShaderFlags();
+			BindState state;
+
+			for ( auto draw = begin; draw != end; ++draw )
+			{
+				doAddRenderNodeCommands( *draw
+					, shaderFlags
+					, commandBuffer
+					, viewport
+					, scissor
+					, state );
+			}
 
-				if ( scissor )
+			commandBuffer.end();
+			return state.counts;
+		}
+
+		//*****************************************************************************************
+
+		// Each sort key component is a 16 bits index.
+		uint64_t constexpr SortKeyComponentMask = 0xFFFFu;
+
+		uint64_t getSortKeyIndex( std::unordered_map< void const *, uint64_t > & indices
+			, void const * object )
+		{
+			// The indices are given in first appearance order, and saturate when there are too many objects.
+			auto index = std::min( uint64_t( indices.size() ), SortKeyComponentMask );
+			return indices.emplace( object, index ).first->second;
+		}
+
+		castor::Point3f getPosition( QueueCulledRenderNodes::Draw const & draw )
+		{
+			SceneNode const * node = ( draw.billboardNode
+				? draw.billboardNode->instance.getNode()
+				: draw.submeshNode->instance.getParent() );
+			return node
+				? node->getDerivedPosition()
+				: castor::Point3f{};
+		}
+
+		void doComputeSortKeys( std::vector< QueueCulledRenderNodes::Draw > & draws
+			, Camera const & camera )
+		{
+			std::unordered_map< void const *, uint64_t > pipelines;
+			std::unordered_map< void const *, uint64_t > passes;
+			std::unordered_map< void const *, uint64_t > geometries;
+			std::vector< double > distances;
+			distances.reserve( draws.size() );
+			auto cameraPosition = camera.getParent()
+				? camera.getParent()->getDerivedPosition()
+				: castor::Point3f{};
+			auto minDistance = std::numeric_limits< double >::max();
+			auto maxDistance = 0.0;
+
+			for ( auto & draw : draws )
+			{
+				auto distance = castor::point::distanceSquared( getPosition( draw ), cameraPosition );
+				minDistance = std::min( minDistance, distance );
+				maxDistance = std::max( maxDistance, distance );
+				distances.push_back( distance );
+			}
+
+			auto range = maxDistance - minDistance;
+
+			for ( size_t i = 0u; i < draws.size(); ++i )
+			{
+				auto & draw = draws[i];
+				auto depth = ( range > 0.0
+					? uint64_t( ( distances[i] - minDistance ) * double( SortKeyComponentMask ) / range )
+					: 0u );
+
+				void const * geometry = ( draw.billboardNode
+					? static_cast< void const * >( &draw.billboardNode->data )
+					: static_cast< void const * >( draw.submesh ) );
+				auto pipelineIndex = getSortKeyIndex( pipelines, draw.pipeline );
+				auto passIndex = getSortKeyIndex( passes, draw.pass );
+				auto geometryIndex = getSortKeyIndex( geometries, geometry );
+
+				// The blended nodes are drawn back to front, so the depth comes right after the pipeline,
+				// the other ones are grouped by state, and drawn front to back inside a group.
+				if ( checkFlag( draw.pipeline->getFlags().passFlags, PassFlag::eAlphaBlending ) )
 				{
-					commandBuffer.setScissor( *scissor );
+					depth = SortKeyComponentMask - depth;
+					draw.sortKey = ( pipelineIndex << 48u )
+						| ( ( depth & SortKeyComponentMask ) << 32u )
+						| ( passIndex << 16u )
+						| geometryIndex;
 				}
-
-				if ( node.uboDescriptorSet )
+				else
 				{
-					commandBuffer.bindDescriptorSet( *node.uboDescriptorSet, pipeline.getPipelineLayout() );
+					draw.sortKey = ( pipelineIndex << 48u )
+						| ( passIndex << 32u )
+						| ( geometryIndex << 16u )
+						| ( depth & SortKeyComponentMask );
 				}
+			}
+		}
 
-				if ( node.texDescriptorSet )
+		// Stable LSD radix sort on the sort keys, one byte per pass.
+		void doRadixSort( std::vector< QueueCulledRenderNodes::Draw > & draws )
+		{
+			std::vector< QueueCulledRenderNodes::Draw > buffer( draws.size() );
+			std::array< size_t, 256u > offsets;
+
+			for ( uint32_t shift = 0u; shift < 64u; shift += 8u )
+			{
+				offsets.fill( 0u );
+
+				for ( auto & draw : draws )
 				{
-					commandBuffer.bindDescriptorSet( *node.texDescriptorSet, pipeline.getPipelineLayout() );
+					++offsets[( draw.sortKey >> shift ) & 0xFFu];
 				}
 
-				if ( pipeline.hasDescriptorSetLayout() )
+				// All the keys share the same byte, nothing to sort at this pass.
+				if ( offsets[( draws.front().sortKey >> shift ) & 0xFFu] == draws.size() )
 				{
-					commandBuffer.bindDescriptorSet( pipeline.getAdditionalDescriptorSet( node ), pipeline.getPipelineLayout() );
+					continue;
 				}
 
-				for ( uint32_t i = 0; i < geometryBuffers.vbo.size(); ++i )
+				size_t offset = 0u;
+
+				for ( auto & count : offsets )
 				{
-					commandBuffer.bindVertexBuffer( geometryBuffers.layouts[i].get().vertexBindingDescriptions[0].binding
-						, geometryBuffers.vbo[i]
-						, geometryBuffers.vboOffsets[i] );
+					auto current = count;
+					count = offset;
+					offset += current;
 				}
 
-				if ( geometryBuffers.ibo )
+				for ( auto & draw : draws )
 				{
-					commandBuffer.bindIndexBuffer( *geometryBuffers.ibo
-						, geometryBuffers.iboOffset
-						, VK_INDEX_TYPE_UINT32 );
-					commandBuffer.drawIndexed( geometryBuffers.idxCount
-						, instanceCount );
+					buffer[offsets[( draw.sortKey >> shift ) & 0xFFu]++] = draw;
 				}
-				else
+
+				std::swap( draws, buffer );
+			}
+		}
+
+		template< typename MapType, typename FuncType >
+		void doTraverseNodes( MapType & nodes
+			, FuncType function )
+		{
+			for ( auto & itPipelines : nodes )
+			{
+				for ( auto & itPass : itPipelines.second )
 				{
-					commandBuffer.draw( geometryBuffers.vtxCount
-						, instanceCount );
+					for ( auto & itSubmeshes : itPass.second )
+					{
+						function( *itPipelines.first
+							, *itPass.first
+							, *itSubmeshes.first
+							, itSubmeshes.second );
+					}
 				}
 			}
 		}
 
-		template< typename NodeT >
-		void doParseInstantiatedRenderNodesCommands( ashes::CommandBuffer const & commandBuffer
-			, ashes::Optional< VkViewport > const & viewport
-			, ashes::Optional< VkRect2D > const & scissor
-			, RenderPipeline & pipeline
-			, ShaderFlags const & shaderFlags
-			, Pass & pass
-			, Submesh & submesh
-			, NodePtrArrayT< NodeT > & renderNodes
-			, uint32_t instanceMult )
+		void doFlattenInstantiatedNodes( SubmeshRenderNodesPtrByPipelineMap & nodes
+			, uint32_t instanceMult
+			, std::vector< QueueCulledRenderNodes::Draw > & draws )
 		{
-			doAddRenderNodeCommands( pass
-				, pipeline
-				, shaderFlags
-				, *renderNodes[0]
-				, submesh
-				, commandBuffer
-				, viewport
-				, scissor
-				, uint32_t( renderNodes.size() * instanceMult ) );
+			doTraverseNodes( nodes
+				, [instanceMult, &draws]( RenderPipeline & pipeline
+					, Pass & pass
+					, Submesh & submesh
+					, SubmeshRenderNodePtrArray & renderNodes )
+				{
+					auto instanceCount = uint32_t( renderNodes.size() * instanceMult );
+
+					if ( instanceCount )
+					{
+						draws.push_back( { &pipeline
+							, renderNodes[0]
+							, nullptr
+							, &pass
+							, &submesh
+							, instanceCount } );
+					}
+				} );
 		}
 
-		template< typename NodeT >
-		void doParseRenderNodesCommands( NodePtrByPipelineMapT <NodeT > & inputNodes
-			, ashes::CommandBuffer const & commandBuffer
-			, ashes::Optional< VkViewport > const & viewport
-			, ashes::Optional< VkRect2D > const & scissor
-			, ShaderFlags const & shaderFlags
-			, uint32_t instanceMult )
+		void doFlattenNodes( SubmeshRenderNodePtrByPipelineMap & nodes
+			, uint32_t instanceMult
+			, std::vector< QueueCulledRenderNodes::Draw > & draws )
 		{
-			for ( auto & pipelines : inputNodes )
+			if ( !instanceMult )
 			{
-				for ( auto & node : pipelines.second )
-				{
-					doAddRenderNodeCommands( *pipelines.first
-						, shaderFlags
-						, *node
-						, commandBuffer
-						, viewport
-						, scissor
-						, instanceMult );
-				}
+				return;
 			}
-		}
 
-		template<>
-		void doParseRenderNodesCommands( BillboardRenderNodePtrByPipelineMap & inputNodes
-			, ashes::CommandBuffer const & commandBuffer
-			, ashes::Optional< VkViewport > const & viewport
-			, ashes::Optional< VkRect2D > const & scissor
-			, ShaderFlags const & shaderFlags
-			, uint32_t instanceMult )
-		{
-			for ( auto & pipelines : inputNodes )
+			for ( auto & pipelines : nodes )
 			{
 				for ( auto & node : pipelines.second )
 				{
-					doAddRenderNodeCommands( *pipelines.first
-						, shaderFlags
-						, *node
-						, commandBuffer
-						, viewport
-						, scissor
-						, node->instance.getCount() );
+					draws.push_back( { pipelines.first
+						, node
+						, nullptr
+						, &node->passNode.pass
+						, &node->data
+						, instanceMult } );
 				}
 			}
 		}
 
-		template< typename MapType, typename FuncType >
-		void doTraverseNodes( MapType & nodes
-			, FuncType function )
+		void doFlattenNodes( BillboardRenderNodePtrByPipelineMap & nodes
+			, uint32_t instanceMult
+			, std::vector< QueueCulledRenderNodes::Draw > & draws )
 		{
-			for ( auto & itPipelines : nodes )
+			for ( auto & pipelines : nodes )
 			{
-				for ( auto & itPass : itPipelines.second )
+				for ( auto & node : pipelines.second )
 				{
-					for ( auto & itSubmeshes : itPass.second )
+					auto instanceCount = node->instance.getCount();
+
+					if ( instanceCount )
 					{
-						function( *itPipelines.first
-							, *itPass.first
-							, *itSubmeshes.first
-							, itSubmeshes.second );
+						draws.push_back( { pipelines.first
+							, nullptr
+							, node
+							, &node->passNode.pass
+							, nullptr
+							, instanceCount } );
 					}
 				}
 			}
@@ -359,6 +590,9 @@ namespace castor3d
 	{
 		auto & queue = *getOwner();
 		auto & culler = queue.getOwner()->getCuller();
+		auto & jobs = culler.getScene().getEngine()->getCpuJobs();
+		auto & visibleSubmeshes = culler.getVisibleSubmeshes( queue.getMode() );
+		auto & visibleBillboards = culler.getVisibleBillboards( queue.getMode() );
 
 		auto & allNodes = queue.getAllRenderNodes();
 		instancedStaticNodes.backCulled.clear();
@@ -375,7 +609,7 @@ namespace castor3d
 		billboardNodes.frontCulled.clear();
 
 		doTraverseNodes( allNodes.instancedStaticNodes.frontCulled
-			, [this, &queue, &culler]( RenderPipeline & pipeline
+			, [this, &visibleSubmeshes]( RenderPipeline & pipeline
 				, Pass & pass
 				, Submesh & submesh
 				, SubmeshRenderNodeMap & nodes )
@@ -384,10 +618,10 @@ namespace castor3d
 					, pipeline
 					, pass
 					, nodes
-					, culler.getCulledSubmeshes( queue.getMode() ) );
+					, visibleSubmeshes );
 			} );
 		doTraverseNodes( allNodes.instancedStaticNodes.backCulled
-			, [this, &queue, &culler]( RenderPipeline & pipeline
+			, [this, &visibleSubmeshes]( RenderPipeline & pipeline
 				, Pass & pass
 				, Submesh & submesh
 				, SubmeshRenderNodeMap & nodes )
@@ -396,10 +630,10 @@ namespace castor3d
 					, pipeline
 					, pass
 					, nodes
-					, culler.getCulledSubmeshes( queue.getMode() ) );
+					, visibleSubmeshes );
 			} );
 		doTraverseNodes( allNodes.instancedSkinnedNodes.frontCulled
-			, [this, &queue, &culler]( RenderPipeline & pipeline
+			, [this, &visibleSubmeshes]( RenderPipeline & pipeline
 				, Pass & pass
 				, Submesh & submesh
 				, SubmeshRenderNodeMap & nodes )
@@ -408,10 +642,10 @@ namespace castor3d
 					, pipeline
 					, pass
 					, nodes
-					, culler.getCulledSubmeshes( queue.getMode() ) );
+					, visibleSubmeshes );
 			} );
 		doTraverseNodes( allNodes.instancedSkinnedNodes.backCulled
-			, [this, &queue, &culler]( RenderPipeline & pipeline
+			, [this, &visibleSubmeshes]( RenderPipeline & pipeline
 				, Pass & pass
 				, Submesh & submesh
 				, SubmeshRenderNodeMap & nodes )
@@ -420,170 +654,126 @@ namespace castor3d
 					, pipeline
 					, pass
 					, nodes
-					, culler.getCulledSubmeshes( queue.getMode() ) );
+					, visibleSubmeshes );
 			} );
 
-		doParseRenderNodes( allNodes.staticNodes.frontCulled
+		doParseRenderNodes( jobs
+			, allNodes.staticNodes.frontCulled
 			, staticNodes.frontCulled
-			, culler.getCulledSubmeshes( queue.getMode() ) );
-		doParseRenderNodes( allNodes.staticNodes.backCulled
+			, visibleSubmeshes );
+		doParseRenderNodes( jobs
+			, allNodes.staticNodes.backCulled
 			, staticNodes.backCulled
-			, culler.getCulledSubmeshes( queue.getMode() ) );
+			, visibleSubmeshes );
 
-		doParseRenderNodes( allNodes.skinnedNodes.frontCulled
+		doParseRenderNodes( jobs
+			, allNodes.skinnedNodes.frontCulled
 			, skinnedNodes.frontCulled
-			, culler.getCulledSubmeshes( queue.getMode() ) );
-		doParseRenderNodes( allNodes.skinnedNodes.backCulled
+			, visibleSubmeshes );
+		doParseRenderNodes( jobs
+			, allNodes.skinnedNodes.backCulled
 			, skinnedNodes.backCulled
-			, culler.getCulledSubmeshes( queue.getMode() ) );
+			, visibleSubmeshes );
 
-		doParseRenderNodes( allNodes.morphingNodes.frontCulled
+		doParseRenderNodes( jobs
+			, allNodes.morphingNodes.frontCulled
 			, morphingNodes.frontCulled
-			, culler.getCulledSubmeshes( queue.getMode() ) );
-		doParseRenderNodes( allNodes.morphingNodes.backCulled
+			, visibleSubmeshes );
+		doParseRenderNodes( jobs
+			, allNodes.morphingNodes.backCulled
 			, morphingNodes.backCulled
-			, culler.getCulledSubmeshes( queue.getMode() ) );
+			, visibleSubmeshes );
 
-		doParseRenderNodes( allNodes.billboardNodes.frontCulled
+		doParseRenderNodes( jobs
+			, allNodes.billboardNodes.frontCulled
 			, billboardNodes.frontCulled
-			, culler.getCulledBillboards( queue.getMode() ) );
-		doParseRenderNodes( allNodes.billboardNodes.backCulled
+			, visibleBillboards );
+		doParseRenderNodes( jobs
+			, allNodes.billboardNodes.backCulled
 			, billboardNodes.backCulled
-			, culler.getCulledBillboards( queue.getMode() ) );
+			, visibleBillboards );
+	}
+
+	uint32_t QueueCulledRenderNodes::prepareDraws()
+	{
+		auto instanceMult = getOwner()->getOwner()->getInstanceMult();
+		draws.clear();
+		doFlattenInstantiatedNodes( instancedStaticNodes.frontCulled, instanceMult, draws );
+		doFlattenInstantiatedNodes( instancedStaticNodes.backCulled, instanceMult, draws );
+		doFlattenInstantiatedNodes( instancedSkinnedNodes.frontCulled, instanceMult, draws );
+		doFlattenInstantiatedNodes( instancedSkinnedNodes.backCulled, instanceMult, draws );
+		doFlattenNodes( staticNodes.frontCulled, instanceMult, draws );
+		doFlattenNodes( staticNodes.backCulled, instanceMult, draws );
+		doFlattenNodes( skinnedNodes.frontCulled, instanceMult, draws );
+		doFlattenNodes( skinnedNodes.backCulled, instanceMult, draws );
+		doFlattenNodes( morphingNodes.frontCulled, instanceMult, draws );
+		doFlattenNodes( morphingNodes.backCulled, instanceMult, draws );
+		doFlattenNodes( billboardNodes.frontCulled, instanceMult, draws );
+		doFlattenNodes( billboardNodes.backCulled, instanceMult, draws );
+
+		if ( !draws.empty() )
+		{
+			doComputeSortKeys( draws, getOwner()->getCuller().getCamera() );
+			doRadixSort( draws );
+		}
+
+		return uint32_t( draws.size() );
 	}
 
 	void QueueCulledRenderNodes::prepareCommandBuffers( RenderQueue const & queue
 		, ashes::Optional< VkViewport > const & viewport
-		, ashes::Optional< VkRect2D > const & scissors )
+		, ashes::Optional< VkRect2D > const & scissors
+		, std::vector< ashes::CommandBuffer const * > const & commandBuffers )
 	{
-		queue.getCommandBuffer().begin( VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT
-			, makeVkType< VkCommandBufferInheritanceInfo >( VkRenderPass( queue.getOwner()->getRenderPass() )
-				, 0u
-				, VkFramebuffer( VK_NULL_HANDLE )
-				, VkBool32( VK_FALSE )
-				, 0u
-				, 0u ) );
-
-		doTraverseNodes( instancedStaticNodes.frontCulled
-			, [&queue, &viewport, &scissors]( RenderPipeline & pipeline
-				, Pass & pass
-				, Submesh & submesh
-				, SubmeshRenderNodePtrArray & nodes )
-			{
-				doParseInstantiatedRenderNodesCommands( queue.getCommandBuffer()
-					, viewport
-					, scissors
-					, pipeline
-					, queue.getOwner()->getShaderFlags()
-					, pass
-					, submesh
-					, nodes
-					, queue.getOwner()->getInstanceMult() );
-			} );
-		doTraverseNodes( instancedStaticNodes.backCulled
-			, [&queue, &viewport, &scissors]( RenderPipeline & pipeline
-				, Pass & pass
-				, Submesh & submesh
-				, SubmeshRenderNodePtrArray & nodes )
-			{
-				doParseInstantiatedRenderNodesCommands( queue.getCommandBuffer()
-					, viewport
-					, scissors
-					, pipeline
-					, queue.getOwner()->getShaderFlags()
-					, pass
-					, submesh
-					, nodes
-					, queue.getOwner()->getInstanceMult() );
-			} );
-		doTraverseNodes( instancedSkinnedNodes.frontCulled
-			, [&queue, &viewport, &scissors]( RenderPipeline & pipeline
-				, Pass & pass
-				, Submesh & submesh
-				, SubmeshRenderNodePtrArray & nodes )
-			{
-				doParseInstantiatedRenderNodesCommands( queue.getCommandBuffer()
-					, viewport
-					, scissors
-					, pipeline
-					, queue.getOwner()->getShaderFlags()
-					, pass
-					, submesh
-					, nodes
-					, queue.getOwner()->getInstanceMult() );
-			} );
-		doTraverseNodes( instancedSkinnedNodes.backCulled
-			, [&queue, &viewport, &scissors]( RenderPipeline & pipeline
-				, Pass & pass
-				, Submesh & submesh
-				, SubmeshRenderNodePtrArray & nodes )
-			{
-				doParseInstantiatedRenderNodesCommands( queue.getCommandBuffer()
-					, viewport
-					, scissors
-					, pipeline
-					, queue.getOwner()->getShaderFlags()
-					, pass
-					, submesh
-					, nodes
-					, queue.getOwner()->getInstanceMult() );
-			} );
+		CU_Require( !commandBuffers.empty() );
+		auto chunkCount = commandBuffers.size();
+		auto drawCount = draws.size();
+		std::vector< BindCounts > chunksCounts( chunkCount );
+		auto recordChunk = [this, &queue, &viewport, &scissors, &commandBuffers, &chunksCounts, chunkCount, drawCount]( size_t index )
+		{
+			auto begin = draws.data() + ( index * drawCount ) / chunkCount;
+			auto end = draws.data() + ( ( index + 1u ) * drawCount ) / chunkCount;
+			chunksCounts[index] = doRecordDraws( queue
+				, begin
+				, end
+				, *commandBuffers[index]
+				, viewport
+				, scissors );
+		};
+
+		if ( chunkCount == 1u )
+		{
+			recordChunk( 0u );
+		}
+		else
+		{
+			// Each chunk is recorded in its own command buffer, allocated from its own pool.
+			castor::parallelFor( queue.getOwner()->getEngine()->getCpuJobs()
+				, size_t{ 0u }
+				, chunkCount
+				, recordChunk );
+		}
 
-		doParseRenderNodesCommands( staticNodes.frontCulled
-			, queue.getCommandBuffer()
-			, viewport
-			, scissors
-			, queue.getOwner()->getShaderFlags()
-			, queue.getOwner()->getInstanceMult() );
-		doParseRenderNodesCommands( staticNodes.backCulled
-			, queue.getCommandBuffer()
-			, viewport
-			, scissors
-			, queue.getOwner()->getShaderFlags()
-			, queue.getOwner()->getInstanceMult() );
-
-		doParseRenderNodesCommands( skinnedNodes.frontCulled
-			, queue.getCommandBuffer()
-			, viewport
-			, scissors
-			, queue.getOwner()->getShaderFlags()
-			, queue.getOwner()->getInstanceMult() );
-		doParseRenderNodesCommands( skinnedNodes.backCulled
-			, queue.getCommandBuffer()
-			, viewport
-			, scissors
-			, queue.getOwner()->getShaderFlags()
-			, queue.getOwner()->getInstanceMult() );
-
-		doParseRenderNodesCommands( morphingNodes.frontCulled
-			, queue.getCommandBuffer()
-			, viewport
-			, scissors
-			, queue.getOwner()->getShaderFlags()
-			, queue.getOwner()->getInstanceMult() );
-		doParseRenderNodesCommands( morphingNodes.backCulled
-			, queue.getCommandBuffer()
-			, viewport
-			, scissors
-			, queue.getOwner()->getShaderFlags()
-			, queue.getOwner()->getInstanceMult() );
-
-		doParseRenderNodesCommands( billboardNodes.frontCulled
-			, queue.getCommandBuffer()
-			, viewport
-			, scissors
-			, queue.getOwner()->getShaderFlags()
-			, queue.getOwner()->getInstanceMult() );
-		doParseRenderNodesCommands( billboardNodes.backCulled
-			, queue.getCommandBuffer()
-			, viewport
-			, scissors
-			, queue.getOwner()->getShaderFlags()
-			, queue.getOwner()->getInstanceMult() );
-
-		queue.getCommandBuffer().end();
+		bindCounts = {};
+
+		for ( auto & counts : chunksCounts )
+		{
+			bindCounts.pipelines += counts.pipelines;
+			bindCounts.descriptorSets += counts.descriptorSets;
+			bindCounts.buffers += counts.buffers;
+			bindCounts.skipped += counts.skipped;
+		}
 	}
 
+	void QueueCulledRenderNodes::fillInfo( RenderInfo & info )const
+	{
+		info.m_pipelineBinds += bindCounts.pipelines;
+		info.m_descriptorSetBinds += bindCounts.descriptorSets;
+		info.m_bufferBinds += bindCounts.buffers;
+		info.m_skippedBinds += bindCounts.skipped;
+	}
+
+
 	bool QueueCulledRenderNodes::hasNodes()const
 	{
 		return !staticNodes.backCulled.empty()
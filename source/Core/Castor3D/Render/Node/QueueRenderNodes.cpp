@@ -233,39 +233,66 @@ namespace castor3d
 
 		//*****************************************************************************************
 
-		void doSortRenderNodes( SceneRenderPass & renderPass
+		void doSortRenderNode( SceneRenderPass & renderPass
 			, RenderMode mode
 			, SceneNode const * ignored
+			, Scene const & scene
 			, QueueRenderNodes & nodes
-			, ShadowMapLightTypeArray const & shadowMaps )
+			, CulledSubmesh const & culledNode )
 		{
 			uint32_t instanceMult = renderPass.getInstanceMult();
-			auto & scene = nodes.getOwner()->getCuller().getScene();
+			auto & submesh = culledNode.data;
+			auto pass = culledNode.pass;
+			auto & instance = culledNode.instance;
+			auto material = pass->getOwner()->shared_from_this();
 
-			for ( auto & culledNode : renderPass.getCuller().getAllSubmeshes( mode ).objects )
+			if ( ignored != &culledNode.sceneNode )
 			{
-				auto & submesh = culledNode.data;
-				auto pass = culledNode.pass;
-				auto & instance = culledNode.instance;
-				auto material = pass->getOwner()->shared_from_this();
+				pass->prepareTextures();
 
-				if ( ignored != &culledNode.sceneNode )
+				if ( renderPass.isValidPass( *pass ) )
 				{
-					pass->prepareTextures();
+					auto programFlags = submesh.getProgramFlags( material );
+					auto sceneFlags = scene.getFlags();
+					auto textures = pass->getTexturesMask();
+					auto animated = doAdjustFlags( *renderPass.getEngine()->getRenderSystem()
+						, programFlags
+						, sceneFlags
+						, scene
+						, *pass
+						, renderPass
+						, instance.getName() );
+					auto backPipeline = renderPass.prepareBackPipeline( *pass
+						, textures
+						, programFlags
+						, sceneFlags
+						, submesh.getTopology()
+						, submesh.getGeometryBuffers( renderPass.getShaderFlags(), material, instanceMult, textures ).layouts
+						, nodes.getDescriptorSetLayouts( *pass
+							, submesh
+							, animated.mesh.get()
+							, animated.skeleton.get() ) );
 
-					if ( renderPass.isValidPass( *pass ) )
+					if ( backPipeline )
 					{
-						auto programFlags = submesh.getProgramFlags( material );
-						auto sceneFlags = scene.getFlags();
-						auto textures = pass->getTexturesMask();
-						auto animated = doAdjustFlags( *renderPass.getEngine()->getRenderSystem()
-							, programFlags
-							, sceneFlags
-							, scene
+						nodes.addRenderNode( *backPipeline
+							, animated
+							, culledNode
+							, instance
 							, *pass
+							, submesh
 							, renderPass
-							, instance.getName() );
-						auto backPipeline = renderPass.prepareBackPipeline( *pass
+							, false );
+					}
+
+					auto needsFront = ( mode == RenderMode::eTransparentOnly )
+						|| pass->isTwoSided()
+						|| renderPass.forceTwoSided()
+						|| checkFlags( textures, TextureFlag::eOpacity ) != textures.end();
+
+					if ( needsFront )
+					{
+						auto frontPipeline = renderPass.prepareFrontPipeline( *pass
 							, textures
 							, programFlags
 							, sceneFlags
@@ -276,87 +303,111 @@ namespace castor3d
 								, animated.mesh.get()
 								, animated.skeleton.get() ) );
 
-						if ( backPipeline )
+						if ( frontPipeline )
 						{
-							nodes.addRenderNode( *backPipeline
+							nodes.addRenderNode( *frontPipeline
 								, animated
 								, culledNode
 								, instance
 								, *pass
 								, submesh
 								, renderPass
-								, false );
+								, true );
 						}
+					}
+				}
+			}
+		}
 
-						auto needsFront = ( mode == RenderMode::eTransparentOnly )
-							|| pass->isTwoSided()
-							|| renderPass.forceTwoSided()
-							|| checkFlags( textures, TextureFlag::eOpacity ) != textures.end();
+		void doSortRenderNode( SceneRenderPass & renderPass
+			, Scene const & scene
+			, QueueRenderNodes & nodes
+			, CulledBillboard const & culledNode )
+		{
+			auto & billboard = culledNode.data;
+			auto & pass = culledNode.pass;
 
-						if ( needsFront )
-						{
-							auto frontPipeline = renderPass.prepareFrontPipeline( *pass
-								, textures
-								, programFlags
-								, sceneFlags
-								, submesh.getTopology()
-								, submesh.getGeometryBuffers( renderPass.getShaderFlags(), material, instanceMult, textures ).layouts
-								, nodes.getDescriptorSetLayouts( *pass
-									, submesh
-									, animated.mesh.get()
-									, animated.skeleton.get() ) );
-
-							if ( frontPipeline )
-							{
-								nodes.addRenderNode( *frontPipeline
-									, animated
-									, culledNode
-									, instance
-									, *pass
-									, submesh
-									, renderPass
-									, true );
-							}
-						}
-					}
+			pass->prepareTextures();
+			auto programFlags = billboard.getProgramFlags();
+			addFlag( programFlags, ProgramFlag::eBillboards );
+
+			if ( renderPass.isValidPass( *pass )
+				&& !isShadowMapProgram( programFlags ) )
+			{
+				auto sceneFlags = scene.getFlags();
+				auto textures = pass->getTexturesMask();
+				auto pipeline = renderPass.prepareBackPipeline( *pass
+					, textures
+					, programFlags
+					, sceneFlags
+					, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP
+					, billboard.getGeometryBuffers().layouts
+					, nodes.getDescriptorSetLayouts( *pass
+						, billboard ) );
+
+				if ( pipeline )
+				{
+					nodes.addRenderNode( *pipeline
+						, culledNode
+						, *pass
+						, billboard
+						, renderPass );
 				}
 			}
+		}
+
+		void doSortRenderNodes( SceneRenderPass & renderPass
+			, RenderMode mode
+			, SceneNode const * ignored
+			, QueueRenderNodes & nodes
+			, ShadowMapLightTypeArray const & shadowMaps )
+		{
+			auto & scene = nodes.getOwner()->getCuller().getScene();
+
+			for ( auto & culledNode : renderPass.getCuller().getAllSubmeshes( mode ).objects )
+			{
+				doSortRenderNode( renderPass, mode, ignored, scene, nodes, culledNode );
+			}
 
 			for ( auto & culledNode : renderPass.getCuller().getAllBillboards( mode ).objects )
 			{
-				auto & billboard = culledNode.data;
-				auto & pass = culledNode.pass;
+				doSortRenderNode( renderPass, scene, nodes, culledNode );
+			}
+		}
 
-				pass->prepareTextures();
-				auto programFlags = billboard.getProgramFlags();
-				addFlag( programFlags, ProgramFlag::eBillboards );
+		template< typename CulledT, typename NodeT >
+		void doRemoveRenderNodes( std::unordered_set< CulledT const * > const & removed
+			, std::map< CulledT const *, NodeT * > & nodes )
+		{
+			for ( auto culled : removed )
+			{
+				nodes.erase( culled );
+			}
+		}
 
-				if ( renderPass.isValidPass( *pass )
-					&& !isShadowMapProgram( programFlags ) )
-				{
-					auto sceneFlags = scene.getFlags();
-					auto textures = pass->getTexturesMask();
-					auto pipeline = renderPass.prepareBackPipeline( *pass
-						, textures
-						, programFlags
-						, sceneFlags
-						, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP
-						, billboard.getGeometryBuffers().layouts
-						, nodes.getDescriptorSetLayouts( *pass
-							, billboard ) );
+		template< typename CulledT, typename KeyT, typename MapT >
+		void doRemoveRenderNodes( std::unordered_set< CulledT const * > const & removed
+			, std::map< KeyT, MapT > & nodes )
+		{
+			auto it = nodes.begin();
 
-					if ( pipeline )
-					{
-						nodes.addRenderNode( *pipeline
-							, culledNode
-							, *pass
-							, billboard
-							, renderPass );
-					}
-				}
+			while ( it != nodes.end() )
+			{
+				doRemoveRenderNodes( removed, it->second );
+				it = it->second.empty()
+					? nodes.erase( it )
+					: std::next( it );
 			}
 		}
 
+		template< typename CulledT, typename NodeT, typename MapT >
+		void doRemoveRenderNodes( std::unordered_set< CulledT const * > const & removed
+			, RenderNodesT< NodeT, MapT > & nodes )
+		{
+			doRemoveRenderNodes( removed, nodes.frontCulled );
+			doRemoveRenderNodes( removed, nodes.backCulled );
+		}
+
 		//*****************************************************************************************
 
 		template< typename NodeT >
@@ -417,7 +468,7 @@ namespace castor3d
 	{
 	}
 
-	void QueueRenderNodes::parse( ShadowMapLightTypeArray & shadowMaps )
+	void QueueRenderNodes::parse( ShadowMapLightTypeArray const & shadowMaps )
 	{
 		auto & queue = *getOwner();
 		instancedStaticNodes.backCulled.clear();
@@ -438,8 +489,52 @@ namespace castor3d
 			, queue.getIgnoredNode()
 			, *this
 			, shadowMaps );
+	}
 
+	void QueueRenderNodes::update( SceneCuller::CulledDeltaT< CulledSubmesh > const & submeshes
+		, SceneCuller::CulledDeltaT< CulledBillboard > const & billboards )
+	{
+		auto & queue = *getOwner();
 		auto & renderPass = *queue.getOwner();
+		auto & scene = queue.getCuller().getScene();
+
+		// Removals first, an added object may have been allocated at a removed one's address.
+		if ( !submeshes.removed.empty() )
+		{
+			doRemoveRenderNodes( submeshes.removed, staticNodes );
+			doRemoveRenderNodes( submeshes.removed, skinnedNodes );
+			doRemoveRenderNodes( submeshes.removed, instancedStaticNodes );
+			doRemoveRenderNodes( submeshes.removed, instancedSkinnedNodes );
+			doRemoveRenderNodes( submeshes.removed, morphingNodes );
+		}
+
+		if ( !billboards.removed.empty() )
+		{
+			doRemoveRenderNodes( billboards.removed, billboardNodes );
+		}
+
+		for ( auto culledNode : submeshes.added )
+		{
+			doSortRenderNode( renderPass
+				, queue.getMode()
+				, queue.getIgnoredNode()
+				, scene
+				, *this
+				, *culledNode );
+		}
+
+		for ( auto culledNode : billboards.added )
+		{
+			doSortRenderNode( renderPass
+				, scene
+				, *this
+				, *culledNode );
+		}
+	}
+
+	void QueueRenderNodes::initialiseNodes( ShadowMapLightTypeArray const & shadowMaps )
+	{
+		auto & renderPass = *getOwner()->getOwner();
 		renderPass.getEngine()->sendEvent( makeGpuFunctorEvent( EventType::ePreRender
 			, [&renderPass, this, shadowMaps]( RenderDevice const & device )
 			{
@@ -54,6 +54,7 @@ namespace castor3d
 
 	DepthPass::~DepthPass()
 	{
+		cleanupPrewarm();
 	}
 
 	TextureFlags DepthPass::getTexturesMask()const
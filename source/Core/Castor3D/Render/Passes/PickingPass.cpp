@@ -172,6 +172,7 @@ namespace castor3d
 
 	PickingPass::~PickingPass()
 	{
+		cleanupPrewarm();
 		for ( auto & ubo : m_submeshBuffers )
 		{
 			m_device.uboPools->putBuffer( ubo.second );
@@ -0,0 +1,323 @@
+#include "Castor3D/Render/PipelineManifest.hpp"
+
+#include "Castor3D/Miscellaneous/Logger.hpp"
+#include "Castor3D/Miscellaneous/Version.hpp"
+
+#include <CastorUtils/Data/BinaryFile.hpp>
+#include <CastorUtils/Miscellaneous/Hash.hpp>
+#include <CastorUtils/Miscellaneous/StringUtils.hpp>
+
+#include <cstring>
+
+namespace castor3d
+{
+	namespace
+	{
+		// Bump this when the file layout changes.
+		uint32_t constexpr ManifestRevision = 1u;
+		uint32_t constexpr ManifestMagic = 0x4D503343u; // "C3PM"
+
+		struct FileHeader
+		{
+			uint32_t magic;
+			uint32_t revision;
+			uint32_t engineVersion;
+			uint32_t variantCount;
+			uint64_t checksum;
+		};
+
+		template< typename DataT >
+		void write( castor::ByteArray & buffer
+			, DataT const & value )
+		{
+			auto begin = reinterpret_cast< uint8_t const * >( &value );
+			buffer.insert( buffer.end(), begin, begin + sizeof( DataT ) );
+		}
+
+		template< typename DataT >
+		bool read( castor::ByteArray const & buffer
+			, size_t & offset
+			, DataT & value )
+		{
+			if ( offset + sizeof( DataT ) > buffer.size() )
+			{
+				return false;
+			}
+
+			std::memcpy( &value, buffer.data() + offset, sizeof( DataT ) );
+			offset += sizeof( DataT );
+			return true;
+		}
+
+		void write( castor::ByteArray & buffer
+			, castor::String const & passName
+			, PipelineFlags const & flags )
+		{
+			auto name = castor::string::stringCast< char >( passName );
+			write( buffer, uint32_t( name.size() ) );
+			buffer.insert( buffer.end(), name.begin(), name.end() );
+			write( buffer, uint8_t( flags.colourBlendMode ) );
+			write( buffer, uint8_t( flags.alphaBlendMode ) );
+			write( buffer, uint16_t( flags.passFlags ) );
+			write( buffer, uint16_t( flags.passType ) );
+			write( buffer, uint32_t( flags.heightMapIndex ) );
+			write( buffer, uint32_t( flags.programFlags ) );
+			write( buffer, uint16_t( flags.sceneFlags ) );
+			write( buffer, uint32_t( flags.topology ) );
+			write( buffer, uint32_t( flags.alphaFunc ) );
+			write( buffer, uint32_t( flags.blendAlphaFunc ) );
+			write( buffer, uint32_t( flags.textures.size() ) );
+
+			for ( auto & texture : flags.textures )
+			{
+				write( buffer, uint32_t( texture.id ) );
+				write( buffer, uint16_t( texture.flags ) );
+			}
+		}
+
+		bool read( castor::ByteArray const & buffer
+			, size_t & offset
+			, castor::String & passName
+			, PipelineFlags & flags )
+		{
+			uint32_t nameSize{};
+
+			if ( !read( buffer, offset, nameSize )
+				|| offset + nameSize > buffer.size() )
+			{
+				return false;
+			}
+
+			passName = castor::string::stringCast< castor::xchar >( std::string{ buffer.begin() + offset
+				, buffer.begin() + offset + nameSize } );
+			offset += nameSize;
+			uint8_t colourBlendMode{};
+			uint8_t alphaBlendMode{};
+			uint16_t passFlags{};
+			uint16_t passType{};
+			uint32_t heightMapIndex{};
+			uint32_t programFlags{};
+			uint16_t sceneFlags{};
+			uint32_t topology{};
+			uint32_t alphaFunc{};
+			uint32_t blendAlphaFunc{};
+			uint32_t textureCount{};
+			bool result = read( buffer, offset, colourBlendMode )
+				&& read( buffer, offset, alphaBlendMode )
+				&& read( buffer, offset, passFlags )
+				&& read( buffer, offset, passType )
+				&& read( buffer, offset, heightMapIndex )
+				&& read( buffer, offset, programFlags )
+				&& read( buffer, offset, sceneFlags )
+				&& read( buffer, offset, topology )
+				&& read( buffer, offset, alphaFunc )
+				&& read( buffer, offset, blendAlphaFunc )
+				&& read( buffer, offset, textureCount )
+				&& offset + textureCount * ( sizeof( uint32_t ) + sizeof( uint16_t ) ) <= buffer.size();
+			TextureFlagsArray textures;
+
+			for ( uint32_t i = 0u; result && i < textureCount; ++i )
+			{
+				uint32_t id{};
+				uint16_t textureFlags{};
+				result = read( buffer, offset, id )
+					&& read( buffer, offset, textureFlags );
+				textures.push_back( { TextureFlags( textureFlags ), id } );
+			}
+
+			if ( result )
+			{
+				flags = PipelineFlags{ BlendMode( colourBlendMode )
+					, BlendMode( alphaBlendMode )
+					, PassFlags( passFlags )
+					, PassTypeID( passType )
+					, heightMapIndex
+					, ProgramFlags( programFlags )
+					, SceneFlags( sceneFlags )
+					, VkPrimitiveTopology( topology )
+					, VkCompareOp( alphaFunc )
+					, VkCompareOp( blendAlphaFunc )
+					, std::move( textures ) };
+			}
+
+			return result;
+		}
+	}
+
+	PipelineManifest::PipelineManifest( castor::Path file )
+		: m_file{ std::move( file ) }
+	{
+	}
+
+	bool PipelineManifest::load()
+	{
+		auto lock( castor::makeUniqueLock( m_mutex ) );
+		return doLoad();
+	}
+
+	bool PipelineManifest::save()
+	{
+		if ( !isEnabled() )
+		{
+			return false;
+		}
+
+		auto lock( castor::makeUniqueLock( m_mutex ) );
+		// Reload the file, to keep the variants saved meanwhile by other runs.
+		doLoad();
+		castor::ByteArray content( sizeof( FileHeader ) );
+		uint32_t count{};
+
+		for ( auto & pass : m_variants )
+		{
+			for ( auto & variant : pass.second )
+			{
+				write( content, pass.first, variant.first );
+				++count;
+			}
+		}
+
+		FileHeader header{ ManifestMagic
+			, ManifestRevision
+			, Version{}.getVkVersion()
+			, count
+			, castor::hashBytes( content.data() + sizeof( FileHeader ), content.size() - sizeof( FileHeader ) ) };
+		std::memcpy( content.data(), &header, sizeof( FileHeader ) );
+		bool result = false;
+
+		try
+		{
+			auto folder = m_file.getPath();
+
+			if ( !folder.empty()
+				&& !castor::File::directoryExists( folder ) )
+			{
+				castor::File::directoryCreate( folder );
+			}
+
+			castor::BinaryFile file{ m_file, castor::File::OpenMode::eWrite };
+			result = file.writeArray( content.data(), content.size() ) == content.size();
+		}
+		catch ( std::exception & exc )
+		{
+			log::warn << "PipelineManifest: Couldn't write [" << m_file << "]: " << exc.what() << std::endl;
+		}
+
+		return result;
+	}
+
+	void PipelineManifest::record( castor::String const & passName
+		, PipelineFlags const & flags )
+	{
+		auto lock( castor::makeUniqueLock( m_mutex ) );
+		auto & variants = m_variants[passName];
+		auto ires = variants.emplace( flags, Origin::eUsedOnly );
+
+		if ( ires.second )
+		{
+			++m_statistics.misses;
+		}
+		else if ( ires.first->second == Origin::eFile )
+		{
+			ires.first->second = Origin::eUsedFromFile;
+			++m_statistics.hits;
+		}
+	}
+
+	void PipelineManifest::notifyPrewarmed()
+	{
+		auto lock( castor::makeUniqueLock( m_mutex ) );
+		++m_statistics.prewarmed;
+	}
+
+	std::vector< PipelineFlags > PipelineManifest::getVariants( castor::String const & passName )const
+	{
+		std::vector< PipelineFlags > result;
+		auto lock( castor::makeUniqueLock( m_mutex ) );
+		auto it = m_variants.find( passName );
+
+		if ( it != m_variants.end() )
+		{
+			for ( auto & variant : it->second )
+			{
+				result.push_back( variant.first );
+			}
+		}
+
+		return result;
+	}
+
+	PipelineManifest::Statistics PipelineManifest::getStatistics()const
+	{
+		auto lock( castor::makeUniqueLock( m_mutex ) );
+		return m_statistics;
+	}
+
+	bool PipelineManifest::doLoad()
+	{
+		if ( !isEnabled()
+			|| !castor::File::fileExists( m_file ) )
+		{
+			return false;
+		}
+
+		castor::ByteArray content;
+
+		try
+		{
+			castor::BinaryFile file{ m_file, castor::File::OpenMode::eRead };
+			content.resize( size_t( file.getLength() ) );
+
+			if ( file.readArray( content.data(), content.size() ) != content.size() )
+			{
+				content.clear();
+			}
+		}
+		catch ( std::exception & exc )
+		{
+			log::warn << "PipelineManifest: Couldn't read [" << m_file << "]: " << exc.what() << std::endl;
+			return false;
+		}
+
+		FileHeader header{};
+		bool result = content.size() >= sizeof( FileHeader );
+
+		if ( result )
+		{
+			std::memcpy( &header, content.data(), sizeof( FileHeader ) );
+			result = header.magic == ManifestMagic
+				&& header.revision == ManifestRevision
+				&& header.engineVersion == Version{}.getVkVersion()
+				&& header.checksum == castor::hashBytes( content.data() + sizeof( FileHeader )
+					, content.size() - sizeof( FileHeader ) );
+		}
+
+		std::vector< std::pair< castor::String, PipelineFlags > > variants;
+		size_t offset = sizeof( FileHeader );
+
+		for ( uint32_t i = 0u; result && i < header.variantCount; ++i )
+		{
+			castor::String passName;
+			PipelineFlags flags;
+			result = read( content, offset, passName, flags );
+			variants.emplace_back( std::move( passName ), std::move( flags ) );
+		}
+
+		if ( !result
+			|| offset != content.size() )
+		{
+			log::warn << "PipelineManifest: Invalid or outdated manifest [" << m_file << "], it will be regenerated." << std::endl;
+			return false;
+		}
+
+		for ( auto & variant : variants )
+		{
+			if ( m_variants[variant.first].emplace( variant.second, Origin::eFile ).second )
+			{
+				++m_statistics.loaded;
+			}
+		}
+
+		return true;
+	}
+}
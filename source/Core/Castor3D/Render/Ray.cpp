@@ -4,6 +4,7 @@
 #include "Castor3D/Model/Mesh/Submesh/Submesh.hpp"
 #include "Castor3D/Scene/Camera.hpp"
 #include "Castor3D/Scene/Geometry.hpp"
+#include "Castor3D/Scene/Scene.hpp"
 #include "Castor3D/Scene/SceneNode.hpp"
 
 using namespace castor;
@@ -281,10 +282,55 @@ namespace castor3d
 		, SubmeshSPtr & nearestSubmesh
 		, float & distance )const
 	{
-		MeshSPtr mesh = geometry->getMesh();
-		castor::Point3f center{ geometry->getParent()->getDerivedPosition() };
+		return doIntersects( *geometry, nearestFace, nearestSubmesh, distance );
+	}
+
+	Intersection Ray::intersects( Scene const & scene
+		, Geometry *& nearestGeometry
+		, Face & nearestFace
+		, SubmeshSPtr & nearestSubmesh
+		, float & distance )const
+	{
+		auto result = Intersection::eOut;
+		distance = std::numeric_limits< float >::max();
+		scene.getGeometryBvh().raycast( m_origin
+			, m_direction
+			, distance
+			, [&]( void * data, float boxDistance )
+			{
+				auto & geometry = *static_cast< Geometry * >( data );
+				Face face{ 0u, 0u, 0u };
+				SubmeshSPtr submesh;
+				float geometryDistance = 0.0f;
+
+				if ( boxDistance < distance
+					&& geometry.getParent()
+					&& geometry.getMesh()
+					&& doIntersects( geometry, face, submesh, geometryDistance ) != Intersection::eOut
+					&& geometryDistance < distance )
+				{
+					result = Intersection::eIn;
+					nearestGeometry = &geometry;
+					nearestFace = face;
+					nearestSubmesh = submesh;
+					distance = geometryDistance;
+				}
+
+				// Farther geometries don't need to be tested anymore.
+				return distance;
+			} );
+		return result;
+	}
+
+	Intersection Ray::doIntersects( Geometry const & geometry
+		, Face & nearestFace
+		, SubmeshSPtr & nearestSubmesh
+		, float & distance )const
+	{
+		MeshSPtr mesh = geometry.getMesh();
+		castor::Point3f center{ geometry.getParent()->getDerivedPosition() };
 		BoundingSphere sphere{ center, mesh->getBoundingSphere().getRadius() };
-		castor::Matrix4x4f const & transform{ geometry->getParent()->getDerivedTransformationMatrix() };
+		castor::Matrix4x4f const & transform{ geometry.getParent()->getDerivedTransformationMatrix() };
 		auto result = Intersection::eOut;
 		float faceDist = std::numeric_limits< float >::max();
 
@@ -1,14 +1,21 @@
 #include "Castor3D/Render/RenderDevice.hpp"
 
+#include "Castor3D/Engine.hpp"
 #include "Castor3D/Buffer/GpuBufferPool.hpp"
 #include "Castor3D/Buffer/UniformBufferPools.hpp"
 #include "Castor3D/Render/RenderSystem.hpp"
 #include "Castor3D/Miscellaneous/Logger.hpp"
 
+#include <CastorUtils/Data/BinaryFile.hpp>
+#include <CastorUtils/Miscellaneous/Hash.hpp>
+
 #include <ashespp/Core/Instance.hpp>
 
 #include <RenderGraph/GraphContext.hpp>
 
+#include <cstring>
+#include <iomanip>
+
 CU_ImplementCUSmartPtr( castor3d, RenderDevice )
 
 namespace castor3d
@@ -94,6 +101,159 @@ namespace castor3d
 				, extensions
 				, gpu.getFeatures() };
 		}
+
+		// Bump this when the file layout changes.
+		uint32_t constexpr PipelineCacheRevision = 1u;
+		uint32_t constexpr PipelineCacheMagic = 0x43504333u; // "C3PC"
+		// Bigger caches are neither loaded nor saved, to prevent a driver from bloating the disk or the startup.
+		size_t constexpr MaxPipelineCacheSize = 64u * 1024u * 1024u;
+
+		struct PipelineCacheFileHeader
+		{
+			uint32_t magic;
+			uint32_t revision;
+			uint32_t vendorID;
+			uint32_t deviceID;
+			uint32_t driverVersion;
+			uint32_t dataSize;
+			uint8_t pipelineCacheUUID[VK_UUID_SIZE];
+			uint64_t checksum;
+		};
+
+		// Layout of the header the Vulkan specification mandates at the beginning of the pipeline cache data.
+		struct DriverPipelineCacheHeader
+		{
+			uint32_t headerSize;
+			uint32_t headerVersion;
+			uint32_t vendorID;
+			uint32_t deviceID;
+			uint8_t pipelineCacheUUID[VK_UUID_SIZE];
+		};
+
+		castor::Path getPipelineCacheFile( AshPluginDescription const & desc
+			, VkPhysicalDeviceProperties const & properties )
+		{
+			std::stringstream stream;
+			stream << desc.name
+				<< "_" << std::hex << std::setw( 4 ) << std::setfill( '0' ) << properties.vendorID
+				<< "_" << std::hex << std::setw( 4 ) << std::setfill( '0' ) << properties.deviceID
+				<< ".pcache";
+			return Engine::getEngineDirectory() / cuT( "PipelineCache" ) / castor::Path{ stream.str() };
+		}
+
+		bool isCompatible( VkPhysicalDeviceProperties const & properties
+			, uint32_t vendorID
+			, uint32_t deviceID
+			, uint8_t const * pipelineCacheUUID )
+		{
+			return vendorID == properties.vendorID
+				&& deviceID == properties.deviceID
+				&& std::equal( pipelineCacheUUID
+					, pipelineCacheUUID + VK_UUID_SIZE
+					, properties.pipelineCacheUUID );
+		}
+
+		castor::ByteArray loadPipelineCacheData( castor::Path const & path
+			, VkPhysicalDeviceProperties const & properties )
+		{
+			castor::ByteArray content;
+
+			if ( !castor::File::fileExists( path ) )
+			{
+				return content;
+			}
+
+			try
+			{
+				castor::BinaryFile file{ path, castor::File::OpenMode::eRead };
+				auto length = size_t( file.getLength() );
+
+				if ( length >= sizeof( PipelineCacheFileHeader )
+					&& length <= sizeof( PipelineCacheFileHeader ) + MaxPipelineCacheSize )
+				{
+					content.resize( length );
+
+					if ( file.readArray( content.data(), content.size() ) != content.size() )
+					{
+						content.clear();
+					}
+				}
+			}
+			catch ( std::exception & exc )
+			{
+				log::warn << "RenderDevice: Couldn't read pipeline cache [" << path << "]: " << exc.what() << std::endl;
+				return {};
+			}
+
+			PipelineCacheFileHeader header{};
+			bool result = !content.empty();
+
+			if ( result )
+			{
+				std::memcpy( &header, content.data(), sizeof( PipelineCacheFileHeader ) );
+				result = header.magic == PipelineCacheMagic
+					&& header.revision == PipelineCacheRevision
+					&& header.driverVersion == properties.driverVersion
+					&& isCompatible( properties, header.vendorID, header.deviceID, header.pipelineCacheUUID )
+					&& header.dataSize == content.size() - sizeof( PipelineCacheFileHeader )
+					&& header.checksum == castor::hashBytes( content.data() + sizeof( PipelineCacheFileHeader )
+						, header.dataSize );
+			}
+
+			if ( result
+				&& header.dataSize >= sizeof( DriverPipelineCacheHeader ) )
+			{
+				// Drivers are supposed to check their own header, but some of them crash on foreign data.
+				DriverPipelineCacheHeader driverHeader{};
+				std::memcpy( &driverHeader, content.data() + sizeof( PipelineCacheFileHeader ), sizeof( DriverPipelineCacheHeader ) );
+				result = driverHeader.headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+					|| isCompatible( properties, driverHeader.vendorID, driverHeader.deviceID, driverHeader.pipelineCacheUUID );
+			}
+
+			if ( !result )
+			{
+				log::warn << "RenderDevice: Invalid or outdated pipeline cache [" << path << "], it will be regenerated." << std::endl;
+				return {};
+			}
+
+			content.erase( content.begin(), content.begin() + sizeof( PipelineCacheFileHeader ) );
+			return content;
+		}
+
+		VkPipelineCache createPipelineCache( ashes::Device const & device
+			, castor::ByteArray const & data )
+		{
+			VkPipelineCacheCreateInfo createInfo{ VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO
+				, nullptr
+				, 0u
+				, data.size()
+				, data.empty() ? nullptr : data.data() };
+			VkPipelineCache result{};
+			auto res = device.vkCreatePipelineCache( device
+				, &createInfo
+				, device.getAllocationCallbacks()
+				, &result );
+
+			if ( res != VK_SUCCESS
+				&& !data.empty() )
+			{
+				log::warn << "RenderDevice: Pipeline cache data was rejected, starting from an empty cache." << std::endl;
+				createInfo.initialDataSize = 0u;
+				createInfo.pInitialData = nullptr;
+				res = device.vkCreatePipelineCache( device
+					, &createInfo
+					, device.getAllocationCallbacks()
+					, &result );
+			}
+
+			if ( res != VK_SUCCESS )
+			{
+				log::warn << "RenderDevice: Couldn't create the pipeline cache, pipelines won't be cached." << std::endl;
+				result = VkPipelineCache{};
+			}
+
+			return result;
+		}
 	}
 
 	RenderDevice::RenderDevice( RenderSystem & renderSystem
@@ -149,8 +309,11 @@ namespace castor3d
 
 		bufferPool = std::make_shared< GpuBufferPool >( renderSystem, *this, cuT( "GlobalBufferPool" ) );
 		uboPools = std::make_shared< UniformBufferPools >( renderSystem, *this );
+		pipelineCacheFile = getPipelineCacheFile( desc, properties );
+		pipelineCache = createPipelineCache( *device
+			, loadPipelineCacheData( pipelineCacheFile, properties ) );
 		m_context = std::make_unique< crg::GraphContext >( *device
-			, VkPipelineCache{}
+			, pipelineCache
 			, device->getAllocationCallbacks()
 			, device->getMemoryProperties()
 			, device->getProperties()
@@ -164,9 +327,73 @@ namespace castor3d
 		uboPools.reset();
 		bufferPool.reset();
 		queueFamilies.clear();
+
+		if ( pipelineCache != VkPipelineCache{} )
+		{
+			savePipelineCache();
+			device->vkDestroyPipelineCache( *device
+				, pipelineCache
+				, device->getAllocationCallbacks() );
+		}
+
 		device.reset();
 	}
 
+	void RenderDevice::savePipelineCache()const
+	{
+		size_t size{};
+
+		if ( pipelineCache == VkPipelineCache{}
+			|| device->vkGetPipelineCacheData( *device, pipelineCache, &size, nullptr ) != VK_SUCCESS
+			|| size == 0u )
+		{
+			return;
+		}
+
+		if ( size > MaxPipelineCacheSize )
+		{
+			log::warn << "RenderDevice: Pipeline cache is too big (" << size << " bytes), it won't be saved." << std::endl;
+			return;
+		}
+
+		castor::ByteArray content( sizeof( PipelineCacheFileHeader ) + size );
+
+		if ( device->vkGetPipelineCacheData( *device, pipelineCache, &size, content.data() + sizeof( PipelineCacheFileHeader ) ) != VK_SUCCESS )
+		{
+			return;
+		}
+
+		content.resize( sizeof( PipelineCacheFileHeader ) + size );
+		PipelineCacheFileHeader header{ PipelineCacheMagic
+			, PipelineCacheRevision
+			, properties.vendorID
+			, properties.deviceID
+			, properties.driverVersion
+			, uint32_t( size )
+			, {}
+			, castor::hashBytes( content.data() + sizeof( PipelineCacheFileHeader ), size ) };
+		std::copy( properties.pipelineCacheUUID
+			, properties.pipelineCacheUUID + VK_UUID_SIZE
+			, header.pipelineCacheUUID );
+		std::memcpy( content.data(), &header, sizeof( PipelineCacheFileHeader ) );
+		auto folder = pipelineCacheFile.getPath();
+
+		try
+		{
+			if ( !castor::File::directoryExists( folder ) )
+			{
+				castor::File::directoryCreate( folder );
+			}
+
+			castor::BinaryFile file{ pipelineCacheFile, castor::File::OpenMode::eWrite };
+			file.writeArray( content.data(), content.size() );
+		}
+		catch ( std::exception & exc )
+		{
+			log::warn << "RenderDevice: Couldn't write pipeline cache [" << pipelineCacheFile << "]: " << exc.what() << std::endl;
+		}
+	}
+
 	VkFormat RenderDevice::selectSuitableDepthFormat( VkFormatFeatureFlags requiredFeatures )const
 	{
 		std::vector< VkFormat > depthFormats
@@ -13,6 +13,7 @@
 #include "Castor3D/Cache/WindowCache.hpp"
 #include "Castor3D/Event/Frame/FrameListener.hpp"
 #include "Castor3D/Overlay/DebugOverlays.hpp"
+#include "Castor3D/Render/RenderPass.hpp"
 #include "Castor3D/Render/RenderQueue.hpp"
 #include "Castor3D/Render/RenderSystem.hpp"
 #include "Castor3D/Render/RenderTarget.hpp"
@@ -21,6 +22,7 @@
 #include "Castor3D/Scene/Scene.hpp"
 
 #include <CastorUtils/Design/BlockGuard.hpp>
+#include <CastorUtils/Multithreading/ParallelFor.hpp>
 
 CU_ImplementCUSmartPtr( castor3d, RenderLoop )
 
@@ -37,11 +39,7 @@ namespace castor3d
 		, m_renderSystem{ *engine.getRenderSystem() }
 		, m_debugOverlays{ std::make_unique< DebugOverlays >( engine ) }
 		, m_queueUpdater{ std::max( 2u, engine.getCpuInformations().getCoreCount() - ( isAsync ? 2u : 1u ) ) }
-		, m_uploadResources
-		{
-			UploadResources{ { nullptr, nullptr }, nullptr },
-			UploadResources{ { nullptr, nullptr }, nullptr },
-		}
+		, m_uploadResources( engine.getMaxFramesInFlight() )
 	{
 		m_debugOverlays->initialise( getEngine()->getOverlayCache() );
 	}
@@ -66,6 +64,10 @@ namespace castor3d
 					m_renderSystem.setCurrentRenderDevice( nullptr );
 				} );
 			auto & device = m_renderSystem.getCurrentRenderDevice();
+
+			// The GPU resources must not be destroyed while a frame still uses them.
+			doWaitFramesInFlight();
+
 			getEngine()->getFrameListenerCache().forEach( [&device]( FrameListener & listener )
 				{
 					listener.fireEvents( EventType::ePreRender, device );
@@ -76,11 +78,12 @@ namespace castor3d
 					listener.fireEvents( EventType::eQueueRender, device );
 					listener.fireEvents( EventType::eQueueRender );
 				} );
-			m_uploadResources =
+			for ( auto & resources : m_uploadResources )
 			{
-				UploadResources{ { nullptr, nullptr }, nullptr },
-				UploadResources{ { nullptr, nullptr }, nullptr },
-			};
+				resources = UploadResources{};
+			}
+
+			m_currentUpdate = 0u;
 		}
 		else
 		{
@@ -190,19 +193,13 @@ namespace castor3d
 					m_renderSystem.setCurrentRenderDevice( nullptr );
 				} );
 			auto & device = m_renderSystem.getCurrentRenderDevice();
+			doUpdateFramesInFlight( device );
 
-			if ( !m_uploadResources[0].fence )
-			{
-				for ( auto & resources : m_uploadResources )
-				{
-					resources.commands =
-					{
-						device.graphicsCommandPool->createCommandBuffer( "RenderLoopUboUpload" ),
-						device->createSemaphore( "RenderLoopUboUpload" ),
-					};
-					resources.fence = device->createFence();
-				}
-			}
+			// The previous frame may still be in flight, and the GPU update and events modify
+			// resources it uses (buffers updated in place, command buffers, ...).
+			// With one frame in flight, this fence has already been waited for.
+			auto frameCount = uint32_t( m_uploadResources.size() );
+			doWaitFrame( m_uploadResources[( m_currentUpdate + frameCount - 1u ) % frameCount] );
 
 			// Usually GPU initialisation
 			doProcessEvents( EventType::ePreRender, device );
@@ -214,15 +211,14 @@ namespace castor3d
 
 			auto & uploadResources = m_uploadResources[m_currentUpdate];
 			uploadResources.commands.commandBuffer->begin( VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT );
-			device.uboPools->upload( *uploadResources.commands.commandBuffer );
+			device.uboPools->upload( *uploadResources.commands.commandBuffer, info );
 			uploadResources.commands.commandBuffer->end();
+			// No wait here, the render submitted after it on the same queue is ordered by the upload barriers.
 			device.graphicsQueue->submit( { *uploadResources.commands.commandBuffer }
 				, {}
 				, {}
 				, {}
-				, uploadResources.fence.get() );
-			uploadResources.fence->wait( ashes::MaxTimeout );
-			uploadResources.fence->reset();
+				, nullptr );
 
 			// Render
 			getEngine()->getRenderTargetCache().render( device, info );
@@ -249,10 +245,71 @@ namespace castor3d
 				{
 					m_renderSystem.setCurrentRenderDevice( nullptr );
 				} );
+			auto & device = m_renderSystem.getCurrentRenderDevice();
+			// Signalled once everything submitted for this frame has been processed.
+			auto & frameResources = m_uploadResources[m_currentUpdate];
+			frameResources.fence->reset();
+			device.graphicsQueue->submit( ashes::VkCommandBufferArray{}
+				, ashes::VkSemaphoreArray{}
+				, {}
+				, ashes::VkSemaphoreArray{}
+				, *frameResources.fence );
+			frameResources.frame = ++m_submittedFrames;
+
+			if ( m_uploadResources.size() == 1u )
+			{
+				doWaitFrame( frameResources );
+			}
+
+			m_currentUpdate = ( m_currentUpdate + 1u ) % uint32_t( m_uploadResources.size() );
 			m_debugOverlays->endGpuTask();
 		}
 	}
 
+	void RenderLoop::doUpdateFramesInFlight( RenderDevice const & device )
+	{
+		auto count = getEngine()->getMaxFramesInFlight();
+
+		if ( count != m_uploadResources.size() )
+		{
+			// Changed since the previous frame, the current slots are replaced once their frames are done.
+			doWaitFramesInFlight();
+			m_uploadResources.clear();
+			m_uploadResources.resize( count );
+			m_currentUpdate = 0u;
+		}
+
+		if ( !m_uploadResources[0].fence )
+		{
+			for ( auto & resources : m_uploadResources )
+			{
+				resources.commands =
+				{
+					device.graphicsCommandPool->createCommandBuffer( "RenderLoopUboUpload" ),
+					device->createSemaphore( "RenderLoopUboUpload" ),
+				};
+				resources.fence = device->createFence( "RenderLoopFrame", VK_FENCE_CREATE_SIGNALED_BIT );
+			}
+		}
+	}
+
+	void RenderLoop::doWaitFrame( UploadResources & resources )
+	{
+		if ( resources.fence )
+		{
+			resources.fence->wait( ashes::MaxTimeout );
+			m_completedFrames = std::max( m_completedFrames, resources.frame );
+		}
+	}
+
+	void RenderLoop::doWaitFramesInFlight()
+	{
+		for ( auto & resources : m_uploadResources )
+		{
+			doWaitFrame( resources );
+		}
+	}
+
 	void RenderLoop::doCpuStep( castor::Milliseconds tslf )
 	{
 		doProcessEvents( EventType::ePostRender );
@@ -260,14 +317,52 @@ namespace castor3d
 		updater.tslf = tslf;
 		getEngine()->update( updater );
 
+		// Gather the queues, each one once, always in the same order.
+		using QueueShadowMaps = std::pair< RenderQueue *, ShadowMapLightTypeArray const * >;
+		std::vector< QueueShadowMaps > queues;
+
 		for ( auto & techniqueQueues : updater.techniquesQueues )
 		{
 			for ( auto & queue : techniqueQueues.queues )
 			{
-				queue.get().update( techniqueQueues.shadowMaps );
+				auto it = std::find_if( queues.begin()
+					, queues.end()
+					, [&queue]( QueueShadowMaps const & lookup )
+					{
+						return lookup.first == &queue.get();
+					} );
+
+				if ( it == queues.end() )
+				{
+					queues.emplace_back( &queue.get(), &techniqueQueues.shadowMaps );
+				}
 			}
 		}
 
+		// The parsing is the costly part, what it shares between queues (passes, submeshes, nodes) is locked.
+		std::vector< castor::Nanoseconds > parseTimes( queues.size() );
+		castor::parallelFor( m_queueUpdater
+			, size_t{ 0u }
+			, queues.size()
+			, [&queues, &parseTimes]( size_t index )
+			{
+				castor::PreciseTimer timer;
+				auto & queue = queues[index];
+				queue.first->parse( *queue.second );
+				parseTimes[index] = timer.getElapsed();
+			} );
+
+		// parallelFor is the barrier: all queues are parsed before their events are sent,
+		// serially and in queues order, so the GPU step sees the same events as before.
+		for ( size_t index = 0u; index < queues.size(); ++index )
+		{
+			auto & queue = queues[index];
+			queue.first->sendEvents();
+			m_debugOverlays->addCpuTime( cuT( "RenderQueues" )
+				, queue.first->getOwner()->getName()
+				, parseTimes[index] );
+		}
+
 		m_debugOverlays->endCpuTask();
 	}
 }
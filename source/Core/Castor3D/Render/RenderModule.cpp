@@ -8,6 +8,7 @@
 #include "Castor3D/Scene/Scene.hpp"
 
 #include <CastorUtils/Miscellaneous/BitSize.hpp>
+#include <CastorUtils/Miscellaneous/Hash.hpp>
 
 #include <ashespp/Image/Image.hpp>
 
@@ -229,6 +230,30 @@ namespace castor3d
 			&& lhs.texturesFlags == rhs.texturesFlags;
 	}
 
+	size_t hash( PipelineFlags const & flags )
+	{
+		size_t result{};
+		castor::hashCombine( result, uint32_t( flags.colourBlendMode ) );
+		castor::hashCombine( result, uint32_t( flags.alphaBlendMode ) );
+		castor::hashCombine( result, uint32_t( flags.passFlags ) );
+		castor::hashCombine( result, uint32_t( flags.passType ) );
+		castor::hashCombine( result, flags.heightMapIndex );
+		castor::hashCombine( result, uint32_t( flags.programFlags ) );
+		castor::hashCombine( result, uint32_t( flags.sceneFlags ) );
+		castor::hashCombine( result, uint32_t( flags.topology ) );
+		castor::hashCombine( result, uint32_t( flags.alphaFunc ) );
+		castor::hashCombine( result, uint32_t( flags.blendAlphaFunc ) );
+
+		for ( auto & flagId : flags.textures )
+		{
+			castor::hashCombine( result, flagId.id );
+			castor::hashCombine( result, uint32_t( flagId.flags ) );
+		}
+
+		castor::hashCombine( result, uint32_t( flags.texturesFlags ) );
+		return result;
+	}
+
 	//*********************************************************************************************
 
 	Texture::Texture()
@@ -39,6 +39,8 @@
 #include "Castor3D/Shader/Ubos/SceneUbo.hpp"
 #include "Castor3D/Shader/Ubos/SkinningUbo.hpp"
 
+#include <CastorUtils/Miscellaneous/Hash.hpp>
+
 #include <ashespp/Buffer/Buffer.hpp>
 #include <ashespp/Buffer/VertexBuffer.hpp>
 
@@ -175,11 +177,28 @@ namespace castor3d
 
 	SceneRenderPass::~SceneRenderPass()
 	{
+		// Waiting for the prewarm jobs here would be too late, the derived passes they use are already destroyed.
+		CU_Assert( m_prewarmJobs.empty(), "The prewarm jobs must be cleaned up by the most derived pass" );
 		m_renderQueue.cleanup();
 		m_backPipelines.clear();
 		m_frontPipelines.clear();
 	}
 
+	void SceneRenderPass::cleanupPrewarm()
+	{
+		for ( auto & job : m_prewarmJobs )
+		{
+			job.cancel();
+		}
+
+		for ( auto & job : m_prewarmJobs )
+		{
+			job.wait();
+		}
+
+		m_prewarmJobs.clear();
+	}
+
 	void SceneRenderPass::update( CpuUpdater & updater )
 	{
 		doUpdate( *updater.queues );
@@ -213,6 +232,19 @@ namespace castor3d
 		return doGetPixelShaderSource( flags );
 	}
 
+	size_t SceneRenderPass::getShaderInputsHash()const
+	{
+		size_t result{};
+		castor::hashCombine( result, uint32_t( m_mode ) );
+		castor::hashCombine( result, m_oit );
+		castor::hashCombine( result, m_instanceMult );
+		castor::hashCombine( result, uint32_t( getShaderFlags() ) );
+		castor::hashCombine( result, uint32_t( getTexturesMask() ) );
+		castor::hashCombine( result, m_renderSystem.getGpuInformations().hasShaderStorageBuffers() );
+		doHashShaderInputs( result );
+		return result;
+	}
+
 	RenderPipeline * SceneRenderPass::prepareBackPipeline( Pass const & pass
 		, TextureFlagsArray const & textures
 		, ProgramFlags const & programFlags
@@ -523,15 +555,18 @@ namespace castor3d
 	void SceneRenderPass::doSubInitialise()
 	{
 		m_renderQueue.initialise();
+		// The pass is fully constructed here, its programs can be generated from other threads.
+		cleanupPrewarm();
+		m_prewarmJobs = getEngine()->getShaderProgramCache().prewarmAutomaticPrograms( *this );
 	}
 
 	void SceneRenderPass::doSubRecordInto( VkCommandBuffer commandBuffer
 		, uint32_t index )
 	{
-		VkCommandBuffer secondary = getCommandBuffer();
+		auto & secondaries = m_renderQueue.getCommandBuffers();
 		m_context.vkCmdExecuteCommands( commandBuffer
-			, 1u
-			, &secondary );
+			, uint32_t( secondaries.size() )
+			, secondaries.data() );
 	}
 
 	uint32_t SceneRenderPass::doCopyNodesMatrices( SubmeshRenderNodePtrArray const & renderNodes
@@ -929,6 +964,10 @@ namespace castor3d
 		return &result;
 	}
 
+	void SceneRenderPass::doHashShaderInputs( size_t & hash )const
+	{
+	}
+
 	ShaderPtr SceneRenderPass::doGetVertexShaderSource( PipelineFlags const & flags )const
 	{
 		using namespace sdw;
@@ -10,7 +10,6 @@
 #include "Castor3D/Shader/Program.hpp"
 
 #include <ashespp/Descriptor/DescriptorSetLayout.hpp>
-#include <ashespp/Pipeline/GraphicsPipeline.hpp>
 #include <ashespp/Pipeline/GraphicsPipelineCreateInfo.hpp>
 #include <ashespp/Pipeline/PipelineInputAssemblyStateCreateInfo.hpp>
 #include <ashespp/Pipeline/PipelineLayout.hpp>
@@ -46,6 +45,7 @@ namespace castor3d
 
 	RenderPipeline::~RenderPipeline()
 	{
+		doDestroyPipeline();
 	}
 
 	void RenderPipeline::initialise( RenderDevice const & device
@@ -118,13 +118,29 @@ namespace castor3d
 			*m_pipelineLayout,
 			renderPass
 		);
-		m_pipeline = device->createPipeline( getOwner()->getName() + "RenderPipeline"
-			, std::move( createInfo ) );
+		// Created through the device's pipeline cache, to benefit from the pipelines compiled by previous runs.
+		VkGraphicsPipelineCreateInfo const & vkCreateInfo = createInfo;
+		VkPipeline pipeline{};
+		auto res = device->vkCreateGraphicsPipelines( *device
+			, device.pipelineCache
+			, 1u
+			, &vkCreateInfo
+			, device->getAllocationCallbacks()
+			, &pipeline );
+
+		if ( res != VK_SUCCESS )
+		{
+			CU_Exception( getOwner()->getName() + "RenderPipeline - Pipeline creation failed" );
+		}
+
+		doDestroyPipeline();
+		m_device = device.device.get();
+		m_pipeline = pipeline;
 	}
 
 	void RenderPipeline::cleanup( RenderDevice const & device )
 	{
-		m_pipeline.reset();
+		doDestroyPipeline();
 		m_pipelineLayout.reset();
 	}
 
@@ -181,4 +197,15 @@ namespace castor3d
 		CU_Require( it != m_billboardAddDescriptors.end() );
 		return *it->second;
 	}
+
+	void RenderPipeline::doDestroyPipeline()
+	{
+		if ( m_pipeline != VkPipeline{} )
+		{
+			m_device->vkDestroyPipeline( *m_device
+				, m_pipeline
+				, m_device->getAllocationCallbacks() );
+			m_pipeline = VkPipeline{};
+		}
+	}
 }
@@ -12,6 +12,7 @@
 #include "Castor3D/Render/RenderPass.hpp"
 #include "Castor3D/Render/Culling/SceneCuller.hpp"
 #include "Castor3D/Render/Node/QueueCulledRenderNodes.hpp"
+#include "Castor3D/Scene/Scene.hpp"
 
 #include <ashespp/Command/CommandBufferInheritanceInfo.hpp>
 
@@ -22,6 +23,43 @@ using ashes::operator!=;
 
 namespace castor3d
 {
+	namespace
+	{
+		bool areSameShadowMaps( ShadowMapLightTypeArray const & lhs
+			, ShadowMapLightTypeArray const & rhs )
+		{
+			return std::equal( lhs.begin()
+				, lhs.end()
+				, rhs.begin()
+				, []( ShadowMapRefArray const & lhs
+					, ShadowMapRefArray const & rhs )
+				{
+					return std::equal( lhs.begin()
+						, lhs.end()
+						, rhs.begin()
+						, rhs.end()
+						, []( ShadowMapRefIds const & lhs
+							, ShadowMapRefIds const & rhs )
+						{
+							return &lhs.first.get() == &rhs.first.get();
+						} );
+				} );
+		}
+
+		// Each command buffer records at least this many draw calls,
+		// so the small queues are recorded in a single command buffer, on the calling thread.
+		uint32_t constexpr MinDrawsPerCommandBuffer = 256u;
+
+		uint32_t getChunksCount( uint32_t drawCount
+			, castor::JobScheduler const & jobs )
+		{
+			// The calling thread records a chunk too.
+			auto maxChunks = uint32_t( jobs.getCount() + 1u );
+			return std::max( 1u
+				, std::min( maxChunks, drawCount / MinDrawsPerCommandBuffer ) );
+		}
+	}
+
 	RenderQueue::RenderQueue( SceneRenderPass & renderPass
 		, RenderMode mode
 		, SceneNode const * ignored )
@@ -50,71 +88,112 @@ namespace castor3d
 				, 0u
 				, 0u ) );
 		getCommandBuffer().end();
+		m_commandBuffers = { VkCommandBuffer( getCommandBuffer() ) };
 	}
 
 	void RenderQueue::cleanup()
 	{
 		m_culledRenderNodes.reset();
 		m_renderNodes.reset();
+		m_commandBuffers.clear();
+		m_chunks.clear();
 		m_commandBuffer.reset();
 	}
 
 	void RenderQueue::update( ShadowMapLightTypeArray & shadowMaps )
 	{
-		if ( m_allChanged )
+		parse( shadowMaps );
+		sendEvents();
+	}
+
+	void RenderQueue::update( ShadowMapLightTypeArray & shadowMaps
+		, VkViewport const & viewport
+		, VkRect2D const & scissor )
+	{
+		m_viewport = viewport;
+		m_scissor = scissor;
+		update( shadowMaps );
+	}
+
+	void RenderQueue::update( ShadowMapLightTypeArray & shadowMaps
+		, VkRect2D const & scissor )
+	{
+		m_scissor = scissor;
+		update( shadowMaps );
+	}
+
+	void RenderQueue::parse( ShadowMapLightTypeArray const & shadowMaps )
+	{
+		auto sceneFlags = m_culler.getScene().getFlags();
+		SceneCuller::CulledDeltaT< CulledSubmesh > submeshesDelta;
+		SceneCuller::CulledDeltaT< CulledBillboard > billboardsDelta;
+		bool allChanged{};
 		{
-			doParseAllRenderNodes( shadowMaps );
+			auto lock( castor::makeUniqueLock( m_cullerChangesMutex ) );
+			// The scene flags and the shadow maps are used by all the nodes pipelines and descriptors.
+			allChanged = m_allChanged
+				|| sceneFlags != m_sceneFlags
+				|| !areSameShadowMaps( shadowMaps, m_shadowMaps );
+			std::swap( submeshesDelta, m_submeshesDelta );
+			std::swap( billboardsDelta, m_billboardsDelta );
 			m_allChanged = false;
 		}
 
-		bool commandBuffersChanged = m_culledChanged;
+		if ( allChanged )
+		{
+			m_shadowMaps = shadowMaps;
+			m_sceneFlags = sceneFlags;
+			doParseAllRenderNodes( m_shadowMaps );
+			m_allParsed = true;
+			m_culledChanged = true;
+		}
+		else if ( !submeshesDelta.empty()
+			|| !billboardsDelta.empty() )
+		{
+			getAllRenderNodes().update( submeshesDelta, billboardsDelta );
+			m_allParsed = true;
+		}
 
 		if ( m_culledChanged )
 		{
 			doParseCulledRenderNodes();
 			m_culledChanged = false;
+			m_culledParsed = true;
+		}
+	}
+
+	void RenderQueue::sendEvents()
+	{
+		if ( m_allParsed )
+		{
+			getAllRenderNodes().initialiseNodes( m_shadowMaps );
+			m_allParsed = false;
 		}
 
-		if ( commandBuffersChanged )
+		if ( m_culledParsed )
 		{
+			m_culledParsed = false;
 			// Force regeneration of CommandBuffers if running.
 			m_preparation = ( m_preparation == Preparation::eWaiting )
 				? Preparation::eWaiting
 				: Preparation::eDone;
-		}
 
-		if ( commandBuffersChanged
-			&& m_preparation == Preparation::eDone )
-		{
-			m_preparation = Preparation::eWaiting;
-			getOwner()->getEngine()->sendEvent( makeGpuFunctorEvent( EventType::ePreRender
-				, [this]( RenderDevice const & device )
-				{
-					m_preparation = Preparation::eRunning;
-					doPrepareCommandBuffer();
-					m_preparation = ( m_preparation == Preparation::eWaiting )
-						? Preparation::eWaiting
-						: Preparation::eDone;
-				} ) );
+			if ( m_preparation == Preparation::eDone )
+			{
+				m_preparation = Preparation::eWaiting;
+				getOwner()->getEngine()->sendEvent( makeGpuFunctorEvent( EventType::ePreRender
+					, [this]( RenderDevice const & device )
+					{
+						m_preparation = Preparation::eRunning;
+						doPrepareCommandBuffer();
+						m_preparation = ( m_preparation == Preparation::eWaiting )
+							? Preparation::eWaiting
+							: Preparation::eDone;
+					} ) );
+			}
 		}
 	}
 
-	void RenderQueue::update( ShadowMapLightTypeArray & shadowMaps
-		, VkViewport const & viewport
-		, VkRect2D const & scissor )
-	{
-		m_viewport = viewport;
-		m_scissor = scissor;
-		update( shadowMaps );
-	}
-
-	void RenderQueue::update( ShadowMapLightTypeArray & shadowMaps
-		, VkRect2D const & scissor )
-	{
-		m_scissor = scissor;
-		update( shadowMaps );
-	}
-
 	void RenderQueue::setIgnoredNode( SceneNode const & node )
 	{
 		m_allChanged = m_allChanged || ( m_ignoredNode != &node );
@@ -136,15 +215,52 @@ namespace castor3d
 	void RenderQueue::doPrepareCommandBuffer()
 	{
 		getOwner()->resetCommandBuffer();
-		m_commandBuffer->reset();
 		auto & culledNodes = getCulledRenderNodes();
+		auto drawCount = culledNodes.prepareDraws();
+		auto commandBuffers = doGetChunksCommandBuffers( getChunksCount( drawCount
+			, getOwner()->getEngine()->getCpuJobs() ) );
 		culledNodes.prepareCommandBuffers( *this
 			, m_viewport.value()
-			, m_scissor.value() );
+			, m_scissor.value()
+			, commandBuffers );
+		m_commandBuffers.clear();
+
+		for ( auto commandBuffer : commandBuffers )
+		{
+			m_commandBuffers.push_back( *commandBuffer );
+		}
+
 		getOwner()->record();
 	}
 
-	void RenderQueue::doParseAllRenderNodes( ShadowMapLightTypeArray & shadowMaps )
+	std::vector< ashes::CommandBuffer const * > RenderQueue::doGetChunksCommandBuffers( uint32_t count )
+	{
+		auto & device = *getOwner()->getEngine()->getRenderSystem()->getMainRenderDevice();
+		std::vector< ashes::CommandBuffer const * > result;
+		m_commandBuffer->reset();
+		result.push_back( m_commandBuffer.get() );
+
+		while ( m_chunks.size() + 1u < count )
+		{
+			CommandChunk chunk;
+			chunk.pool = device->createCommandPool( device.getGraphicsQueueFamilyIndex()
+				, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT );
+			chunk.commandBuffer = chunk.pool->createCommandBuffer( getOwner()->getName() + castor::string::toString( m_chunks.size() + 1u )
+				, VK_COMMAND_BUFFER_LEVEL_SECONDARY );
+			m_chunks.push_back( std::move( chunk ) );
+		}
+
+		for ( uint32_t i = 1u; i < count; ++i )
+		{
+			auto & commandBuffer = *m_chunks[i - 1u].commandBuffer;
+			commandBuffer.reset();
+			result.push_back( &commandBuffer );
+		}
+
+		return result;
+	}
+
+	void RenderQueue::doParseAllRenderNodes( ShadowMapLightTypeArray const & shadowMaps )
 	{
 		auto & allNodes = getAllRenderNodes();
 		allNodes.parse( shadowMaps );
@@ -158,7 +274,21 @@ namespace castor3d
 
 	void RenderQueue::doOnCullerCompute( SceneCuller const & culler )
 	{
-		m_allChanged = m_allChanged || culler.areAllChanged();
+		auto lock( castor::makeUniqueLock( m_cullerChangesMutex ) );
+
+		if ( culler.areAllChanged() )
+		{
+			// The full parse will read the culler's current lists.
+			m_allChanged = true;
+			m_submeshesDelta.clear();
+			m_billboardsDelta.clear();
+		}
+		else if ( !m_allChanged )
+		{
+			m_submeshesDelta.merge( culler.getSubmeshesDelta( getMode() ) );
+			m_billboardsDelta.merge( culler.getBillboardsDelta( getMode() ) );
+		}
+
 		m_culledChanged = m_allChanged || culler.areCulledChanged();
 	}
 }
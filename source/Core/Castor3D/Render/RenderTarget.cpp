@@ -16,6 +16,7 @@
 #include "Castor3D/Render/RenderPassTimer.hpp"
 #include "Castor3D/Render/RenderSystem.hpp"
 #include "Castor3D/Render/Culling/FrustumCuller.hpp"
+#include "Castor3D/Render/Culling/OcclusionCuller.hpp"
 #include "Castor3D/Render/PostEffect/PostEffect.hpp"
 #include "Castor3D/Render/Technique/RenderTechnique.hpp"
 #include "Castor3D/Render/Technique/RenderTechniqueVisitor.hpp"
@@ -320,7 +321,7 @@ namespace castor3d
 
 			m_hdrConfigUbo = std::make_unique< HdrConfigUbo >( device );
 
-			m_culler = std::make_unique< FrustumCuller >( *getScene(), *getCamera() );
+			doCreateCuller();
 			doInitCombineProgram();
 			m_initialised = doInitialiseTechnique( device );
 
@@ -524,6 +525,12 @@ namespace castor3d
 				{
 					getEngine()->getRenderSystem()->pushScene( scene.get() );
 					scene->getGeometryCache().fillInfo( info );
+
+					if ( m_culler )
+					{
+						m_culler->fillInfo( info );
+					}
+
 					doRender( device, info, getCamera() );
 					getEngine()->getRenderSystem()->popScene();
 				}
@@ -552,7 +559,7 @@ namespace castor3d
 		{
 			m_camera = camera;
 			camera->resize( m_size );
-			m_culler = std::make_unique< FrustumCuller >( *getScene(), *getCamera() );
+			doCreateCuller();
 		}
 	}
 
@@ -818,6 +825,18 @@ namespace castor3d
 		m_combineStages.push_back( makeShaderState( *renderSystem.getMainRenderDevice(), m_combinePxl ) );
 	}
 
+	void RenderTarget::doCreateCuller()
+	{
+		if ( m_occlusionCulling )
+		{
+			m_culler = std::make_unique< OcclusionCuller >( *getScene(), *getCamera() );
+		}
+		else
+		{
+			m_culler = std::make_unique< FrustumCuller >( *getScene(), *getCamera() );
+		}
+	}
+
 	void RenderTarget::doRender( RenderDevice const & device
 		, RenderInfo & info
 		, CameraSPtr camera )
@@ -444,6 +444,9 @@ namespace castor3d
 					, *target->getCamera() );
 #endif
 
+				// Latched for the whole frame, the save can be requested from any thread at any time.
+				m_saving = m_toSave;
+
 				if ( waitOnly )
 				{
 					doWaitFrame();
@@ -834,7 +837,7 @@ namespace castor3d
 		{
 			m_renderingResources.emplace_back( std::make_unique< RenderingResources >( getDevice()->createSemaphore( getName() + castor::string::toString( i ) + "ImageAvailable" )
 				, getDevice()->createSemaphore( getName() + castor::string::toString( i ) + "FinishedRendering" )
-				, getDevice()->createFence( getName() + castor::string::toString( i ), VkFenceCreateFlags{ 0u } )
+				, getDevice()->createFence( getName() + castor::string::toString( i ), VK_FENCE_CREATE_SIGNALED_BIT )
 				, getDevice().graphicsCommandPool->createCommandBuffer( getName() + castor::string::toString( i ) )
 				, 0u ) );
 		}
@@ -1135,9 +1138,18 @@ namespace castor3d
 		doCreateCommandBuffers();
 	}
 
+	bool RenderWindow::doIsPipelined()const
+	{
+		// Saving the frame needs it to be finished before reading back the save buffer.
+		return getEngine()->getMaxFramesInFlight() > 1u
+			&& !m_saving;
+	}
+
 	RenderWindow::RenderingResources * RenderWindow::doGetResources()
 	{
 		auto & resources = *m_renderingResources[m_resourceIndex];
+		// With frames in flight, the wait for the frame that last used these resources happens here.
+		resources.fence->wait( ashes::MaxTimeout );
 		uint32_t imageIndex{ 0u };
 		auto res = m_swapChain->acquireNextImage( ashes::MaxTimeout
 			, *resources.imageAvailableSemaphore
@@ -1165,7 +1177,7 @@ namespace castor3d
 
 			if ( toWait.semaphore )
 			{
-				if ( m_toSave )
+				if ( m_saving )
 				{
 					getDevice().graphicsQueue->submit( ashes::VkCommandBufferArray{ *m_transferCommands.commandBuffer }
 						, ashes::VkSemaphoreArray{ toWait.semaphore }
@@ -1194,7 +1206,7 @@ namespace castor3d
 
 			if ( toWait.semaphore )
 			{
-				if ( m_toSave )
+				if ( m_saving )
 				{
 					getDevice().graphicsQueue->submit( ashes::VkCommandBufferArray{ *m_transferCommands.commandBuffer }
 						, ashes::VkSemaphoreArray{ toWait.semaphore }
@@ -1205,10 +1217,13 @@ namespace castor3d
 				}
 
 				toWait = m_texture3Dto2D->render( toWait );
+				resources->fence->reset();
 				getDevice().graphicsQueue->submit( ashes::VkCommandBufferArray{ *m_commandBuffers[m_debugConfig.debugIndex][resources->imageIndex] }
 					, ashes::VkSemaphoreArray{ *resources->imageAvailableSemaphore, toWait.semaphore }
 					, { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, toWait.dstStageMask }
-					, ashes::VkSemaphoreArray{}
+					, ( doIsPipelined()
+						? ashes::VkSemaphoreArray{ *resources->finishedRenderingSemaphore }
+						: ashes::VkSemaphoreArray{} )
 				, *resources->fence );
 				target->resetSemaphore();
 			}
@@ -1219,12 +1234,20 @@ namespace castor3d
 	{
 		try
 		{
-			resources->fence->wait( ashes::MaxTimeout );
-			resources->fence->reset();
-			getDevice().graphicsQueue->present( *m_swapChain
-				, resources->imageIndex );
+			if ( doIsPipelined() )
+			{
+				getDevice().graphicsQueue->present( *m_swapChain
+					, resources->imageIndex
+					, *resources->finishedRenderingSemaphore );
+			}
+			else
+			{
+				resources->fence->wait( ashes::MaxTimeout );
+				getDevice().graphicsQueue->present( *m_swapChain
+					, resources->imageIndex );
+			}
 
-			if ( m_toSave )
+			if ( m_saving )
 			{
 				std::memcpy( m_saveBuffer->getPtr(), m_stagingData.data(), m_stagingData.size() );
 				m_toSave = false;
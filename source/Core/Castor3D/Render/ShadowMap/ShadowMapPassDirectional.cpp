@@ -112,6 +112,7 @@ namespace castor3d
 
 	ShadowMapPassDirectional::~ShadowMapPassDirectional()
 	{
+		cleanupPrewarm();
 		getCuller().getCamera().detach();
 	}
 
@@ -75,6 +75,7 @@ namespace castor3d
 
 	ShadowMapPassPoint::~ShadowMapPassPoint()
 	{
+		cleanupPrewarm();
 		m_onNodeChanged.disconnect();
 	}
 
@@ -68,6 +68,7 @@ namespace castor3d
 
 	ShadowMapPassSpot::~ShadowMapPassSpot()
 	{
+		cleanupPrewarm();
 		getCuller().getCamera().detach();
 	}
 
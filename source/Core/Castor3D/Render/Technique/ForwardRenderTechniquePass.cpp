@@ -64,6 +64,11 @@ namespace castor3d
 	{
 	}
 
+	ForwardRenderTechniquePass::~ForwardRenderTechniquePass()
+	{
+		cleanupPrewarm();
+	}
+
 	void ForwardRenderTechniquePass::accept( RenderTechniqueVisitor & visitor )
 	{
 		auto flags = visitor.getFlags();
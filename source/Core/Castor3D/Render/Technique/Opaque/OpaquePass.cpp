@@ -65,6 +65,7 @@ namespace castor3d
 
 	OpaquePass::~OpaquePass()
 	{
+		cleanupPrewarm();
 	}
 
 	void OpaquePass::accept( RenderTechniqueVisitor & visitor )
@@ -35,6 +35,7 @@
 #include "Castor3D/Shader/Ubos/VoxelizerUbo.hpp"
 
 #include <CastorUtils/Design/ArrayView.hpp>
+#include <CastorUtils/Miscellaneous/Hash.hpp>
 
 #include <ashespp/Descriptor/DescriptorSet.hpp>
 #include <ashespp/Image/ImageView.hpp>
@@ -178,6 +179,7 @@ namespace castor3d
 			SceneRenderPass::doUpdate( nodes.instancedSkinnedNodes.backCulled, info );
 			SceneRenderPass::doUpdate( nodes.morphingNodes.backCulled, info );
 			SceneRenderPass::doUpdate( nodes.billboardNodes.backCulled, info );
+			nodes.fillInfo( info );
 		}
 	}
 
@@ -217,6 +219,13 @@ namespace castor3d
 		return nullptr;
 	}
 
+	void RenderTechniquePass::doHashShaderInputs( size_t & hash )const
+	{
+		castor::hashCombine( hash, m_environment );
+		castor::hashCombine( hash, m_hasVelocity );
+		castor::hashCombine( hash, m_ssao != nullptr );
+	}
+
 	void RenderTechniquePass::doUpdatePipeline( RenderPipeline & pipeline )
 	{
 		m_sceneUbo.cpuUpdate( m_scene, m_camera );
@@ -66,6 +66,7 @@ namespace castor3d
 
 	TransparentPass::~TransparentPass()
 	{
+		cleanupPrewarm();
 	}
 
 	TextureFlags TransparentPass::getTexturesMask()const
@@ -32,38 +32,21 @@ namespace castor3d
 		{
 			animation.get().update( elapsed );
 		}
+
+		doUpdatePose();
 	}
 
 	void AnimatedSkeleton::fillShader( castor::Matrix4x4f * variable )const
 	{
 		Skeleton & skeleton = m_skeleton;
-		uint32_t i{ 0u };
 
 		if ( m_playingAnimations.empty() )
 		{
-			for ( auto bone : skeleton )
-			{
-				variable[i++] = skeleton.getGlobalInverseTransform();
-			}
+			std::fill_n( variable, skeleton.getBonesCount(), skeleton.getGlobalInverseTransform() );
 		}
 		else
 		{
-			for ( auto bone : skeleton )
-			{
-				castor::Matrix4x4f final{ 1.0 };
-
-				for ( auto & animation : m_playingAnimations )
-				{
-					auto object = animation.get().getObject( *bone );
-
-					if ( object )
-					{
-						final *= object->getFinalTransform();
-					}
-				}
-
-				variable[i++] = final;
-			}
+			std::copy( m_pose.begin(), m_pose.end(), variable );
 		}
 	}
 
@@ -74,7 +57,7 @@ namespace castor3d
 
 		if ( m_playingAnimations.empty() )
 		{
-			for ( auto bone : skeleton )
+			for ( size_t i = 0u; i < skeleton.getBonesCount(); ++i )
 			{
 				std::memcpy( buffer, skeleton.getGlobalInverseTransform().constPtr(), stride );
 				buffer += stride;
@@ -82,21 +65,9 @@ namespace castor3d
 		}
 		else
 		{
-			for ( auto bone : skeleton )
+			for ( auto & transform : m_pose )
 			{
-				castor::Matrix4x4f final{ 1.0f };
-
-				for ( auto & animation : m_playingAnimations )
-				{
-					auto object = animation.get().getObject( *bone );
-
-					if ( object )
-					{
-						final *= object->getFinalTransform();
-					}
-				}
-
-				std::memcpy( buffer, final.constPtr (), stride );
+				std::memcpy( buffer, transform.constPtr(), stride );
 				buffer += stride;
 			}
 		}
@@ -117,6 +88,7 @@ namespace castor3d
 	void AnimatedSkeleton::doStartAnimation( AnimationInstance & animation )
 	{
 		m_playingAnimations.emplace_back( static_cast< SkeletonAnimationInstance & >( animation ) );
+		doUpdatePose();
 	}
 
 	void AnimatedSkeleton::doStopAnimation( AnimationInstance & animation )
@@ -127,10 +99,35 @@ namespace castor3d
 			{
 				return &instance.get() == &static_cast< SkeletonAnimationInstance & >( animation );
 			} ) );
+		doUpdatePose();
 	}
 
 	void AnimatedSkeleton::doClearAnimations()
 	{
 		m_playingAnimations.clear();
+		m_pose.clear();
+	}
+
+	void AnimatedSkeleton::doUpdatePose()
+	{
+		if ( m_playingAnimations.empty() )
+		{
+			m_pose.clear();
+			return;
+		}
+
+		Skeleton & skeleton = m_skeleton;
+		m_pose.assign( skeleton.getBonesCount(), castor::Matrix4x4f{ 1.0f } );
+
+		for ( auto & animation : m_playingAnimations )
+		{
+			for ( size_t i = 0u; i < m_pose.size(); ++i )
+			{
+				if ( auto object = animation.get().getBoneObject( i ) )
+				{
+					m_pose[i] *= object->getFinalTransform();
+				}
+			}
+		}
 	}
 }
@@ -6,6 +6,7 @@
 #include "Castor3D/Model/Skeleton/Animation/SkeletonAnimationKeyFrame.hpp"
 #include "Castor3D/Model/Skeleton/Animation/SkeletonAnimationNode.hpp"
 #include "Castor3D/Model/Skeleton/Bone.hpp"
+#include "Castor3D/Model/Skeleton/Skeleton.hpp"
 #include "Castor3D/Scene/Animation/AnimatedSkeleton.hpp"
 #include "Castor3D/Scene/Animation/Skeleton/SkeletonAnimationInstanceBone.hpp"
 #include "Castor3D/Scene/Animation/Skeleton/SkeletonAnimationInstanceNode.hpp"
@@ -16,22 +17,6 @@ namespace castor3d
 {
 	//*************************************************************************************************
 
-	namespace
-	{
-		castor::String const & getObjectTypeName( SkeletonAnimationObjectType type )
-		{
-			static std::map< SkeletonAnimationObjectType, String > Names
-			{
-				{ SkeletonAnimationObjectType::eNode, cuT( "Node_" ) },
-				{ SkeletonAnimationObjectType::eBone, cuT( "Bone_" ) },
-			};
-
-			return Names[type];
-		}
-	}
-
-	//*************************************************************************************************
-
 	SkeletonAnimationInstance::SkeletonAnimationInstance( AnimatedSkeleton & object
 		, SkeletonAnimation & animation )
 		: AnimationInstance{ object, animation }
@@ -63,6 +48,28 @@ namespace castor3d
 			}
 		}
 
+		// Resolve once the animated object of each skeleton bone, instead of looking it up by name each frame.
+		std::map< castor::String, SkeletonAnimationInstanceObject const * > bones;
+
+		for ( auto & moving : m_toMove )
+		{
+			if ( moving->getObject().getType() == SkeletonAnimationObjectType::eBone )
+			{
+				bones.emplace( moving->getObject().getName(), moving.get() );
+			}
+		}
+
+		auto & skeleton = object.getSkeleton();
+		m_bones.reserve( skeleton.getBonesCount() );
+
+		for ( auto & bone : skeleton )
+		{
+			auto it = bones.find( bone->getName() );
+			m_bones.push_back( it == bones.end()
+				? nullptr
+				: it->second );
+		}
+
 		for ( auto & keyFrame : animation )
 		{
 			m_keyFrames.emplace_back( *this
@@ -93,12 +100,12 @@ namespace castor3d
 		, castor::String const & name )const
 	{
 		SkeletonAnimationInstanceObjectSPtr result;
-		auto fullName = getObjectTypeName( type ) + name;
 		auto it = std::find_if( m_toMove.begin()
 			, m_toMove.end()
-			, [&fullName]( SkeletonAnimationInstanceObjectSPtr lookup )
+			, [type, &name]( SkeletonAnimationInstanceObjectSPtr const & lookup )
 			{
-				return getObjectTypeName( lookup->getObject().getType() ) + lookup->getObject().getName() == fullName;
+				return lookup->getObject().getType() == type
+					&& lookup->getObject().getName() == name;
 			} );
 
 		if ( it != m_toMove.end() )
@@ -117,23 +124,35 @@ namespace castor3d
 	{
 		if ( !m_keyFrames.empty() )
 		{
-			auto limit = m_keyFrames.begin();
+			// m_curr is the cached cursor, the last keyframe at or before current time.
+			auto first = m_keyFrames.begin();
 
-			while ( m_curr != limit && m_curr->getTimeIndex() >= m_currentTime )
+			while ( m_curr != first && m_curr->getTimeIndex() > m_currentTime )
 			{
-				// Time has gone too fast backward.
+				// Time has gone backward.
 				--m_curr;
 			}
 
-			limit = ( m_keyFrames.end() - 1 );
+			auto last = ( m_keyFrames.end() - 1 );
 
-			while ( m_curr != limit && m_curr->getTimeIndex() < m_currentTime )
+			while ( m_curr != last && ( m_curr + 1 )->getTimeIndex() <= m_currentTime )
 			{
-				// Time has gone too fast forward.
+				// Time has gone forward.
 				++m_curr;
 			}
 
-			m_curr->apply();
+			if ( m_curr == last
+				|| m_currentTime <= m_curr->getTimeIndex() )
+			{
+				m_curr->apply();
+			}
+			else
+			{
+				auto next = m_curr + 1;
+				auto factor = float( ( m_currentTime - m_curr->getTimeIndex() ).count() )
+					/ float( ( next->getTimeIndex() - m_curr->getTimeIndex() ).count() );
+				m_curr->apply( *next, factor );
+			}
 		}
 	}
 
@@ -125,6 +125,27 @@ namespace castor3d
 			}
 		}
 
+		// Resolve once the instance object and the parent slot of each local transform, for the interpolated apply.
+		std::map< SkeletonAnimationObject const *, SkeletonAnimationInstanceObject * > objects;
+		std::map< SkeletonAnimationObject const *, uint32_t > slots;
+
+		for ( auto & object : skeletonAnimation )
+		{
+			objects.emplace( &object->getObject(), object.get() );
+		}
+
+		for ( auto & local : keyFrame.getLocalTransforms() )
+		{
+			auto it = objects.find( local.object );
+			auto parent = local.object->getParent();
+			auto itParent = parent
+				? slots.find( parent.get() )
+				: slots.end();
+			slots.emplace( local.object, uint32_t( m_locals.size() ) );
+			m_locals.emplace_back( ( it == objects.end() ? nullptr : it->second )
+				, ( itParent == slots.end() ? InvalidIndex : itParent->second ) );
+		}
+
 		for ( auto & submesh : skeleton.getMesh() )
 		{
 			m_boxes.emplace_back( submesh.get()
@@ -143,4 +164,47 @@ namespace castor3d
 
 		m_skeleton.getGeometry().updateContainers( m_boxes );
 	}
+
+	void SkeletonAnimationInstanceKeyFrame::apply( SkeletonAnimationInstanceKeyFrame const & next
+		, float factor )
+	{
+		auto & locals = m_keyFrame.getLocalTransforms();
+		auto & nextLocals = next.m_keyFrame.getLocalTransforms();
+		bool interpolable = factor > 0.0f
+			&& m_locals.size() == m_objects.size()
+			&& locals.size() == nextLocals.size()
+			&& std::equal( locals.begin()
+				, locals.end()
+				, nextLocals.begin()
+				, []( ObjectTrs const & lhs, ObjectTrs const & rhs )
+				{
+					return lhs.object == rhs.object;
+				} );
+
+		if ( !interpolable )
+		{
+			apply();
+			return;
+		}
+
+		// Parents come first, so their cumulative transform is computed before their children's.
+		m_cumulative.resize( locals.size() );
+
+		for ( size_t i = 0u; i < locals.size(); ++i )
+		{
+			auto local = interpolateTransform( locals[i], nextLocals[i], factor );
+			auto transform = composeTransform( local.translate, local.rotate, local.scale );
+			auto parent = m_locals[i].second;
+			m_cumulative[i] = parent == InvalidIndex
+				? transform
+				: m_cumulative[parent] * transform;
+
+			if ( auto object = m_locals[i].first )
+			{
+				object->update( m_cumulative[i] );
+			}
+		}
+
+		m_skeleton.getGeometry().updateContainers( m_boxes );
+	}
 }
@@ -94,7 +94,7 @@ namespace castor3d
 
 			if ( itSubMat != m_submeshesMaterials.end() )
 			{
-				MaterialSPtr oldMaterial = itSubMat->second.lock();
+				oldMaterial = itSubMat->second.lock();
 
 				if ( oldMaterial != material )
 				{
@@ -234,6 +234,11 @@ namespace castor3d
 			}
 
 			m_sphere.load( m_box );
+
+			if ( auto node = getParent() )
+			{
+				getScene()->markNodeDirty( *node );
+			}
 		}
 	}
 }
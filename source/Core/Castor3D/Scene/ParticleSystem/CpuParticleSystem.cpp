@@ -14,6 +14,7 @@ namespace castor3d
 {
 	CpuParticleSystem::CpuParticleSystem( ParticleSystem & parent )
 		: ParticleSystemImpl{ ParticleSystemImpl::Type::eCpu, parent }
+		, m_particles{ m_inputs }
 	{
 	}
 
@@ -24,21 +25,15 @@ namespace castor3d
 	bool CpuParticleSystem::initialise( RenderDevice const & device )
 	{
 		m_firstUnused = 1u;
-		m_particles.reserve( m_parent.getMaxParticlesCount() );
-		auto & defaultValues = m_parent.getDefaultValues();
-
-		for ( auto i = 0u; i < m_parent.getMaxParticlesCount(); ++i )
-		{
-			m_particles.emplace_back( m_inputs, defaultValues );
-		}
-
+		m_particles.initialise( m_parent.getMaxParticlesCount()
+			, m_parent.getDefaultValues() );
 		return doInitialise();
 	}
 
 	void CpuParticleSystem::cleanup( RenderDevice const & device )
 	{
 		doCleanup();
-		m_particles.clear();
+		m_particles.cleanup();
 		m_emitters.clear();
 		m_updaters.clear();
 		m_firstUnused = 1u;
@@ -48,10 +43,11 @@ namespace castor3d
 	{
 		auto firstUnused = m_firstUnused;
 
-		for ( auto i = 0u; i < firstUnused; ++i )
+		for ( auto & particleUpdater : m_updaters )
 		{
-			m_updaters.front()->update( updater.time
-				, m_particles[i] );
+			particleUpdater->update( updater.time
+				, m_particles
+				, firstUnused );
 		}
 
 		doPackParticles();
@@ -67,12 +63,7 @@ namespace castor3d
 
 		if ( auto dst = vbo.getBuffer().lock( 0u, mappedSize, 0u ) )
 		{
-			for ( auto i = 0u; i < m_firstUnused; ++i )
-			{
-				std::memcpy( dst, m_particles[i].getData(), stride );
-				dst += stride;
-			}
-
+			m_particles.interleave( m_firstUnused, dst );
 			vbo.getBuffer().flush( 0u, mappedSize );
 			vbo.getBuffer().unlock();
 		}
@@ -87,8 +78,11 @@ namespace castor3d
 
 	void CpuParticleSystem::onEmit( Particle const & particle )
 	{
-		m_particles[m_firstUnused++] = particle;
-		doOnEmit( particle );
+		if ( m_firstUnused < m_particles.getCapacity() )
+		{
+			m_particles.set( m_firstUnused++, particle );
+			doOnEmit( particle );
+		}
 	}
 
 	ParticleEmitter * CpuParticleSystem::addEmitter( ParticleEmitterUPtr emitter )
@@ -0,0 +1,83 @@
+#include "Castor3D/Scene/ParticleSystem/ParticleStreams.hpp"
+
+#include "Castor3D/Scene/ParticleSystem/Particle.hpp"
+
+using namespace castor;
+
+namespace castor3d
+{
+	ParticleStreams::ParticleStreams( ParticleDeclaration const & description )
+		: m_description{ description }
+	{
+	}
+
+	void ParticleStreams::initialise( uint32_t capacity
+		, StrStrMap const & defaultValues )
+	{
+		m_capacity = capacity;
+		m_data.resize( size_t( m_description.stride() ) * m_capacity );
+		Particle particle{ m_description, defaultValues };
+
+		for ( auto i = 0u; i < m_capacity; ++i )
+		{
+			set( i, particle );
+		}
+	}
+
+	void ParticleStreams::cleanup()
+	{
+		m_capacity = 0u;
+		m_data.clear();
+	}
+
+	void ParticleStreams::set( uint32_t index
+		, Particle const & particle )
+	{
+		CU_Require( index < m_capacity );
+
+		for ( auto & element : m_description )
+		{
+			auto size = getSize( element.m_dataType );
+			std::memcpy( getStream< uint8_t >( element ) + index * size
+				, particle.getData() + element.m_offset
+				, size );
+		}
+	}
+
+	void ParticleStreams::copy( uint32_t dst
+		, uint32_t src )
+	{
+		CU_Require( dst < m_capacity && src < m_capacity );
+
+		for ( auto & element : m_description )
+		{
+			auto size = getSize( element.m_dataType );
+			auto stream = getStream< uint8_t >( element );
+			std::memcpy( stream + dst * size
+				, stream + src * size
+				, size );
+		}
+	}
+
+	void ParticleStreams::interleave( uint32_t count
+		, uint8_t * dst )const
+	{
+		CU_Require( count <= m_capacity );
+		auto stride = m_description.stride();
+
+		// One pass per stream, the vertex buffer layout being interleaved.
+		for ( auto & element : m_description )
+		{
+			auto size = getSize( element.m_dataType );
+			auto src = getStream< uint8_t >( element );
+			auto out = dst + element.m_offset;
+
+			for ( auto i = 0u; i < count; ++i )
+			{
+				std::memcpy( out, src, size );
+				src += size;
+				out += stride;
+			}
+		}
+	}
+}
@@ -12,7 +12,8 @@ namespace castor3d
 	}
 
 	void ParticleUpdater::update( castor::Milliseconds const & time
-		, Particle & particle )
+		, ParticleStreams & particles
+		, uint32_t count )
 	{
 	}
 }
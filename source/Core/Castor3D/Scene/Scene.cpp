@@ -46,6 +46,8 @@
 
 #include <CastorUtils/Graphics/Font.hpp>
 #include <CastorUtils/Graphics/FontCache.hpp>
+#include <CastorUtils/Multithreading/ParallelFor.hpp>
+#include <CastorUtils/Multithreading/TaskGraph.hpp>
 
 using namespace castor;
 
@@ -140,7 +142,6 @@ namespace castor3d
 		: OwnedBy< Engine >{ engine }
 		, Named{ name }
 		, m_listener{ engine.getFrameListenerCache().add( cuT( "Scene_" ) + name + string::toString( (size_t)this ) ) }
-		, m_animationUpdater{ std::max( 2u, engine.getCpuInformations().getCoreCount() - ( engine.isThreaded() ? 2u : 1u ) ) }
 		, m_background{ std::make_shared< ColourBackground >( engine, *this ) }
 		, m_lightFactory{ std::make_shared< LightFactory >() }
 		, m_renderNodes{ castor::makeUnique< SceneRenderNodes >( *this ) }
@@ -434,6 +435,26 @@ namespace castor3d
 		m_onBillboardListChanged = m_billboardCache->onChanged.connect( setThisChanged );
 		m_onGeometryChanged = m_geometryCache->onChanged.connect( setThisChanged );
 		m_onSceneNodeChanged = m_sceneNodeCache->onChanged.connect( setThisChanged );
+		m_onGeometryAdded = m_geometryCache->onElementAdded.connect( [this]( Geometry & geometry )
+			{
+				if ( auto node = geometry.getParent() )
+				{
+					markNodeDirty( *node );
+				}
+			} );
+		m_onGeometryRemoved = m_geometryCache->onElementRemoved.connect( [this]( Geometry & geometry )
+			{
+				auto lock( castor::makeUniqueLock( m_dirtyNodesMutex ) );
+				m_removedGeometries.insert( &geometry );
+			} );
+		m_onSceneNodeRemoved = m_sceneNodeCache->onElementRemoved.connect( [this]( SceneNode & node )
+			{
+				{
+					auto lock( castor::makeUniqueLock( m_dirtyNodesMutex ) );
+					m_dirtyNodes.erase( &node );
+				}
+				m_geometryCache->removeNode( node );
+			} );
 		m_animatedObjectGroupCache->add( cuT( "C3D_Textures" ) );
 		m_reflectionMap = std::make_unique< EnvironmentMap >( engine.getGraphResourceHandler()
 			, *engine.getRenderSystem()->getMainRenderDevice()
@@ -444,7 +465,10 @@ namespace castor3d
 	{
 		m_reflectionMap.reset();
 		m_onSceneNodeChanged.disconnect();
+		m_onSceneNodeRemoved.disconnect();
 		m_onGeometryChanged.disconnect();
+		m_onGeometryAdded.disconnect();
+		m_onGeometryRemoved.disconnect();
 		m_onBillboardListChanged.disconnect();
 		m_onParticleSystemChanged.disconnect();
 
@@ -527,14 +551,47 @@ namespace castor3d
 	{
 		if ( m_initialised )
 		{
-			m_rootNode->update();
-			doUpdateBoundingBox();
-			doUpdateAnimations( updater );
-			doUpdateMaterials();
-			getLightCache().update( updater );
-			getGeometryCache().update( updater );
-			getBillboardListCache().update( updater );
-			getAnimatedObjectGroupCache().update( updater );
+			castor::TaskGraph graph;
+			auto nodes = graph.add( [this]()
+				{
+					updateNodeTransforms();
+				} );
+			auto animations = graph.add( [this, &updater]()
+				{
+					doUpdateAnimations( updater );
+				}
+				, { nodes } );
+			// Skinning animations update the geometries bounds.
+			graph.add( [this]()
+				{
+					doUpdateBvh();
+				}
+				, { nodes, animations } );
+			graph.add( [this]()
+				{
+					doUpdateMaterials();
+				} );
+			graph.add( [this, &updater]()
+				{
+					getLightCache().update( updater );
+				}
+				, { nodes } );
+			graph.add( [this, &updater]()
+				{
+					getGeometryCache().update( updater );
+				}
+				, { nodes } );
+			graph.add( [this, &updater]()
+				{
+					getBillboardListCache().update( updater );
+				}
+				, { nodes } );
+			graph.add( [this, &updater]()
+				{
+					getAnimatedObjectGroupCache().update( updater );
+				}
+				, { animations } );
+			graph.run( getEngine()->getCpuJobs() );
 			onUpdate( *this );
 			m_changed = false;
 		}
@@ -557,6 +614,99 @@ namespace castor3d
 		}
 	}
 
+	void Scene::markNodeDirty( SceneNode const & node )
+	{
+		{
+			auto lock( castor::makeUniqueLock( m_dirtyNodesMutex ) );
+			m_dirtyNodes.insert( &node );
+		}
+
+		if ( m_geometryCache )
+		{
+			m_geometryCache->markNodeDirty( node );
+		}
+	}
+
+	uint32_t Scene::addNodeTransform( SceneNode & node )
+	{
+		auto lock( castor::makeUniqueLock( m_nodeTransformsMutex ) );
+		return m_nodeTransforms.add( &node );
+	}
+
+	void Scene::removeNodeTransform( SceneNode & node )
+	{
+		auto lock( castor::makeUniqueLock( m_nodeTransformsMutex ) );
+		m_dirtyNodeTransforms.erase( &node );
+		m_nodeTransforms.remove( node.m_transformIndex );
+	}
+
+	void Scene::markNodeTransformDirty( SceneNode & node )
+	{
+		auto lock( castor::makeUniqueLock( m_nodeTransformsMutex ) );
+		m_dirtyNodeTransforms.insert( &node );
+	}
+
+	void Scene::updateNodeTransforms()
+	{
+		std::vector< SceneNode * > changed;
+
+		{
+			auto lock( castor::makeUniqueLock( m_nodeTransformsMutex ) );
+
+			auto getParentIndex = []( SceneNode const & node )
+			{
+				auto parent = node.getParent();
+				return parent
+					? parent->m_transformIndex
+					: castor::TransformHierarchy::InvalidIndex;
+			};
+
+			// Reparented nodes are first made roots, so that intermediate states can't hold cycles.
+			for ( auto node : m_dirtyNodeTransforms )
+			{
+				if ( m_nodeTransforms.getParent( node->m_transformIndex ) != getParentIndex( *node ) )
+				{
+					m_nodeTransforms.setParent( node->m_transformIndex
+						, castor::TransformHierarchy::InvalidIndex );
+				}
+			}
+
+			for ( auto node : m_dirtyNodeTransforms )
+			{
+				m_nodeTransforms.setParent( node->m_transformIndex
+					, getParentIndex( *node ) );
+				m_nodeTransforms.setLocal( node->m_transformIndex
+					, node->getPosition()
+					, node->getOrientation()
+					, node->getScale() );
+				node->m_mtxChanged = false;
+			}
+
+			m_dirtyNodeTransforms.clear();
+			m_nodeTransforms.update();
+			changed.reserve( m_nodeTransforms.getChanged().size() );
+
+			for ( auto index : m_nodeTransforms.getChanged() )
+			{
+				auto & node = *static_cast< SceneNode * >( m_nodeTransforms.getData( index ) );
+				node.m_transform = m_nodeTransforms.getLocalMatrix( index );
+				node.m_derivedTransform = m_nodeTransforms.getWorldMatrix( index );
+				node.m_derivedPosition = m_nodeTransforms.getWorldPosition( index );
+				node.m_derivedOrientation = m_nodeTransforms.getWorldOrientation( index );
+				node.m_derivedScale = m_nodeTransforms.getWorldScale( index );
+				node.m_transformPending = false;
+				changed.push_back( &node );
+			}
+		}
+
+		// Notified out of the lock, the listeners may move nodes.
+		for ( auto node : changed )
+		{
+			markNodeDirty( *node );
+			node->onChanged( *node );
+		}
+	}
+
 	void Scene::setBackground( SceneBackgroundSPtr value )
 	{
 		m_background = std::move( value );
@@ -789,29 +939,98 @@ namespace castor3d
 		m_lpvIndirectAttenuation = value;
 	}
 
-	void Scene::doUpdateBoundingBox()
+	void Scene::doRebuildBvh()
 	{
-		float fmin = std::numeric_limits< float >::max();
-		float fmax = std::numeric_limits< float >::lowest();
-		Point3f min{ fmin, fmin, fmin };
-		Point3f max{ fmax, fmax, fmax };
-		m_geometryCache->forEach( [&min, &max]( Geometry const & geometry )
+		m_geometryBvh.clear();
+		m_geometryProxies.clear();
+		using LockType = std::unique_lock< GeometryCache >;
+		LockType lock{ castor::makeUniqueLock( *m_geometryCache ) };
+
+		for ( auto & pair : *m_geometryCache )
+		{
+			auto & geometry = *pair.second;
+			auto node = geometry.getParent();
+
+			if ( node && geometry.getMesh() )
 			{
-				auto node = geometry.getParent();
-				auto mesh = geometry.getMesh();
+				m_geometryProxies.emplace( &geometry
+					, m_geometryBvh.insert( geometry.getBoundingBox().getAxisAligned( node->getDerivedTransformationMatrix() )
+						, &geometry ) );
+				m_movedGeometries.push_back( &geometry );
+			}
+		}
+	}
+
+	void Scene::doUpdateBvh()
+	{
+		m_movedGeometries.clear();
+		std::unordered_set< SceneNode const * > dirtyNodes;
+		std::unordered_set< Geometry const * > removedGeometries;
+		{
+			auto lock( castor::makeUniqueLock( m_dirtyNodesMutex ) );
+			std::swap( dirtyNodes, m_dirtyNodes );
+			std::swap( removedGeometries, m_removedGeometries );
+		}
+
+		if ( m_bvhDirty.exchange( false ) )
+		{
+			doRebuildBvh();
+		}
+		else
+		{
+			// Removals first, a new geometry may have been allocated at a removed one's address.
+			for ( auto geometry : removedGeometries )
+			{
+				auto it = m_geometryProxies.find( geometry );
 
-				if ( node && mesh )
+				if ( it != m_geometryProxies.end() )
 				{
-					auto bbox = mesh->getBoundingBox().getAxisAligned( node->getDerivedTransformationMatrix() );
+					m_geometryBvh.remove( it->second );
+					m_geometryProxies.erase( it );
+				}
+			}
 
-					for ( auto i = 0u; i < 3u; ++i )
+			for ( auto node : dirtyNodes )
+			{
+				for ( auto & object : node->getObjects() )
+				{
+					if ( object.get().getType() == MovableType::eGeometry )
 					{
-						min[i] = std::min( min[i], bbox.getMin()[i] );
-						max[i] = std::max( max[i], bbox.getMax()[i] );
+						auto & geometry = static_cast< Geometry & >( object.get() );
+
+						if ( geometry.getMesh() )
+						{
+							auto box = geometry.getBoundingBox().getAxisAligned( node->getDerivedTransformationMatrix() );
+							auto it = m_geometryProxies.find( &geometry );
+
+							if ( it == m_geometryProxies.end() )
+							{
+								m_geometryProxies.emplace( &geometry
+									, m_geometryBvh.insert( box, &geometry ) );
+							}
+							else
+							{
+								m_geometryBvh.update( it->second, box );
+							}
+
+							m_movedGeometries.push_back( &geometry );
+						}
 					}
 				}
-			} );
-		m_boundingBox.load( min, max );
+			}
+		}
+
+		if ( m_geometryBvh.empty() )
+		{
+			float fmin = std::numeric_limits< float >::max();
+			float fmax = std::numeric_limits< float >::lowest();
+			m_boundingBox.load( Point3f{ fmin, fmin, fmin }
+				, Point3f{ fmax, fmax, fmax } );
+		}
+		else
+		{
+			m_boundingBox = m_geometryBvh.getBoundingBox();
+		}
 	}
 
 	void Scene::doUpdateAnimations( CpuUpdater & updater )
@@ -823,25 +1042,13 @@ namespace castor3d
 			groups.emplace_back( group );
 		} );
 
-		if ( groups.size() > m_animationUpdater.getCount() )
-		{
-			for ( auto & group : groups )
-			{
-				m_animationUpdater.pushJob( [&group, &updater]()
-				{
-					group.get().update( updater );
-				} );
-			}
-
-			m_animationUpdater.waitAll( Milliseconds::max() );
-		}
-		else
-		{
-			for ( auto & group : groups )
+		castor::parallelForEach( getEngine()->getCpuJobs()
+			, groups.begin()
+			, groups.end()
+			, [&updater]( AnimatedObjectGroup & group )
 			{
-				group.get().update( updater );
-			}
-		}
+				group.update( updater );
+			} );
 	}
 
 	void Scene::doUpdateMaterials()
@@ -248,6 +248,7 @@ namespace castor3d
 		addParser( uint32_t( CSCNSection::eRoot ), cuT( "materials" ), parserRootMaterials, { makeParameter< ParameterType::eCheckedText >( m_materialTypes ) } );
 		addParser( uint32_t( CSCNSection::eRoot ), cuT( "include" ), parserInclude, { makeParameter< ParameterType::ePath >() } );
 		addParser( uint32_t( CSCNSection::eRoot ), cuT( "lpv_grid_size" ), parserRootLpvGridSize, { makeParameter< ParameterType::eUInt32 >() } );
+		addParser( uint32_t( CSCNSection::eRoot ), cuT( "frames_in_flight" ), parserRootFramesInFlight, { makeParameter< ParameterType::eUInt32 >( makeRange( 1u, 2u ) ) } );
 
 		addParser( uint32_t( CSCNSection::eWindow ), cuT( "render_target" ), parserWindowRenderTarget );
 		addParser( uint32_t( CSCNSection::eWindow ), cuT( "vsync" ), parserWindowVSync, { makeParameter< ParameterType::eBool >() } );
@@ -261,6 +262,7 @@ namespace castor3d
 		addParser( uint32_t( CSCNSection::eRenderTarget ), cuT( "postfx" ), parserRenderTargetPostEffect, { makeParameter< ParameterType::eName >(), makeParameter< ParameterType::eText >() } );
 		addParser( uint32_t( CSCNSection::eRenderTarget ), cuT( "tone_mapping" ), parserRenderTargetToneMapping, { makeParameter< ParameterType::eName >(), makeParameter< ParameterType::eText >() } );
 		addParser( uint32_t( CSCNSection::eRenderTarget ), cuT( "ssao" ), parserRenderTargetSsao );
+		addParser( uint32_t( CSCNSection::eRenderTarget ), cuT( "occlusion_culling" ), parserRenderTargetOcclusionCulling, { makeParameter< ParameterType::eBool >() } );
 		addParser( uint32_t( CSCNSection::eRenderTarget ), cuT( "}" ), parserRenderTargetEnd );
 
 		addParser( uint32_t( CSCNSection::eSampler ), cuT( "min_filter" ), parserSamplerMinFilter, { makeParameter< ParameterType::eCheckedText >( m_filters ) } );
@@ -363,6 +365,7 @@ namespace castor3d
 		addParser( uint32_t( CSCNSection::eObject ), cuT( "materials" ), parserObjectMaterials );
 		addParser( uint32_t( CSCNSection::eObject ), cuT( "cast_shadows" ), parserObjectCastShadows, { makeParameter< ParameterType::eBool >() } );
 		addParser( uint32_t( CSCNSection::eObject ), cuT( "receive_shadows" ), parserObjectReceivesShadows, { makeParameter< ParameterType::eBool >() } );
+		addParser( uint32_t( CSCNSection::eObject ), cuT( "occluder" ), parserObjectOccluder, { makeParameter< ParameterType::eBool >() } );
 		addParser( uint32_t( CSCNSection::eObject ), cuT( "}" ), parserObjectEnd );
 
 		addParser( uint32_t( CSCNSection::eObjectMaterials ), cuT( "material" ), parserObjectMaterialsMaterial, { makeParameter< ParameterType::eUInt16 >(), makeParameter< ParameterType::eName >() } );
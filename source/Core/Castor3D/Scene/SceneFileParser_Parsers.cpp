@@ -356,6 +356,23 @@ namespace castor3d
 	}
 	CU_EndAttribute()
 
+	CU_ImplementAttributeParser( parserRootFramesInFlight )
+	{
+		SceneFileContextSPtr parsingContext = std::static_pointer_cast< SceneFileContext >( context );
+
+		if ( params.empty() )
+		{
+			CU_ParsingError( cuT( "Missing [count] parameter." ) );
+		}
+		else
+		{
+			uint32_t count;
+			params[0]->get( count );
+			parsingContext->parser->getEngine()->setMaxFramesInFlight( count );
+		}
+	}
+	CU_EndAttribute()
+
 	CU_ImplementAttributeParser( parserWindowRenderTarget )
 	{
 		SceneFileContextSPtr parsingContext = std::static_pointer_cast< SceneFileContext >( context );
@@ -576,6 +593,23 @@ namespace castor3d
 	}
 	CU_EndAttributePush( CSCNSection::eSsao )
 
+	CU_ImplementAttributeParser( parserRenderTargetOcclusionCulling )
+	{
+		SceneFileContextSPtr parsingContext = std::static_pointer_cast< SceneFileContext >( context );
+
+		if ( !parsingContext->renderTarget )
+		{
+			CU_ParsingError( cuT( "No target initialised. (Did you forget to set its size and format ?)" ) );
+		}
+		else if ( !params.empty() )
+		{
+			bool value;
+			params[0]->get( value );
+			parsingContext->renderTarget->setOcclusionCulling( value );
+		}
+	}
+	CU_EndAttribute()
+
 	CU_ImplementAttributeParser( parserRenderTargetEnd )
 	{
 		SceneFileContextSPtr parsingContext = std::static_pointer_cast< SceneFileContext >( context );
@@ -2311,6 +2345,23 @@ namespace castor3d
 	}
 	CU_EndAttribute()
 
+	CU_ImplementAttributeParser( parserObjectOccluder )
+	{
+		SceneFileContextSPtr parsingContext = std::static_pointer_cast< SceneFileContext >( context );
+
+		if ( !parsingContext->geometry )
+		{
+			CU_ParsingError( cuT( "No Geometry initialised." ) );
+		}
+		else if ( !params.empty() )
+		{
+			bool value;
+			params[0]->get( value );
+			parsingContext->geometry->setOccluder( value );
+		}
+	}
+	CU_EndAttribute()
+
 	CU_ImplementAttributeParser( parserObjectEnd )
 	{
 		SceneFileContextSPtr parsingContext = std::static_pointer_cast< SceneFileContext >( context );
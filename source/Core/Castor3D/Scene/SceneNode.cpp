@@ -15,6 +15,7 @@ namespace castor3d
 		, castor::Named{ name }
 		, m_id{ CurrentId++ }
 		, m_displayable{ name == cuT( "RootNode" ) }
+		, m_transformIndex{ scene.addNodeTransform( *this ) }
 	{
 		if ( m_name.empty() )
 		{
@@ -23,6 +24,7 @@ namespace castor3d
 		}
 
 		Count++;
+		doMarkDirty();
 	}
 
 	SceneNode::SceneNode( castor::String const & name
@@ -43,21 +45,12 @@ namespace castor3d
 		}
 
 		detachChildren();
+		getScene()->removeNodeTransform( *this );
 	}
 
 	void SceneNode::update()
 	{
-		doComputeMatrix();
-
-		for ( auto it : m_children )
-		{
-			auto child = it.second.lock();
-
-			if ( child )
-			{
-				child->update();
-			}
-		}
+		getScene()->updateNodeTransforms();
 	}
 
 	void SceneNode::attachObject( MovableObject & object )
@@ -65,6 +58,7 @@ namespace castor3d
 		object.detach();
 		m_objects.push_back( object );
 		object.attachTo( *this );
+		getScene()->markNodeDirty( *this );
 	}
 
 	void SceneNode::detachObject( MovableObject & object )
@@ -98,7 +92,7 @@ namespace castor3d
 		{
 			m_displayable = m_parent->m_displayable;
 			m_parent->addChild( shared_from_this() );
-			m_mtxChanged = true;
+			doMarkDirty();
 		}
 	}
 
@@ -111,7 +105,7 @@ namespace castor3d
 			m_displayable = false;
 			m_parent = nullptr;
 			parent->detachChild( shared_from_this() );
-			m_mtxChanged = true;
+			doMarkDirty();
 		}
 	}
 
@@ -212,91 +206,66 @@ namespace castor3d
 	void SceneNode::rotate( castor::Quaternion const & orientation )
 	{
 		m_orientation *= orientation;
-		doUpdateChildsDerivedTransform();
-		m_mtxChanged = true;
+		doMarkDirty();
 	}
 
 	void SceneNode::translate( castor::Point3f const & position )
 	{
 		m_position += position;
-		doUpdateChildsDerivedTransform();
-		m_mtxChanged = true;
+		doMarkDirty();
 	}
 
 	void SceneNode::scale( castor::Point3f const & scale )
 	{
 		m_scale *= scale;
-		doUpdateChildsDerivedTransform();
-		m_mtxChanged = true;
+		doMarkDirty();
 	}
 
 	void SceneNode::setOrientation( castor::Quaternion const & orientation )
 	{
 		m_orientation = orientation;
-		doUpdateChildsDerivedTransform();
-		m_mtxChanged = true;
+		doMarkDirty();
 	}
 
 	void SceneNode::setPosition( castor::Point3f const & position )
 	{
 		m_position = position;
-		doUpdateChildsDerivedTransform();
-		m_mtxChanged = true;
+		doMarkDirty();
 	}
 
 	void SceneNode::setScale( castor::Point3f const & scale )
 	{
 		m_scale = scale;
-		doUpdateChildsDerivedTransform();
-		m_mtxChanged = true;
+		doMarkDirty();
 	}
 
-	castor::Point3f SceneNode::getDerivedPosition()const
+	castor::Point3f const & SceneNode::getDerivedPosition()const
 	{
-		castor::Point3f result( m_position );
-		auto parent = getParent();
-
-		if ( parent )
-		{
-			result = castor::matrix::getTransformed( parent->getDerivedTransformationMatrix(), m_position );
-		}
-
-		return result;
+		doFlushPendingTransform();
+		return m_derivedPosition;
 	}
 
-	castor::Quaternion SceneNode::getDerivedOrientation()const
+	castor::Quaternion const & SceneNode::getDerivedOrientation()const
 	{
-		castor::Quaternion result( m_orientation );
-		auto parent = getParent();
-
-		if ( parent )
-		{
-			result  = result * parent->getDerivedOrientation();
-		}
-
-		return result;
+		doFlushPendingTransform();
+		return m_derivedOrientation;
 	}
 
-	castor::Point3f SceneNode::getDerivedScale()const
+	castor::Point3f const & SceneNode::getDerivedScale()const
 	{
-		castor::Point3f result( m_scale );
-		auto parent = getParent();
-
-		if ( parent )
-		{
-			result *= parent->getDerivedScale();
-		}
-
-		return result;
+		doFlushPendingTransform();
+		return m_derivedScale;
 	}
 
 	castor::Matrix4x4f const & SceneNode::getTransformationMatrix()const
 	{
+		doFlushPendingTransform();
 		return m_transform;
 	}
 
 	castor::Matrix4x4f const & SceneNode::getDerivedTransformationMatrix()const
 	{
+		doFlushPendingTransform();
 		return m_derivedTransform;
 	}
 
@@ -315,44 +284,35 @@ namespace castor3d
 		return m_visible && ( parent ? parent->isVisible() : true );
 	}
 
-	void SceneNode::doComputeMatrix()
+	void SceneNode::doMarkDirty()
 	{
-		if ( m_mtxChanged )
+		m_mtxChanged = true;
+		doMarkTransformPending();
+		getScene()->markNodeTransformDirty( *this );
+	}
+
+	void SceneNode::doMarkTransformPending()
+	{
+		// The descendants of an already pending node are pending too.
+		if ( m_transformPending.exchange( true ) )
 		{
-			m_derivedMtxChanged = true;
-			castor::matrix::setTransform( m_transform, m_position, m_scale, m_orientation );
-			m_mtxChanged = false;
+			return;
 		}
 
-		if ( m_derivedMtxChanged )
+		for ( auto & child : m_children )
 		{
-			auto parent = getParent();
-
-			if ( parent )
+			if ( auto node = child.second.lock() )
 			{
-				m_derivedTransform = parent->getDerivedTransformationMatrix() * m_transform;
+				node->doMarkTransformPending();
 			}
-			else
-			{
-				m_derivedTransform = m_transform;
-			}
-
-			m_derivedMtxChanged = false;
-			onChanged( *this );
 		}
 	}
 
-	void SceneNode::doUpdateChildsDerivedTransform()
+	void SceneNode::doFlushPendingTransform()const
 	{
-		for ( auto it : m_children )
+		if ( m_transformPending )
 		{
-			SceneNodeSPtr current = it.second.lock();
-
-			if ( current )
-			{
-				current->doUpdateChildsDerivedTransform();
-				current->m_derivedMtxChanged = true;
-			}
+			getScene()->updateNodeTransforms();
 		}
 	}
 }
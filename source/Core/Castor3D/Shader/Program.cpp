@@ -140,6 +140,24 @@ namespace castor3d
 		}
 	}
 
+	void ShaderProgram::setSource( VkShaderStageFlagBits target, SpirVShader shader )
+	{
+		m_files[target].clear();
+		auto added = doAddModule( target, getName(), m_modules );
+
+		if ( added )
+		{
+			auto & renderSystem = *getRenderSystem();
+			m_modules.find( target )->second.source = shader.text;
+			m_compiled.emplace( target
+				, CompiledShader{ getName()
+					, std::move( shader ) } );
+			m_states.push_back( loadShader( *renderSystem.getMainRenderDevice()
+				, m_compiled[target]
+				, target ) );
+		}
+	}
+
 	ShaderModule const & ShaderProgram::getSource( VkShaderStageFlagBits target )const
 	{
 		auto it = m_modules.find( target );
@@ -154,6 +172,13 @@ namespace castor3d
 			&& !it->second.shader.spirv.empty();
 	}
 
+	SpirVShader const & ShaderProgram::getCompiled( VkShaderStageFlagBits target )const
+	{
+		auto it = m_compiled.find( target );
+		CU_Require( it != m_compiled.end() );
+		return it->second.shader;
+	}
+
 	SpirVShader compileShader( RenderSystem const & renderSystem
 		, ShaderModule const & module )
 	{
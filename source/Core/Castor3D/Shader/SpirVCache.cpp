@@ -0,0 +1,192 @@
+#include "Castor3D/Shader/SpirVCache.hpp"
+
+#include "Castor3D/Miscellaneous/Logger.hpp"
+#include "Castor3D/Miscellaneous/Version.hpp"
+
+#include <CastorUtils/Data/BinaryFile.hpp>
+#include <CastorUtils/Miscellaneous/Hash.hpp>
+
+#include <cstring>
+#include <iomanip>
+
+namespace castor3d
+{
+	namespace
+	{
+		// Bump this when the file layout changes.
+		uint32_t constexpr CacheRevision = 1u;
+		uint32_t constexpr CacheMagic = 0x43534333u; // "C3SC"
+		uint32_t constexpr SpirVMagic = 0x07230203u;
+
+		struct FileHeader
+		{
+			uint32_t magic;
+			uint32_t revision;
+			uint32_t engineVersion;
+			uint32_t stageCount;
+			uint64_t key;
+			uint64_t checksum;
+		};
+
+		struct StageHeader
+		{
+			uint32_t stage;
+			uint32_t wordCount;
+		};
+
+		template< typename DataT >
+		void append( castor::ByteArray & buffer
+			, DataT const * data
+			, size_t count )
+		{
+			auto begin = reinterpret_cast< uint8_t const * >( data );
+			buffer.insert( buffer.end(), begin, begin + count * sizeof( DataT ) );
+		}
+	}
+
+	SpirVCache::SpirVCache( castor::Path folder )
+		: m_folder{ std::move( folder ) }
+	{
+	}
+
+	bool SpirVCache::load( uint64_t key
+		, Stages & stages )const
+	{
+		auto path = doGetFilePath( key );
+
+		if ( !isEnabled()
+			|| !castor::File::fileExists( path ) )
+		{
+			return false;
+		}
+
+		castor::ByteArray content;
+
+		try
+		{
+			castor::BinaryFile file{ path, castor::File::OpenMode::eRead };
+			content.resize( size_t( file.getLength() ) );
+
+			if ( file.readArray( content.data(), content.size() ) != content.size() )
+			{
+				content.clear();
+			}
+		}
+		catch ( std::exception & exc )
+		{
+			log::warn << "SpirVCache: Couldn't read [" << path << "]: " << exc.what() << std::endl;
+			return false;
+		}
+
+		FileHeader header{};
+		bool result = content.size() >= sizeof( FileHeader );
+
+		if ( result )
+		{
+			std::memcpy( &header, content.data(), sizeof( FileHeader ) );
+			result = header.magic == CacheMagic
+				&& header.revision == CacheRevision
+				&& header.engineVersion == Version{}.getVkVersion()
+				&& header.key == key
+				&& header.checksum == castor::hashBytes( content.data() + sizeof( FileHeader )
+					, content.size() - sizeof( FileHeader ) );
+		}
+
+		Stages loaded;
+		size_t offset = sizeof( FileHeader );
+
+		for ( uint32_t i = 0u; result && i < header.stageCount; ++i )
+		{
+			StageHeader stage{};
+			result = offset + sizeof( StageHeader ) <= content.size();
+
+			if ( result )
+			{
+				std::memcpy( &stage, content.data() + offset, sizeof( StageHeader ) );
+				offset += sizeof( StageHeader );
+				result = stage.wordCount > 0u
+					&& offset + stage.wordCount * sizeof( uint32_t ) <= content.size();
+			}
+
+			if ( result )
+			{
+				castor::UInt32Array spirv( stage.wordCount );
+				std::memcpy( spirv.data(), content.data() + offset, stage.wordCount * sizeof( uint32_t ) );
+				offset += stage.wordCount * sizeof( uint32_t );
+				result = spirv.front() == SpirVMagic;
+				loaded.emplace( VkShaderStageFlagBits( stage.stage ), std::move( spirv ) );
+			}
+		}
+
+		if ( result )
+		{
+			result = offset == content.size()
+				&& !loaded.empty();
+		}
+
+		if ( result )
+		{
+			stages = std::move( loaded );
+		}
+		else
+		{
+			log::warn << "SpirVCache: Invalid or outdated cache file [" << path << "], it will be regenerated." << std::endl;
+		}
+
+		return result;
+	}
+
+	bool SpirVCache::save( uint64_t key
+		, Stages const & stages )const
+	{
+		if ( !isEnabled() )
+		{
+			return false;
+		}
+
+		if ( !castor::File::directoryExists( m_folder )
+			&& !castor::File::directoryCreate( m_folder ) )
+		{
+			log::warn << "SpirVCache: Couldn't create folder [" << m_folder << "]." << std::endl;
+			return false;
+		}
+
+		castor::ByteArray content( sizeof( FileHeader ) );
+
+		for ( auto & stage : stages )
+		{
+			StageHeader stageHeader{ uint32_t( stage.first ), uint32_t( stage.second.size() ) };
+			append( content, &stageHeader, 1u );
+			append( content, stage.second.data(), stage.second.size() );
+		}
+
+		FileHeader header{ CacheMagic
+			, CacheRevision
+			, Version{}.getVkVersion()
+			, uint32_t( stages.size() )
+			, key
+			, castor::hashBytes( content.data() + sizeof( FileHeader ), content.size() - sizeof( FileHeader ) ) };
+		std::memcpy( content.data(), &header, sizeof( FileHeader ) );
+		auto path = doGetFilePath( key );
+		bool result = false;
+
+		try
+		{
+			castor::BinaryFile file{ path, castor::File::OpenMode::eWrite };
+			result = file.writeArray( content.data(), content.size() ) == content.size();
+		}
+		catch ( std::exception & exc )
+		{
+			log::warn << "SpirVCache: Couldn't write [" << path << "]: " << exc.what() << std::endl;
+		}
+
+		return result;
+	}
+
+	castor::Path SpirVCache::doGetFilePath( uint64_t key )const
+	{
+		std::stringstream stream;
+		stream << std::hex << std::setw( 16 ) << std::setfill( '0' ) << key << ".spvc";
+		return m_folder / castor::Path{ stream.str() };
+	}
+}
@@ -31,7 +31,8 @@ namespace castor
 		{
 			result = writeNamedSub( file, cuT( "size" ), target.getSize() )
 				&& write( file, cuT( "format" ), getFormatName( convert( target.getPixelFormat() ) ) )
-				&& writeName( file, cuT( "tone_mapping" ), target.getToneMapping()->getName() );
+				&& writeName( file, cuT( "tone_mapping" ), target.getToneMapping()->getName() )
+				&& writeOpt( file, cuT( "occlusion_culling" ), target.isOcclusionCulling(), false );
 
 			if ( result && target.getScene() )
 			{
@@ -452,6 +452,7 @@ namespace castor
 		bool result = writeComment( file, cuT( "Global configuration" ) )
 			&& writeOpt( file, "debug_overlays", scene.getEngine()->getRenderLoop().hasDebugOverlays() )
 			&& writeOpt( file, "lpv_grid_size", scene.getEngine()->getLpvGridSize(), 32u )
+			&& writeOpt( file, "frames_in_flight", scene.getEngine()->getMaxFramesInFlight(), 1u )
 			&& write( file, "materials", scene.getPassesName() );
 
 		if ( result )
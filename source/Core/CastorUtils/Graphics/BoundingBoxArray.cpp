@@ -0,0 +1,223 @@
+#include "CastorUtils/Graphics/BoundingBoxArray.hpp"
+
+#include "CastorUtils/Exception/Assertion.hpp"
+#include "CastorUtils/Math/Simd.hpp"
+
+#include <cmath>
+
+namespace castor
+{
+	namespace
+	{
+		uint32_t getPaddedSize( uint32_t count )
+		{
+			return ( count + 3u ) & ~3u;
+		}
+	}
+
+	struct BoundingBoxArray::SimdPlane
+	{
+		explicit SimdPlane( PlaneEquation const & plane )
+			: normalX{ plane.getNormal()[0] }
+			, normalY{ plane.getNormal()[1] }
+			, normalZ{ plane.getNormal()[2] }
+			, absNormalX{ std::abs( plane.getNormal()[0] ) }
+			, absNormalY{ std::abs( plane.getNormal()[1] ) }
+			, absNormalZ{ std::abs( plane.getNormal()[2] ) }
+			, distance{ plane.getDistance() }
+		{
+		}
+
+		Float4 normalX;
+		Float4 normalY;
+		Float4 normalZ;
+		Float4 absNormalX;
+		Float4 absNormalY;
+		Float4 absNormalZ;
+		Float4 distance;
+	};
+
+	void BoundingBoxArray::clear()
+	{
+		m_count = 0u;
+		m_centerX.clear();
+		m_centerY.clear();
+		m_centerZ.clear();
+		m_extentX.clear();
+		m_extentY.clear();
+		m_extentZ.clear();
+	}
+
+	void BoundingBoxArray::reserve( size_t count )
+	{
+		auto padded = getPaddedSize( uint32_t( count ) );
+		m_centerX.reserve( padded );
+		m_centerY.reserve( padded );
+		m_centerZ.reserve( padded );
+		m_extentX.reserve( padded );
+		m_extentY.reserve( padded );
+		m_extentZ.reserve( padded );
+	}
+
+	uint32_t BoundingBoxArray::add( BoundingBox const & box
+		, Matrix4x4f const & transformations )
+	{
+		auto result = m_count;
+		doResize( m_count + 1u );
+		set( result, box, transformations );
+		return result;
+	}
+
+	void BoundingBoxArray::set( uint32_t index
+		, BoundingBox const & box
+		, Matrix4x4f const & transformations )
+	{
+		CU_Require( index < m_count );
+		auto aabb = box.getAxisAligned( transformations );
+		auto center = aabb.getCenter();
+		auto extent = aabb.getDimensions() / 2.0f;
+		m_centerX[index] = center[0];
+		m_centerY[index] = center[1];
+		m_centerZ[index] = center[2];
+		m_extentX[index] = extent[0];
+		m_extentY[index] = extent[1];
+		m_extentZ[index] = extent[2];
+	}
+
+	void BoundingBoxArray::cull( ArrayView< PlaneEquation const > planes
+		, std::vector< uint8_t > & visible )const
+	{
+		auto simdPlanes = doGetSimdPlanes( planes );
+		visible.resize( getPaddedSize( m_count ) );
+
+		for ( uint32_t i = 0u; i < m_count; i += 4u )
+		{
+			auto mask = doCullBatch( simdPlanes, i );
+			visible[i + 0u] = ( mask & 0x01u ) ? 0u : 1u;
+			visible[i + 1u] = ( mask & 0x02u ) ? 0u : 1u;
+			visible[i + 2u] = ( mask & 0x04u ) ? 0u : 1u;
+			visible[i + 3u] = ( mask & 0x08u ) ? 0u : 1u;
+		}
+
+		visible.resize( m_count );
+	}
+
+	void BoundingBoxArray::cull( ArrayView< PlaneEquation const > planes
+		, ArrayView< Range const > ranges
+		, std::vector< uint8_t > & visible )const
+	{
+		auto simdPlanes = doGetSimdPlanes( planes );
+		visible.assign( m_count, 0u );
+		auto padded = getPaddedSize( m_count );
+
+		for ( auto & range : ranges )
+		{
+			CU_Require( range.first + range.count <= m_count );
+			auto end = range.first + range.count;
+			auto i = range.first;
+
+			// Ranges don't start on a multiple of 4, only full batches within the padded arrays are loaded.
+			while ( i < end && i + 4u <= padded )
+			{
+				auto mask = doCullBatch( simdPlanes, i );
+
+				for ( uint32_t lane = 0u; lane < 4u && i + lane < end; ++lane )
+				{
+					visible[i + lane] = ( mask & ( 1u << lane ) ) ? 0u : 1u;
+				}
+
+				i += 4u;
+			}
+
+			while ( i < end )
+			{
+				visible[i] = isVisible( i, planes ) ? 1u : 0u;
+				++i;
+			}
+		}
+	}
+
+	bool BoundingBoxArray::isVisible( uint32_t index
+		, ArrayView< PlaneEquation const > planes )const
+	{
+		CU_Require( index < m_count );
+		Point3f center{ m_centerX[index], m_centerY[index], m_centerZ[index] };
+		Point3f extent{ m_extentX[index], m_extentY[index], m_extentZ[index] };
+		bool result = true;
+		auto it = planes.begin();
+
+		while ( result && it != planes.end() )
+		{
+			auto & normal = it->getNormal();
+			result = it->distance( center )
+				+ std::abs( normal[0] ) * extent[0]
+				+ std::abs( normal[1] ) * extent[1]
+				+ std::abs( normal[2] ) * extent[2] >= 0.0f;
+			++it;
+		}
+
+		return result;
+	}
+
+	BoundingBox BoundingBoxArray::getBoundingBox( uint32_t index )const
+	{
+		CU_Require( index < m_count );
+		Point3f center{ m_centerX[index], m_centerY[index], m_centerZ[index] };
+		Point3f extent{ m_extentX[index], m_extentY[index], m_extentZ[index] };
+		return BoundingBox{ center - extent, center + extent };
+	}
+
+	std::vector< BoundingBoxArray::SimdPlane > BoundingBoxArray::doGetSimdPlanes( ArrayView< PlaneEquation const > planes )
+	{
+		std::vector< SimdPlane > result;
+		result.reserve( planes.size() );
+
+		for ( auto & plane : planes )
+		{
+			result.emplace_back( plane );
+		}
+
+		return result;
+	}
+
+	uint32_t BoundingBoxArray::doCullBatch( std::vector< SimdPlane > const & planes
+		, uint32_t index )const
+	{
+		auto centerX = Float4::loadUnaligned( &m_centerX[index] );
+		auto centerY = Float4::loadUnaligned( &m_centerY[index] );
+		auto centerZ = Float4::loadUnaligned( &m_centerZ[index] );
+		auto extentX = Float4::loadUnaligned( &m_extentX[index] );
+		auto extentY = Float4::loadUnaligned( &m_extentY[index] );
+		auto extentZ = Float4::loadUnaligned( &m_extentZ[index] );
+		Float4 const zero{ 0.0f };
+		Float4 outside{ 0.0f };
+
+		for ( auto & plane : planes )
+		{
+			// Signed distance of the box's positive vertex to the plane:
+			// the distance of its center, plus its extent projected on the plane normal.
+			auto distance = plane.normalX * centerX
+				+ plane.normalY * centerY
+				+ plane.normalZ * centerZ
+				+ plane.distance;
+			auto radius = plane.absNormalX * extentX
+				+ plane.absNormalY * extentY
+				+ plane.absNormalZ * extentZ;
+			outside |= lessThan( distance + radius, zero );
+		}
+
+		return outside.getMask();
+	}
+
+	void BoundingBoxArray::doResize( uint32_t count )
+	{
+		m_count = count;
+		auto padded = getPaddedSize( count );
+		m_centerX.resize( padded, 0.0f );
+		m_centerY.resize( padded, 0.0f );
+		m_centerZ.resize( padded, 0.0f );
+		m_extentX.resize( padded, 0.0f );
+		m_extentY.resize( padded, 0.0f );
+		m_extentZ.resize( padded, 0.0f );
+	}
+}
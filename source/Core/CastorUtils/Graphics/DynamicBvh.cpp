@@ -0,0 +1,378 @@
+#include "CastorUtils/Graphics/DynamicBvh.hpp"
+
+#include "CastorUtils/Exception/Assertion.hpp"
+
+#include <algorithm>
+
+namespace castor
+{
+	namespace
+	{
+		Point3f getMin( Point3f const & lhs
+			, Point3f const & rhs )
+		{
+			return Point3f{ std::min( lhs[0], rhs[0] )
+				, std::min( lhs[1], rhs[1] )
+				, std::min( lhs[2], rhs[2] ) };
+		}
+
+		Point3f getMax( Point3f const & lhs
+			, Point3f const & rhs )
+		{
+			return Point3f{ std::max( lhs[0], rhs[0] )
+				, std::max( lhs[1], rhs[1] )
+				, std::max( lhs[2], rhs[2] ) };
+		}
+
+		float getArea( Point3f const & min
+			, Point3f const & max )
+		{
+			auto dx = max[0] - min[0];
+			auto dy = max[1] - min[1];
+			auto dz = max[2] - min[2];
+			return 2.0f * ( dx * dy + dy * dz + dz * dx );
+		}
+
+		bool overlap( Point3f const & lhsMin
+			, Point3f const & lhsMax
+			, Point3f const & rhsMin
+			, Point3f const & rhsMax )
+		{
+			return lhsMin[0] <= rhsMax[0] && lhsMax[0] >= rhsMin[0]
+				&& lhsMin[1] <= rhsMax[1] && lhsMax[1] >= rhsMin[1]
+				&& lhsMin[2] <= rhsMax[2] && lhsMax[2] >= rhsMin[2];
+		}
+	}
+
+	void DynamicBvh::clear()
+	{
+		m_nodes.clear();
+		m_root = InvalidProxy;
+		m_freeList = InvalidProxy;
+		m_count = 0u;
+	}
+
+	uint32_t DynamicBvh::insert( BoundingBox const & box
+		, void * data )
+	{
+		auto result = doAllocateNode();
+		auto & node = m_nodes[result];
+		node.min = box.getMin();
+		node.max = box.getMax();
+		node.data = data;
+		node.height = 0;
+		doInsertLeaf( result );
+		++m_count;
+		return result;
+	}
+
+	void DynamicBvh::remove( uint32_t proxy )
+	{
+		CU_Require( proxy < m_nodes.size() && m_nodes[proxy].isLeaf() );
+		doRemoveLeaf( proxy );
+		doFreeNode( proxy );
+		--m_count;
+	}
+
+	void DynamicBvh::update( uint32_t proxy
+		, BoundingBox const & box )
+	{
+		CU_Require( proxy < m_nodes.size() && m_nodes[proxy].isLeaf() );
+		auto min = box.getMin();
+		auto max = box.getMax();
+		auto & node = m_nodes[proxy];
+
+		if ( overlap( node.min, node.max, min, max ) )
+		{
+			node.min = min;
+			node.max = max;
+			doRefit( node.parent );
+		}
+		else
+		{
+			doRemoveLeaf( proxy );
+			m_nodes[proxy].min = min;
+			m_nodes[proxy].max = max;
+			doInsertLeaf( proxy );
+		}
+	}
+
+	bool DynamicBvh::validate()const
+	{
+		return empty()
+			|| ( m_nodes[m_root].parent == InvalidProxy
+				&& doValidate( m_root ) );
+	}
+
+	uint32_t DynamicBvh::doAllocateNode()
+	{
+		uint32_t result;
+
+		if ( m_freeList == InvalidProxy )
+		{
+			result = uint32_t( m_nodes.size() );
+			m_nodes.emplace_back();
+		}
+		else
+		{
+			result = m_freeList;
+			m_freeList = m_nodes[result].parent;
+			m_nodes[result] = Node{};
+		}
+
+		return result;
+	}
+
+	void DynamicBvh::doFreeNode( uint32_t index )
+	{
+		auto & node = m_nodes[index];
+		node.parent = m_freeList;
+		node.left = InvalidProxy;
+		node.right = InvalidProxy;
+		node.height = -1;
+		node.data = nullptr;
+		m_freeList = index;
+	}
+
+	void DynamicBvh::doInsertLeaf( uint32_t leaf )
+	{
+		if ( m_root == InvalidProxy )
+		{
+			m_root = leaf;
+			m_nodes[leaf].parent = InvalidProxy;
+			return;
+		}
+
+		// Find the best sibling, using the surface area heuristic.
+		auto leafMin = m_nodes[leaf].min;
+		auto leafMax = m_nodes[leaf].max;
+		auto index = m_root;
+
+		while ( !m_nodes[index].isLeaf() )
+		{
+			auto & node = m_nodes[index];
+			auto area = getArea( node.min, node.max );
+			auto combinedArea = getArea( getMin( node.min, leafMin ), getMax( node.max, leafMax ) );
+			// Cost of creating a new parent for this node and the new leaf.
+			auto cost = 2.0f * combinedArea;
+			// Minimum cost of pushing the leaf further down the tree.
+			auto inheritanceCost = 2.0f * ( combinedArea - area );
+			auto getChildCost = [&]( uint32_t child )
+			{
+				auto & childNode = m_nodes[child];
+				auto childArea = getArea( getMin( childNode.min, leafMin ), getMax( childNode.max, leafMax ) );
+
+				if ( childNode.isLeaf() )
+				{
+					return childArea + inheritanceCost;
+				}
+
+				return childArea - getArea( childNode.min, childNode.max ) + inheritanceCost;
+			};
+			auto leftCost = getChildCost( node.left );
+			auto rightCost = getChildCost( node.right );
+
+			if ( cost < leftCost && cost < rightCost )
+			{
+				break;
+			}
+
+			index = leftCost < rightCost
+				? node.left
+				: node.right;
+		}
+
+		// Create a new parent for the sibling and the leaf.
+		auto sibling = index;
+		auto oldParent = m_nodes[sibling].parent;
+		auto newParent = doAllocateNode();
+		{
+			auto & node = m_nodes[newParent];
+			node.parent = oldParent;
+			node.left = sibling;
+			node.right = leaf;
+			node.height = m_nodes[sibling].height + 1;
+			node.min = getMin( m_nodes[sibling].min, leafMin );
+			node.max = getMax( m_nodes[sibling].max, leafMax );
+		}
+
+		if ( oldParent == InvalidProxy )
+		{
+			m_root = newParent;
+		}
+		else if ( m_nodes[oldParent].left == sibling )
+		{
+			m_nodes[oldParent].left = newParent;
+		}
+		else
+		{
+			m_nodes[oldParent].right = newParent;
+		}
+
+		m_nodes[sibling].parent = newParent;
+		m_nodes[leaf].parent = newParent;
+		doRefit( newParent );
+	}
+
+	void DynamicBvh::doRemoveLeaf( uint32_t leaf )
+	{
+		if ( leaf == m_root )
+		{
+			m_root = InvalidProxy;
+			return;
+		}
+
+		// The leaf's parent is replaced by the leaf's sibling.
+		auto parent = m_nodes[leaf].parent;
+		auto grandParent = m_nodes[parent].parent;
+		auto sibling = m_nodes[parent].left == leaf
+			? m_nodes[parent].right
+			: m_nodes[parent].left;
+
+		if ( grandParent == InvalidProxy )
+		{
+			m_root = sibling;
+			m_nodes[sibling].parent = InvalidProxy;
+		}
+		else
+		{
+			if ( m_nodes[grandParent].left == parent )
+			{
+				m_nodes[grandParent].left = sibling;
+			}
+			else
+			{
+				m_nodes[grandParent].right = sibling;
+			}
+
+			m_nodes[sibling].parent = grandParent;
+		}
+
+		doFreeNode( parent );
+		m_nodes[leaf].parent = InvalidProxy;
+		doRefit( grandParent );
+	}
+
+	void DynamicBvh::doRefit( uint32_t index )
+	{
+		while ( index != InvalidProxy )
+		{
+			index = doBalance( index );
+			doFitNode( index );
+			index = m_nodes[index].parent;
+		}
+	}
+
+	uint32_t DynamicBvh::doBalance( uint32_t a )
+	{
+		// Rotates the tree at node A if its children heights differ by more than one.
+		// Returns the node now standing at A's place.
+		auto & nodeA = m_nodes[a];
+
+		if ( nodeA.isLeaf() )
+		{
+			return a;
+		}
+
+		auto b = nodeA.left;
+		auto c = nodeA.right;
+		auto balance = m_nodes[c].height - m_nodes[b].height;
+
+		if ( balance >= -1 && balance <= 1 )
+		{
+			return a;
+		}
+
+		// Promotes child (the higher one of B or C) in A's place.
+		auto rotate = [this, a]( uint32_t child, bool childIsRight )
+		{
+			auto & nodeA = m_nodes[a];
+			auto & nodeChild = m_nodes[child];
+			auto f = nodeChild.left;
+			auto g = nodeChild.right;
+			nodeChild.left = a;
+			nodeChild.parent = nodeA.parent;
+			nodeA.parent = child;
+
+			if ( nodeChild.parent == InvalidProxy )
+			{
+				m_root = child;
+			}
+			else if ( m_nodes[nodeChild.parent].left == a )
+			{
+				m_nodes[nodeChild.parent].left = child;
+			}
+			else
+			{
+				m_nodes[nodeChild.parent].right = child;
+			}
+
+			// The higher grandchild stays under child, the other one goes to A.
+			auto keep = f;
+			auto give = g;
+
+			if ( m_nodes[f].height < m_nodes[g].height )
+			{
+				keep = g;
+				give = f;
+			}
+
+			nodeChild.right = keep;
+
+			if ( childIsRight )
+			{
+				nodeA.right = give;
+			}
+			else
+			{
+				nodeA.left = give;
+			}
+
+			m_nodes[give].parent = a;
+			doFitNode( a );
+			doFitNode( child );
+			return child;
+		};
+
+		return balance > 1
+			? rotate( c, true )
+			: rotate( b, false );
+	}
+
+	void DynamicBvh::doFitNode( uint32_t index )
+	{
+		auto & node = m_nodes[index];
+
+		if ( node.isLeaf() )
+		{
+			return;
+		}
+
+		auto & left = m_nodes[node.left];
+		auto & right = m_nodes[node.right];
+		node.min = getMin( left.min, right.min );
+		node.max = getMax( left.max, right.max );
+		node.height = 1 + std::max( left.height, right.height );
+	}
+
+	bool DynamicBvh::doValidate( uint32_t index )const
+	{
+		auto & node = m_nodes[index];
+
+		if ( node.isLeaf() )
+		{
+			return node.height == 0
+				&& node.right == InvalidProxy;
+		}
+
+		auto & left = m_nodes[node.left];
+		auto & right = m_nodes[node.right];
+		return left.parent == index
+			&& right.parent == index
+			&& node.height == 1 + std::max( left.height, right.height )
+			&& node.min == getMin( left.min, right.min )
+			&& node.max == getMax( left.max, right.max )
+			&& doValidate( node.left )
+			&& doValidate( node.right );
+	}
+}
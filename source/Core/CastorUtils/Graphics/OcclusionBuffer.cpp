@@ -0,0 +1,293 @@
+#include "CastorUtils/Graphics/OcclusionBuffer.hpp"
+
+#include "CastorUtils/Exception/Assertion.hpp"
+#include "CastorUtils/Math/Simd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace castor
+{
+	namespace
+	{
+		float constexpr NoOccluder = std::numeric_limits< float >::max();
+		float constexpr MinArea = 1.0e-6f;
+
+		// Projects a position to screen space (pixels and depth).
+		// Returns false for positions behind the near plane, whatever the projection's depth range ([0, 1] or [-1, 1]).
+		bool project( Matrix4x4f const & transform
+			, Point3f const & position
+			, float width
+			, float height
+			, Point3f & result )
+		{
+			auto clip = transform * Point4f{ position[0], position[1], position[2], 1.0f };
+
+			if ( clip[3] <= 0.0f || clip[2] < 0.0f )
+			{
+				return false;
+			}
+
+			auto invW = 1.0f / clip[3];
+			result = Point3f{ ( clip[0] * invW * 0.5f + 0.5f ) * width
+				, ( clip[1] * invW * 0.5f + 0.5f ) * height
+				, clip[2] * invW };
+			return true;
+		}
+
+		// Edge function of the edge (p, q), as E(x, y) = a * x + b * y + c, positive on its left side.
+		struct Edge
+		{
+			Edge( Point3f const & p
+				, Point3f const & q
+				, float sign )
+				: a{ sign * ( p[1] - q[1] ) }
+				, b{ sign * ( q[0] - p[0] ) }
+				, c{ sign * ( ( q[1] - p[1] ) * p[0] - ( q[0] - p[0] ) * p[1] ) }
+			{
+			}
+
+			float a;
+			float b;
+			float c;
+		};
+	}
+
+	OcclusionBuffer::OcclusionBuffer( uint32_t width
+		, uint32_t height )
+	{
+		CU_Require( width > 0u && height > 0u );
+		// The first level's rows are padded to a multiple of 4, to be rasterised 4 pixels at once.
+		m_levels.push_back( Level{ width, height, ( width + 3u ) & ~3u, {} } );
+
+		while ( width > 1u || height > 1u )
+		{
+			width = ( width + 1u ) / 2u;
+			height = ( height + 1u ) / 2u;
+			m_levels.push_back( Level{ width, height, width, {} } );
+		}
+
+		for ( auto & level : m_levels )
+		{
+			level.depths.resize( level.stride * level.height, NoOccluder );
+		}
+	}
+
+	void OcclusionBuffer::clear()
+	{
+		for ( auto & level : m_levels )
+		{
+			std::fill( level.depths.begin(), level.depths.end(), NoOccluder );
+		}
+	}
+
+	uint32_t OcclusionBuffer::rasterise( ArrayView< Point3f const > positions
+		, ArrayView< uint32_t const > indices
+		, Matrix4x4f const & transform )
+	{
+		auto width = float( getWidth() );
+		auto height = float( getHeight() );
+		uint32_t result = 0u;
+
+		for ( size_t i = 0u; i + 2u < indices.size(); i += 3u )
+		{
+			CU_Require( indices[i] < positions.size()
+				&& indices[i + 1u] < positions.size()
+				&& indices[i + 2u] < positions.size() );
+			Point3f a;
+			Point3f b;
+			Point3f c;
+
+			if ( project( transform, positions[indices[i]], width, height, a )
+				&& project( transform, positions[indices[i + 1u]], width, height, b )
+				&& project( transform, positions[indices[i + 2u]], width, height, c ) )
+			{
+				doRasteriseTriangle( a, b, c );
+				++result;
+			}
+		}
+
+		return result;
+	}
+
+	void OcclusionBuffer::buildHierarchy()
+	{
+		for ( size_t i = 1u; i < m_levels.size(); ++i )
+		{
+			auto & src = m_levels[i - 1u];
+			auto & dst = m_levels[i];
+
+			for ( uint32_t y = 0u; y < dst.height; ++y )
+			{
+				auto row0 = src.depths.data() + ( 2u * y ) * src.stride;
+				auto row1 = src.depths.data() + std::min( 2u * y + 1u, src.height - 1u ) * src.stride;
+
+				for ( uint32_t x = 0u; x < dst.width; ++x )
+				{
+					auto x0 = 2u * x;
+					auto x1 = std::min( 2u * x + 1u, src.width - 1u );
+					dst.depths[y * dst.stride + x] = std::max( std::max( row0[x0], row0[x1] )
+						, std::max( row1[x0], row1[x1] ) );
+				}
+			}
+		}
+	}
+
+	bool OcclusionBuffer::isVisible( BoundingBox const & box
+		, Matrix4x4f const & transform )const
+	{
+		auto width = float( getWidth() );
+		auto height = float( getHeight() );
+		auto min = box.getMin();
+		auto max = box.getMax();
+		float minX = NoOccluder;
+		float minY = NoOccluder;
+		float maxX = -NoOccluder;
+		float maxY = -NoOccluder;
+		float minDepth = NoOccluder;
+
+		for ( uint32_t i = 0u; i < 8u; ++i )
+		{
+			Point3f corner{ ( i & 1u ) ? max[0] : min[0]
+				, ( i & 2u ) ? max[1] : min[1]
+				, ( i & 4u ) ? max[2] : min[2] };
+			Point3f screen;
+
+			if ( !project( transform, corner, width, height, screen ) )
+			{
+				return true;
+			}
+
+			minX = std::min( minX, screen[0] );
+			minY = std::min( minY, screen[1] );
+			maxX = std::max( maxX, screen[0] );
+			maxY = std::max( maxY, screen[1] );
+			minDepth = std::min( minDepth, screen[2] );
+		}
+
+		if ( maxX < 0.0f || maxY < 0.0f || minX > width || minY > height )
+		{
+			// Outside of the screen, this is the frustum culling's matter.
+			return true;
+		}
+
+		auto clampX = [this]( float value )
+		{
+			return uint32_t( std::clamp( int32_t( std::floor( value ) ), 0, int32_t( getWidth() ) - 1 ) );
+		};
+		auto clampY = [this]( float value )
+		{
+			return uint32_t( std::clamp( int32_t( std::floor( value ) ), 0, int32_t( getHeight() ) - 1 ) );
+		};
+		auto x0 = clampX( minX );
+		auto x1 = clampX( maxX );
+		auto y0 = clampY( minY );
+		auto y1 = clampY( maxY );
+		size_t levelIndex = 0u;
+
+		while ( levelIndex + 1u < m_levels.size()
+			&& ( x1 - x0 > 1u || y1 - y0 > 1u ) )
+		{
+			x0 >>= 1u;
+			x1 >>= 1u;
+			y0 >>= 1u;
+			y1 >>= 1u;
+			++levelIndex;
+		}
+
+		auto & level = m_levels[levelIndex];
+		float farthest = 0.0f;
+
+		for ( auto y = y0; y <= y1; ++y )
+		{
+			for ( auto x = x0; x <= x1; ++x )
+			{
+				farthest = std::max( farthest, level.depths[y * level.stride + x] );
+			}
+		}
+
+		return minDepth <= farthest;
+	}
+
+	void OcclusionBuffer::doRasteriseTriangle( Point3f const & a
+		, Point3f const & b
+		, Point3f const & c )
+	{
+		auto area = ( b[0] - a[0] ) * ( c[1] - a[1] ) - ( b[1] - a[1] ) * ( c[0] - a[0] );
+
+		if ( std::abs( area ) < MinArea )
+		{
+			return;
+		}
+
+		auto & level = m_levels.front();
+		auto minX = std::max( 0, int32_t( std::floor( std::min( { a[0], b[0], c[0] } ) ) ) );
+		auto minY = std::max( 0, int32_t( std::floor( std::min( { a[1], b[1], c[1] } ) ) ) );
+		auto maxX = std::min( int32_t( level.width ) - 1, int32_t( std::ceil( std::max( { a[0], b[0], c[0] } ) ) ) );
+		auto maxY = std::min( int32_t( level.height ) - 1, int32_t( std::ceil( std::max( { a[1], b[1], c[1] } ) ) ) );
+
+		if ( minX > maxX || minY > maxY )
+		{
+			return;
+		}
+
+		// Both windings are rasterised, the edges are oriented to be positive inside the triangle.
+		// Each edge function is the barycentric weight of the opposite vertex, scaled by the area.
+		auto sign = area > 0.0f ? 1.0f : -1.0f;
+		Edge edgeA{ b, c, sign };
+		Edge edgeB{ c, a, sign };
+		Edge edgeC{ a, b, sign };
+		alignas( 16 ) static float const laneOffsets[4]{ 0.5f, 1.5f, 2.5f, 3.5f };
+		Float4 const offsets{ laneOffsets };
+		Float4 const zero{ 0.0f };
+		Float4 const edgeAX{ edgeA.a };
+		Float4 const edgeBX{ edgeB.a };
+		Float4 const edgeCX{ edgeC.a };
+		Float4 const depthA{ a[2] / std::abs( area ) };
+		Float4 const depthB{ b[2] / std::abs( area ) };
+		Float4 const depthC{ c[2] / std::abs( area ) };
+		alignas( 16 ) float depths[4];
+		auto startX = minX & ~3;
+
+		for ( auto y = minY; y <= maxY; ++y )
+		{
+			auto py = float( y ) + 0.5f;
+			Float4 const rowA{ edgeA.b * py + edgeA.c };
+			Float4 const rowB{ edgeB.b * py + edgeB.c };
+			Float4 const rowC{ edgeC.b * py + edgeC.c };
+			auto row = level.depths.data() + uint32_t( y ) * level.stride;
+
+			for ( auto x = startX; x <= maxX; x += 4 )
+			{
+				auto px = Float4{ float( x ) } + offsets;
+				auto weightA = edgeAX * px + rowA;
+				auto weightB = edgeBX * px + rowB;
+				auto weightC = edgeCX * px + rowC;
+				auto outside = ( lessThan( weightA, zero )
+					| lessThan( weightB, zero )
+					| lessThan( weightC, zero ) ).getMask();
+
+				if ( outside == 0x0Fu )
+				{
+					continue;
+				}
+
+				auto depth = weightA * depthA + weightB * depthB + weightC * depthC;
+				depth.toPtr( depths );
+
+				for ( int32_t lane = 0; lane < 4; ++lane )
+				{
+					auto pixel = x + lane;
+
+					if ( !( outside & ( 1u << lane ) )
+						&& pixel >= minX
+						&& pixel <= maxX )
+					{
+						row[pixel] = std::min( row[pixel], depths[lane] );
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,348 @@
+#include "CastorUtils/Math/TransformHierarchy.hpp"
+
+#include "CastorUtils/Exception/Assertion.hpp"
+#include "CastorUtils/Math/Simd.hpp"
+#include "CastorUtils/Math/TransformationMatrix.hpp"
+
+#include <algorithm>
+
+namespace castor
+{
+	void TransformHierarchy::clear()
+	{
+		m_count = 0u;
+		m_parents.clear();
+		m_firstChildren.clear();
+		m_nextSiblings.clear();
+		m_previousSiblings.clear();
+		m_depths.clear();
+		m_positions.clear();
+		m_orientations.clear();
+		m_scales.clear();
+		m_localMatrices.clear();
+		m_worldMatrices.clear();
+		m_worldOrientations.clear();
+		m_worldScales.clear();
+		m_data.clear();
+		m_alive.clear();
+		m_localDirty.clear();
+		m_worldChanged.clear();
+		m_free.clear();
+		m_dirty.clear();
+		m_levels.clear();
+		m_changed.clear();
+	}
+
+	uint32_t TransformHierarchy::add( void * data )
+	{
+		uint32_t result;
+
+		if ( m_free.empty() )
+		{
+			result = uint32_t( m_parents.size() );
+			m_parents.emplace_back();
+			m_firstChildren.emplace_back();
+			m_nextSiblings.emplace_back();
+			m_previousSiblings.emplace_back();
+			m_depths.emplace_back();
+			m_positions.emplace_back();
+			m_orientations.emplace_back();
+			m_scales.emplace_back();
+			m_localMatrices.emplace_back();
+			m_worldMatrices.emplace_back();
+			m_worldOrientations.emplace_back();
+			m_worldScales.emplace_back();
+			m_data.emplace_back();
+			m_alive.emplace_back();
+			m_localDirty.emplace_back();
+			m_worldChanged.emplace_back();
+		}
+		else
+		{
+			result = m_free.back();
+			m_free.pop_back();
+		}
+
+		m_parents[result] = InvalidIndex;
+		m_firstChildren[result] = InvalidIndex;
+		m_nextSiblings[result] = InvalidIndex;
+		m_previousSiblings[result] = InvalidIndex;
+		m_depths[result] = 0u;
+		m_positions[result] = Point3f{ 0.0f, 0.0f, 0.0f };
+		m_orientations[result] = Quaternion::identity();
+		m_scales[result] = Point3f{ 1.0f, 1.0f, 1.0f };
+		m_localMatrices[result] = Matrix4x4f{ 1.0f };
+		m_worldMatrices[result] = Matrix4x4f{ 1.0f };
+		m_worldOrientations[result] = Quaternion::identity();
+		m_worldScales[result] = Point3f{ 1.0f, 1.0f, 1.0f };
+		m_data[result] = data;
+		m_alive[result] = 1u;
+		m_localDirty[result] = 0u;
+		m_worldChanged[result] = 0u;
+		doMarkDirty( result );
+		++m_count;
+		return result;
+	}
+
+	void TransformHierarchy::remove( uint32_t index )
+	{
+		CU_Require( index < m_alive.size() && m_alive[index] );
+
+		while ( m_firstChildren[index] != InvalidIndex )
+		{
+			auto child = m_firstChildren[index];
+			doUnlink( child );
+			doUpdateDepths( child, 0u );
+			doMarkDirty( child );
+		}
+
+		doUnlink( index );
+		m_data[index] = nullptr;
+		m_alive[index] = 0u;
+		// Its pending entry, if any, is skipped by the next update.
+		m_localDirty[index] = 0u;
+		m_worldChanged[index] = 0u;
+		m_free.push_back( index );
+		--m_count;
+		auto it = std::find( m_changed.begin(), m_changed.end(), index );
+
+		if ( it != m_changed.end() )
+		{
+			m_changed.erase( it );
+		}
+	}
+
+	void TransformHierarchy::setParent( uint32_t index
+		, uint32_t parent )
+	{
+		CU_Require( index < m_alive.size() && m_alive[index] );
+		CU_Require( parent == InvalidIndex || ( parent < m_alive.size() && m_alive[parent] ) );
+
+		if ( m_parents[index] == parent )
+		{
+			return;
+		}
+
+		// A transform can't become its own ancestor.
+		for ( auto ancestor = parent; ancestor != InvalidIndex; ancestor = m_parents[ancestor] )
+		{
+			CU_Require( ancestor != index );
+		}
+
+		doUnlink( index );
+
+		if ( parent != InvalidIndex )
+		{
+			auto next = m_firstChildren[parent];
+			m_parents[index] = parent;
+			m_nextSiblings[index] = next;
+
+			if ( next != InvalidIndex )
+			{
+				m_previousSiblings[next] = index;
+			}
+
+			m_firstChildren[parent] = index;
+		}
+
+		doUpdateDepths( index
+			, parent == InvalidIndex ? 0u : m_depths[parent] + 1u );
+		doMarkDirty( index );
+	}
+
+	void TransformHierarchy::setLocal( uint32_t index
+		, Point3f const & position
+		, Quaternion const & orientation
+		, Point3f const & scale )
+	{
+		CU_Require( index < m_alive.size() && m_alive[index] );
+		m_positions[index] = position;
+		m_orientations[index] = orientation;
+		m_scales[index] = scale;
+		doMarkDirty( index );
+	}
+
+	void TransformHierarchy::update()
+	{
+		for ( auto index : m_changed )
+		{
+			m_worldChanged[index] = 0u;
+		}
+
+		m_changed.clear();
+
+		if ( m_dirty.empty() )
+		{
+			return;
+		}
+
+		for ( auto index : m_dirty )
+		{
+			if ( m_alive[index] && m_localDirty[index] )
+			{
+				doGetLevel( m_depths[index] ).push_back( index );
+			}
+		}
+
+		m_dirty.clear();
+
+		// Parents are processed before their children, which are queued in the next level once their parent changed.
+		for ( uint32_t depth = 0u; depth < m_levels.size(); ++depth )
+		{
+			if ( m_levels[depth].empty() )
+			{
+				continue;
+			}
+
+			auto & children = doGetLevel( depth + 1u );
+			auto & level = m_levels[depth];
+
+			for ( auto index : level )
+			{
+				if ( m_worldChanged[index] )
+				{
+					continue;
+				}
+
+				if ( m_localDirty[index] )
+				{
+					matrix::setTransform( m_localMatrices[index]
+						, m_positions[index]
+						, m_scales[index]
+						, m_orientations[index] );
+					m_localDirty[index] = 0u;
+				}
+
+				auto parent = m_parents[index];
+
+				if ( parent == InvalidIndex )
+				{
+					m_worldMatrices[index] = m_localMatrices[index];
+					m_worldOrientations[index] = m_orientations[index];
+					m_worldScales[index] = m_scales[index];
+				}
+				else
+				{
+					multiply( m_worldMatrices[parent]
+						, m_localMatrices[index]
+						, m_worldMatrices[index] );
+					m_worldOrientations[index] = m_orientations[index] * m_worldOrientations[parent];
+					auto & scale = m_scales[index];
+					auto & parentScale = m_worldScales[parent];
+					m_worldScales[index] = Point3f{ scale[0] * parentScale[0]
+						, scale[1] * parentScale[1]
+						, scale[2] * parentScale[2] };
+				}
+
+				m_worldChanged[index] = 1u;
+				m_changed.push_back( index );
+
+				for ( auto child = m_firstChildren[index]; child != InvalidIndex; child = m_nextSiblings[child] )
+				{
+					children.push_back( child );
+				}
+			}
+
+			level.clear();
+		}
+	}
+
+	void TransformHierarchy::multiply( Matrix4x4f const & lhs
+		, Matrix4x4f const & rhs
+		, Matrix4x4f & result )
+	{
+		CU_Require( &lhs != &result );
+		// Column major matrices: each result column is the lhs columns weighted by the rhs column's values.
+		auto l = lhs.constPtr();
+		auto col0 = Float4::loadUnaligned( l + 0u );
+		auto col1 = Float4::loadUnaligned( l + 4u );
+		auto col2 = Float4::loadUnaligned( l + 8u );
+		auto col3 = Float4::loadUnaligned( l + 12u );
+		auto r = rhs.constPtr();
+		auto out = result.ptr();
+
+		for ( uint32_t i = 0u; i < 16u; i += 4u )
+		{
+			auto column = col0 * Float4{ r[i + 0u] }
+				+ col1 * Float4{ r[i + 1u] }
+				+ col2 * Float4{ r[i + 2u] }
+				+ col3 * Float4{ r[i + 3u] };
+			column.storeUnaligned( out + i );
+		}
+	}
+
+	void TransformHierarchy::doMarkDirty( uint32_t index )
+	{
+		if ( !m_localDirty[index] )
+		{
+			m_localDirty[index] = 1u;
+			m_dirty.push_back( index );
+		}
+	}
+
+	void TransformHierarchy::doUnlink( uint32_t index )
+	{
+		auto parent = m_parents[index];
+
+		if ( parent == InvalidIndex )
+		{
+			return;
+		}
+
+		auto previous = m_previousSiblings[index];
+		auto next = m_nextSiblings[index];
+
+		if ( previous == InvalidIndex )
+		{
+			m_firstChildren[parent] = next;
+		}
+		else
+		{
+			m_nextSiblings[previous] = next;
+		}
+
+		if ( next != InvalidIndex )
+		{
+			m_previousSiblings[next] = previous;
+		}
+
+		m_parents[index] = InvalidIndex;
+		m_nextSiblings[index] = InvalidIndex;
+		m_previousSiblings[index] = InvalidIndex;
+	}
+
+	void TransformHierarchy::doUpdateDepths( uint32_t index
+		, uint32_t depth )
+	{
+		if ( m_depths[index] == depth )
+		{
+			return;
+		}
+
+		// Only the moved subtree is visited.
+		m_depths[index] = depth;
+		std::vector< uint32_t > stack{ index };
+
+		while ( !stack.empty() )
+		{
+			auto current = stack.back();
+			stack.pop_back();
+
+			for ( auto child = m_firstChildren[current]; child != InvalidIndex; child = m_nextSiblings[child] )
+			{
+				m_depths[child] = m_depths[current] + 1u;
+				stack.push_back( child );
+			}
+		}
+	}
+
+	std::vector< uint32_t > & TransformHierarchy::doGetLevel( uint32_t depth )
+	{
+		if ( m_levels.size() <= depth )
+		{
+			m_levels.resize( depth + 1u );
+		}
+
+		return m_levels[depth];
+	}
+}
@@ -1,74 +1,299 @@
 #include "CastorUtils/Multithreading/AsyncJobQueue.hpp"
 
 #include "CastorUtils/Config/MultiThreadConfig.hpp"
+#include "CastorUtils/Exception/Assertion.hpp"
+#include "CastorUtils/Log/Logger.hpp"
 
 namespace castor
 {
-	AsyncJobQueue::AsyncJobQueue( size_t count )
-		: m_ended{ false }
-		, m_pool{ count }
-		, m_worker{ [this](){ doRun(); } }
-	{
-	}
+	//*********************************************************************************************
 
-	AsyncJobQueue::~AsyncJobQueue()noexcept
+	struct AsyncJobQueue::Shared
 	{
-		m_ended = true;
-		m_pool.waitAll( Milliseconds( 0xFFFFFFFFFFFFFFFF ) );
-		m_worker.join();
-	}
+		explicit Shared( size_t capacity )
+			: ended{ false }
+		{
+			for ( auto & queue : queues )
+			{
+				queue = std::make_unique< MpmcQueue< StatePtr > >( capacity );
+			}
+		}
+
+		void run()
+		{
+			while ( !ended )
+			{
+				if ( !runOne() )
+				{
+					auto lock( makeUniqueLock( mutex ) );
+					wakeup.wait( lock, [this]()
+						{
+							return ended
+								|| queued.load( std::memory_order_acquire ) > 0;
+						} );
+				}
+			}
+		}
+
+		void waitAll()
+		{
+			while ( unfinished.load( std::memory_order_acquire ) > 0u )
+			{
+				if ( !runOne() )
+				{
+					auto lock( makeUniqueLock( mutex ) );
+					wakeup.wait( lock, [this]()
+						{
+							return unfinished.load( std::memory_order_acquire ) == 0u
+								|| queued.load( std::memory_order_acquire ) > 0;
+						} );
+				}
+			}
+		}
+
+		void push( StatePtr state
+			, JobPriority priority )
+		{
+			// Once the queue is destroyed, nothing would run the job anymore.
+			if ( ended )
+			{
+				cancel( state );
+				return;
+			}
+
+			unfinished.fetch_add( 1u, std::memory_order_relaxed );
+			auto & queue = *queues[size_t( priority )];
+
+			while ( !queue.tryPush( state ) )
+			{
+				// The queue is full, help emptying it.
+				if ( !runOne() )
+				{
+					std::this_thread::yield();
+				}
+			}
+
+			queued.fetch_add( 1, std::memory_order_release );
+			{
+				auto lock( makeUniqueLock( mutex ) );
+			}
+			wakeup.notify_one();
+		}
+
+		bool popJob( StatePtr & result )
+		{
+			for ( auto & queue : queues )
+			{
+				if ( queue->tryPop( result ) )
+				{
+					queued.fetch_sub( 1, std::memory_order_relaxed );
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		bool runOne()
+		{
+			StatePtr state;
+			bool result = popJob( state );
+
+			if ( result )
+			{
+				runJob( state );
+			}
+
+			return result;
+		}
+
+		void runJob( StatePtr const & state )
+		{
+			auto expected = Status::ePending;
+
+			// Cancelled jobs stay in the queue until popped, and are simply skipped.
+			if ( state->status.compare_exchange_strong( expected, Status::eRunning ) )
+			{
+				// The state is finished whatever the job outcome, else its waiters would hang.
+				try
+				{
+					state->job();
+				}
+				catch ( std::exception & exc )
+				{
+					Logger::logError( std::string{ "AsyncJobQueue: Job failed: " } + exc.what() );
+				}
+				catch ( ... )
+				{
+					Logger::logError( "AsyncJobQueue: Job failed with an unknown exception." );
+				}
+
+				finish( *state, Status::eDone );
+			}
+
+			if ( unfinished.fetch_sub( 1u, std::memory_order_acq_rel ) == 1u )
+			{
+				notify();
+			}
+		}
+
+		bool cancel( StatePtr const & state )
+		{
+			auto expected = Status::ePending;
+
+			if ( !state->status.compare_exchange_strong( expected, Status::eCancelled ) )
+			{
+				return false;
+			}
+
+			finish( *state, Status::eCancelled );
+			return true;
+		}
+
+		void finish( State & state
+			, Status status )
+		{
+			std::vector< Continuation > continuations;
+			{
+				auto lock( makeUniqueLock( state.mutex ) );
+				state.status = status;
+				std::swap( continuations, state.continuations );
+			}
+			state.finished.notify_all();
+			state.job = nullptr;
+
+			for ( auto & continuation : continuations )
+			{
+				if ( status == Status::eDone )
+				{
+					push( continuation.state, continuation.priority );
+				}
+				else
+				{
+					cancel( continuation.state );
+				}
+			}
+		}
+
+		void notify()
+		{
+			{
+				auto lock( makeUniqueLock( mutex ) );
+			}
+			wakeup.notify_all();
+		}
+
+		std::atomic_bool ended;
+		std::array< std::unique_ptr< MpmcQueue< StatePtr > >, size_t( JobPriority::eCount ) > queues;
+		std::atomic< int32_t > queued{ 0 };
+		std::atomic< uint32_t > unfinished{ 0u };
+		std::mutex mutex;
+		std::condition_variable wakeup;
+	};
+
+	//*********************************************************************************************
 
-	void AsyncJobQueue::pushJob( Job job )
+	bool AsyncJobQueue::Handle::cancel()
 	{
-		auto lock( makeUniqueLock( m_mutex ) );
-		m_pending.push_back( job );
+		return m_state
+			&& m_state->queue->cancel( m_state );
 	}
 
-	void AsyncJobQueue::waitAll()
+	void AsyncJobQueue::Handle::wait()const
 	{
-		while ( !doCheckEnded() )
+		if ( m_state )
 		{
-			std::this_thread::sleep_for( 5_ms );
+			auto lock( makeUniqueLock( m_state->mutex ) );
+			m_state->finished.wait( lock, [this]()
+				{
+					auto status = m_state->status.load();
+					return status == Status::eDone
+						|| status == Status::eCancelled;
+				} );
 		}
-
-		m_pool.waitAll( Milliseconds{ Milliseconds::max() } );
 	}
 
-	void AsyncJobQueue::doRun()
+	AsyncJobQueue::Handle AsyncJobQueue::Handle::then( Job job
+		, JobPriority priority )
 	{
-		while ( !m_ended )
+		CU_Require( m_state );
+		auto & queue = *m_state->queue;
+		auto result = std::make_shared< State >( m_state->queue, std::move( job ) );
+		Status status;
 		{
-			while ( !m_ended && doCheckEnded() )
+			auto lock( makeUniqueLock( m_state->mutex ) );
+			status = m_state->status;
+
+			if ( status == Status::ePending
+				|| status == Status::eRunning )
 			{
-				std::this_thread::sleep_for( 5_ms );
+				m_state->continuations.push_back( { result, priority } );
 			}
+		}
 
-			m_pool.pushJob( doPopJob() );
+		if ( status == Status::eDone )
+		{
+			queue.push( result, priority );
+		}
+		else if ( status == Status::eCancelled )
+		{
+			queue.cancel( result );
 		}
+
+		return Handle{ result };
 	}
 
-	AsyncJobQueue::Job AsyncJobQueue::doPopJob()
+	//*********************************************************************************************
+
+	AsyncJobQueue::AsyncJobQueue( size_t count
+		, size_t capacity )
+		: m_shared{ std::make_shared< Shared >( capacity ) }
 	{
-		auto lock( makeUniqueLock( m_mutex ) );
+		count = std::max( size_t{ 1u }, count );
+		m_workers.reserve( count );
 
-		if ( !m_pending.empty() )
+		for ( size_t i = 0u; i < count; ++i )
 		{
-			auto job = m_pending.front();
-			m_pending.erase( m_pending.begin() );
-			return job;
+			m_workers.emplace_back( [this]()
+				{
+					m_shared->run();
+				} );
 		}
+	}
 
-		// Should never happen, but let's do this just in case.
-		static Job dummy = []()
+	AsyncJobQueue::~AsyncJobQueue()noexcept
+	{
 		{
-			std::this_thread::sleep_for( 5_ms );
-		};
-		return dummy;
+			auto lock( makeUniqueLock( m_shared->mutex ) );
+			m_shared->ended = true;
+		}
+		m_shared->wakeup.notify_all();
+
+		for ( auto & worker : m_workers )
+		{
+			worker.join();
+		}
+
+		StatePtr state;
+
+		while ( m_shared->popJob( state ) )
+		{
+			m_shared->cancel( state );
+		}
+	}
+
+	AsyncJobQueue::Handle AsyncJobQueue::pushJob( Job job
+		, JobPriority priority )
+	{
+		auto state = std::make_shared< State >( m_shared, std::move( job ) );
+		m_shared->push( state, priority );
+		return Handle{ state };
 	}
 
-	bool AsyncJobQueue::doCheckEnded()
+	void AsyncJobQueue::waitAll()
 	{
-		auto lock( makeUniqueLock( m_mutex ) );
-		return m_pending.empty();
+		m_shared->waitAll();
 	}
+
+	//*********************************************************************************************
 }
@@ -0,0 +1,221 @@
+#include "CastorUtils/Multithreading/JobScheduler.hpp"
+
+#include "CastorUtils/Config/MultiThreadConfig.hpp"
+#include "CastorUtils/Log/Logger.hpp"
+
+namespace castor
+{
+	namespace
+	{
+		// Identifies the scheduler owning the current thread, if any, and the thread's queue index.
+		thread_local JobScheduler const * tlsScheduler = nullptr;
+		thread_local size_t tlsWorker = 0u;
+	}
+
+	//*********************************************************************************************
+
+	JobScheduler::JobScheduler( size_t count )
+	{
+		count = std::max( size_t{ 1u }, count );
+		m_workers.reserve( count );
+
+		for ( size_t i = 0u; i < count; ++i )
+		{
+			m_workers.push_back( std::make_unique< Worker >() );
+		}
+
+		for ( size_t i = 0u; i < count; ++i )
+		{
+			m_workers[i]->thread = std::thread{ [this, i]()
+				{
+					doRun( i );
+				} };
+		}
+	}
+
+	JobScheduler::~JobScheduler()noexcept
+	{
+		waitAll();
+		{
+			auto lock( makeUniqueLock( m_sleepMutex ) );
+			m_terminate = true;
+		}
+		m_wakeup.notify_all();
+
+		for ( auto & worker : m_workers )
+		{
+			worker->thread.join();
+		}
+	}
+
+	void JobScheduler::pushJob( Job job
+		, JobCounter * counter )
+	{
+		if ( counter )
+		{
+			counter->doAdd();
+		}
+
+		m_unfinished.fetch_add( 1u, std::memory_order_relaxed );
+		size_t index = tlsScheduler == this
+			? tlsWorker
+			: size_t( m_submitIndex.fetch_add( 1u, std::memory_order_relaxed ) % m_workers.size() );
+		auto & worker = *m_workers[index];
+		{
+			// Counted under the worker's lock, so a thief can't pop the job before it is counted.
+			auto lock( makeUniqueLock( worker.mutex ) );
+			worker.jobs.push_back( { std::move( job ), counter } );
+			m_queued.fetch_add( 1u, std::memory_order_release );
+		}
+		{
+			// Taking the lock guarantees that a worker about to sleep sees the new job.
+			auto lock( makeUniqueLock( m_sleepMutex ) );
+		}
+		m_wakeup.notify_one();
+	}
+
+	template< typename PredicateT >
+	void JobScheduler::doHelpUntil( PredicateT predicate )
+	{
+		while ( !predicate() )
+		{
+			if ( !doRunOne() )
+			{
+				auto lock( makeUniqueLock( m_sleepMutex ) );
+				m_wakeup.wait( lock, [this, &predicate]()
+					{
+						return predicate()
+							|| m_queued.load( std::memory_order_acquire ) > 0u;
+					} );
+			}
+		}
+	}
+
+	void JobScheduler::wait( JobCounter const & counter )
+	{
+		doHelpUntil( [&counter]()
+			{
+				return counter.isDone();
+			} );
+	}
+
+	void JobScheduler::waitAll()
+	{
+		doHelpUntil( [this]()
+			{
+				return isIdle();
+			} );
+	}
+
+	void JobScheduler::doRun( size_t index )
+	{
+		tlsScheduler = this;
+		tlsWorker = index;
+
+		while ( !m_terminate )
+		{
+			Entry entry;
+
+			if ( doPopJob( index, entry )
+				|| doStealJob( index, entry ) )
+			{
+				doRunJob( entry );
+			}
+			else
+			{
+				auto lock( makeUniqueLock( m_sleepMutex ) );
+				m_wakeup.wait( lock, [this]()
+					{
+						return m_terminate
+							|| m_queued.load( std::memory_order_acquire ) > 0u;
+					} );
+			}
+		}
+	}
+
+	bool JobScheduler::doPopJob( size_t index
+		, Entry & result )
+	{
+		auto & worker = *m_workers[index];
+		auto lock( makeUniqueLock( worker.mutex ) );
+
+		if ( worker.jobs.empty() )
+		{
+			return false;
+		}
+
+		// The owner works LIFO, to keep its most recent data hot.
+		result = std::move( worker.jobs.back() );
+		worker.jobs.pop_back();
+		m_queued.fetch_sub( 1u, std::memory_order_relaxed );
+		return true;
+	}
+
+	bool JobScheduler::doStealJob( size_t thief
+		, Entry & result )
+	{
+		auto count = m_workers.size();
+
+		for ( size_t i = 1u; i <= count; ++i )
+		{
+			auto & victim = *m_workers[( thief + i ) % count];
+			auto lock( makeUniqueLock( victim.mutex ) );
+
+			if ( !victim.jobs.empty() )
+			{
+				// Thieves work FIFO, taking the oldest (and usually biggest) jobs.
+				result = std::move( victim.jobs.front() );
+				victim.jobs.pop_front();
+				m_queued.fetch_sub( 1u, std::memory_order_relaxed );
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void JobScheduler::doRunJob( Entry & entry )
+	{
+		// A throwing job must neither kill its worker, nor leave its counter pending forever.
+		try
+		{
+			entry.job();
+		}
+		catch ( std::exception & exc )
+		{
+			Logger::logError( std::string{ "JobScheduler: Job failed: " } + exc.what() );
+		}
+		catch ( ... )
+		{
+			Logger::logError( "JobScheduler: Job failed with an unknown exception." );
+		}
+
+		bool notify = entry.counter
+			&& entry.counter->doRelease();
+		notify = ( m_unfinished.fetch_sub( 1u, std::memory_order_acq_rel ) == 1u )
+			|| notify;
+
+		if ( notify )
+		{
+			{
+				auto lock( makeUniqueLock( m_sleepMutex ) );
+			}
+			m_wakeup.notify_all();
+		}
+	}
+
+	bool JobScheduler::doRunOne()
+	{
+		Entry entry;
+		bool result = tlsScheduler == this
+			? ( doPopJob( tlsWorker, entry ) || doStealJob( tlsWorker, entry ) )
+			: doStealJob( m_submitIndex.load( std::memory_order_relaxed ) % m_workers.size(), entry );
+
+		if ( result )
+		{
+			doRunJob( entry );
+		}
+
+		return result;
+	}
+}
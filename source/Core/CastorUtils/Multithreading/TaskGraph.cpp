@@ -0,0 +1,87 @@
+#include "CastorUtils/Multithreading/TaskGraph.hpp"
+
+#include "CastorUtils/Exception/Assertion.hpp"
+
+#include <memory>
+
+namespace castor
+{
+	TaskGraph::TaskId TaskGraph::add( Task task
+		, std::initializer_list< TaskId > dependencies )
+	{
+		return add( std::move( task )
+			, std::vector< TaskId >{ dependencies } );
+	}
+
+	TaskGraph::TaskId TaskGraph::add( Task task
+		, std::vector< TaskId > const & dependencies )
+	{
+		auto result = TaskId( m_nodes.size() );
+
+		for ( auto dependency : dependencies )
+		{
+			CU_Require( dependency < result );
+			m_nodes[dependency].successors.push_back( result );
+		}
+
+		m_nodes.push_back( { std::move( task ), {}, uint32_t( dependencies.size() ) } );
+		return result;
+	}
+
+	void TaskGraph::run( JobScheduler & scheduler )
+	{
+		if ( m_nodes.empty() )
+		{
+			return;
+		}
+
+		auto remaining = std::make_unique< std::atomic< uint32_t >[] >( m_nodes.size() );
+		JobCounter counter;
+
+		for ( size_t i = 0u; i < m_nodes.size(); ++i )
+		{
+			remaining[i].store( m_nodes[i].dependencies, std::memory_order_relaxed );
+		}
+
+		for ( size_t i = 0u; i < m_nodes.size(); ++i )
+		{
+			if ( !m_nodes[i].dependencies )
+			{
+				doPush( scheduler, counter, remaining.get(), TaskId( i ) );
+			}
+		}
+
+		scheduler.wait( counter );
+	}
+
+	void TaskGraph::runSerial()
+	{
+		// Dependencies always precede their successors, so insertion order is a valid order.
+		for ( auto & node : m_nodes )
+		{
+			node.task();
+		}
+	}
+
+	void TaskGraph::doPush( JobScheduler & scheduler
+		, JobCounter & counter
+		, std::atomic< uint32_t > * remaining
+		, TaskId id )
+	{
+		scheduler.pushJob( [this, &scheduler, &counter, remaining, id]()
+			{
+				auto & node = m_nodes[id];
+				node.task();
+
+				// Successors are pushed before this job is released, so the counter can't reach 0 too early.
+				for ( auto successor : node.successors )
+				{
+					if ( remaining[successor].fetch_sub( 1u, std::memory_order_acq_rel ) == 1u )
+					{
+						doPush( scheduler, counter, remaining, successor );
+					}
+				}
+			}
+			, &counter );
+	}
+}
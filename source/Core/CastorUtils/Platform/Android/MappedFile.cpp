@@ -0,0 +1,57 @@
+#include "CastorUtils/Config/PlatformConfig.hpp"
+
+#if defined( CU_PlatformAndroid )
+
+#include "CastorUtils/Data/MappedFile.hpp"
+#include "CastorUtils/Log/Logger.hpp"
+#include "CastorUtils/Miscellaneous/StringUtils.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace castor
+{
+	MappedFile::MappedFile( Path const & path )
+	{
+		auto fd = open( string::stringCast< char >( path ).c_str(), O_RDONLY );
+
+		if ( fd == -1 )
+		{
+			Logger::logWarning( cuT( "Can't open file [" ) + path + cuT( "] for mapping." ) );
+			return;
+		}
+
+		struct stat status{};
+
+		if ( fstat( fd, &status ) == 0
+			&& status.st_size > 0 )
+		{
+			auto data = mmap( nullptr, size_t( status.st_size ), PROT_READ, MAP_PRIVATE, fd, 0 );
+
+			if ( data != MAP_FAILED )
+			{
+				m_data = static_cast< uint8_t const * >( data );
+				m_size = size_t( status.st_size );
+			}
+			else
+			{
+				Logger::logWarning( cuT( "Can't map file [" ) + path + cuT( "]." ) );
+			}
+		}
+
+		// The mapping keeps its own reference to the file.
+		close( fd );
+	}
+
+	MappedFile::~MappedFile()
+	{
+		if ( m_data )
+		{
+			munmap( const_cast< uint8_t * >( m_data ), m_size );
+		}
+	}
+}
+
+#endif
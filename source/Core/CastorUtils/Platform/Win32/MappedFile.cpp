@@ -0,0 +1,73 @@
+#include "CastorUtils/Config/PlatformConfig.hpp"
+
+#if defined( CU_PlatformWindows )
+
+#include "CastorUtils/Data/MappedFile.hpp"
+#include "CastorUtils/Log/Logger.hpp"
+#include "CastorUtils/Miscellaneous/StringUtils.hpp"
+
+#include <windows.h>
+
+namespace castor
+{
+	MappedFile::MappedFile( Path const & path )
+	{
+		auto file = ::CreateFileA( string::stringCast< char >( path ).c_str()
+			, GENERIC_READ
+			, FILE_SHARE_READ
+			, nullptr
+			, OPEN_EXISTING
+			, FILE_ATTRIBUTE_NORMAL
+			, nullptr );
+
+		if ( file == INVALID_HANDLE_VALUE )
+		{
+			Logger::logWarning( cuT( "Can't open file [" ) + path + cuT( "] for mapping." ) );
+			return;
+		}
+
+		m_file = file;
+		LARGE_INTEGER size{};
+
+		if ( ::GetFileSizeEx( file, &size )
+			&& size.QuadPart > 0 )
+		{
+			auto mapping = ::CreateFileMappingA( file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+
+			if ( mapping )
+			{
+				m_mapping = mapping;
+				m_data = static_cast< uint8_t const * >( ::MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 ) );
+			}
+
+			if ( m_data )
+			{
+				m_size = size_t( size.QuadPart );
+			}
+			else
+			{
+				Logger::logWarning( cuT( "Can't map file [" ) + path + cuT( "]." ) );
+			}
+		}
+	}
+
+	MappedFile::~MappedFile()
+	{
+		if ( m_data )
+		{
+			::UnmapViewOfFile( m_data );
+		}
+
+		if ( m_mapping )
+		{
+			::CloseHandle( m_mapping );
+		}
+
+		if ( m_file )
+		{
+			::CloseHandle( m_file );
+		}
+	}
+}
+
+#endif
@@ -751,8 +751,6 @@ namespace C3dAssimp
 			, std::map< castor::Milliseconds, castor::Point3f > const & scales
 			, std::map< castor::Milliseconds, castor::Quaternion > const & rotates
 			, std::set< castor::Milliseconds > const & times
-			, uint32_t fps
-			, int64_t ticksPerMilliSecond
 			, SkeletonAnimationObject & object
 			, SkeletonAnimation & animation
 			, SkeletonAnimationKeyFrameMap & keyframes )
@@ -760,37 +758,52 @@ namespace C3dAssimp
 			InterpolatorT< castor::Point3f, InterpolatorType::eLinear > pointInterpolator;
 			InterpolatorT< castor::Quaternion, InterpolatorType::eLinear > quatInterpolator;
 
-			if ( ticksPerMilliSecond / 1000 >= fps )
+			// Sample at the source key times only, the animation instance interpolates between them.
+			for ( auto time : times )
 			{
-				for ( auto time : times )
-				{
-					auto translate = doCompute( time, pointInterpolator, translates );
-					auto scale = doCompute( time, pointInterpolator, scales );
-					auto rotate = doCompute( time, quatInterpolator, rotates );
-					doGetKeyFrame( time, animation, keyframes ).addAnimationObject( object
-						, translate
-						, rotate
-						, scale );
-				}
+				auto translate = doCompute( time, pointInterpolator, translates );
+				auto scale = doCompute( time, pointInterpolator, scales );
+				auto rotate = doCompute( time, quatInterpolator, rotates );
+				doGetKeyFrame( time, animation, keyframes ).addAnimationObject( object
+					, translate
+					, rotate
+					, scale );
 			}
-			else
-			{
-				// Limit the key frames per second to 60, to spare RAM...
-				castor::Milliseconds step{ 1000 / std::min< int64_t >( 60, int64_t( fps ) ) };
-				castor::Milliseconds maxTime{ *times.rbegin() + step };
+		}
 
-				for ( auto time = 0_ms; time < maxTime; time += step )
+		template< typename KeyT >
+		void gatherTimes( KeyT const * keys
+			, uint32_t count
+			, int64_t ticksPerMilliSecond
+			, std::set< castor::Milliseconds > & times )
+		{
+			for ( auto & key : castor::makeArrayView( keys, count ) )
+			{
+				if ( key.mTime >= 0.0 )
 				{
-					auto translate = doCompute( time, pointInterpolator, translates );
-					auto scale = doCompute( time, pointInterpolator, scales );
-					auto rotate = doCompute( time, quatInterpolator, rotates );
-					doGetKeyFrame( time, animation, keyframes ).addAnimationObject( object
-						, translate
-						, rotate
-						, scale );
+					auto time = castor::Milliseconds{ int64_t( key.mTime * 1000 ) } / ticksPerMilliSecond;
+					times.insert( time );
 				}
 			}
 		}
+
+		void gatherTimes( aiNodeAnim const & aiNodeAnim
+			, int64_t ticksPerMilliSecond
+			, std::set< castor::Milliseconds > & times )
+		{
+			gatherTimes( aiNodeAnim.mPositionKeys
+				, aiNodeAnim.mNumPositionKeys
+				, ticksPerMilliSecond
+				, times );
+			gatherTimes( aiNodeAnim.mScalingKeys
+				, aiNodeAnim.mNumScalingKeys
+				, ticksPerMilliSecond
+				, times );
+			gatherTimes( aiNodeAnim.mRotationKeys
+				, aiNodeAnim.mNumRotationKeys
+				, ticksPerMilliSecond
+				, times );
+		}
 	}
 
 	//*********************************************************************************************
@@ -1156,9 +1169,18 @@ namespace C3dAssimp
 		int64_t ticksPerMilliSecond = int64_t( aiAnimation.mTicksPerSecond ? aiAnimation.mTicksPerSecond : 25 );
 		SkeletonAnimationKeyFrameMap keyframes;
 		SkeletonAnimationObjectSet notAnimated;
+		// The keys of all the channels, so that each keyframe holds every animated object.
+		std::set< castor::Milliseconds > times;
+
+		for ( auto aiNodeAnim : castor::makeArrayView( aiAnimation.mChannels, aiAnimation.mNumChannels ) )
+		{
+			gatherTimes( *aiNodeAnim, ticksPerMilliSecond, times );
+		}
+
 		doProcessAnimationNodes( mesh
 			, animation
 			, ticksPerMilliSecond
+			, times
 			, skeleton
 			, aiNode
 			, aiAnimation
@@ -1182,12 +1204,16 @@ namespace C3dAssimp
 			animation.addKeyFrame( std::move( keyFrame.second ) );
 		}
 
+		// Drop the keyframes that are reproduced by interpolating their neighbours.
+		auto removed = animation.reduceKeyFrames( 0.0001f, castor::Angle::fromDegrees( 0.1f ) );
+		log::debug << cuT( "    Removed " ) << removed << cuT( " redundant keyframes" ) << std::endl;
 		animation.updateLength();
 	}
 
 	void AssimpImporter::doProcessAnimationNodes( Mesh & mesh
 		, SkeletonAnimation & animation
 		, int64_t ticksPerMilliSecond
+		, std::set< castor::Milliseconds > const & times
 		, Skeleton & skeleton
 		, aiNode const & aiNode
 		, aiAnimation const & aiAnimation
@@ -1284,6 +1310,7 @@ namespace C3dAssimp
 		{
 			doProcessAnimationNodeKeys( *aiNodeAnim
 				, ticksPerMilliSecond
+				, times
 				, *object
 				, animation
 				, keyFrames );
@@ -1298,6 +1325,7 @@ namespace C3dAssimp
 			doProcessAnimationNodes( mesh
 				, animation
 				, ticksPerMilliSecond
+				, times
 				, skeleton
 				, *node
 				, aiAnimation
@@ -1307,41 +1335,15 @@ namespace C3dAssimp
 		}
 	}
 
-	template< typename KeyT >
-	void gatherTimes( KeyT const * keys
-		, uint32_t count
-		, int64_t ticksPerMilliSecond
-		, std::set< castor::Milliseconds > & times )
-	{
-		for ( auto & key : castor::makeArrayView( keys, count ) )
-		{
-			if ( key.mTime >= 0.0 )
-			{
-				auto time = castor::Milliseconds{ int64_t( key.mTime * 1000 ) } / ticksPerMilliSecond;
-				times.insert( time );
-			}
-		}
-	}
-
 	void AssimpImporter::doProcessAnimationNodeKeys( aiNodeAnim const & aiNodeAnim
 		, int64_t ticksPerMilliSecond
+		, std::set< castor::Milliseconds > const & animationTimes
 		, SkeletonAnimationObject & object
 		, SkeletonAnimation & animation
 		, SkeletonAnimationKeyFrameMap & keyframes )
 	{
 		std::set< castor::Milliseconds > times;
-		gatherTimes( aiNodeAnim.mPositionKeys
-			, aiNodeAnim.mNumPositionKeys
-			, ticksPerMilliSecond
-			, times );
-		gatherTimes( aiNodeAnim.mScalingKeys
-			, aiNodeAnim.mNumScalingKeys
-			, ticksPerMilliSecond
-			, times );
-		gatherTimes( aiNodeAnim.mRotationKeys
-			, aiNodeAnim.mNumRotationKeys
-			, ticksPerMilliSecond
-			, times );
+		gatherTimes( aiNodeAnim, ticksPerMilliSecond, times );
 
 		auto translates = doProcessVec3Keys( aiNodeAnim.mPositionKeys
 			, aiNodeAnim.mNumPositionKeys
@@ -1358,9 +1360,7 @@ namespace C3dAssimp
 		doSynchroniseKeys( translates
 			, scales
 			, rotates
-			, times
-			, getEngine()->getRenderLoop().getWantedFps()
-			, ticksPerMilliSecond
+			, animationTimes
 			, object
 			, animation
 			, keyframes );
@@ -86,6 +86,7 @@ namespace C3dAssimp
 		void doProcessAnimationNodes( castor3d::Mesh & p_mesh
 			, castor3d::SkeletonAnimation & p_animation
 			, int64_t p_ticksPerMilliSecond
+			, std::set< castor::Milliseconds > const & p_times
 			, castor3d::Skeleton & p_skeleton
 			, aiNode const & p_aiNode
 			, aiAnimation const & p_aiAnimation
@@ -94,6 +95,7 @@ namespace C3dAssimp
 			, SkeletonAnimationObjectSet & notAnimated );
 		void doProcessAnimationNodeKeys( aiNodeAnim const & aiNodeAnim
 			, int64_t ticksPerMilliSecond
+			, std::set< castor::Milliseconds > const & animationTimes
 			, castor3d::SkeletonAnimationObject & object
 			, castor3d::SkeletonAnimation & animation
 			, SkeletonAnimationKeyFrameMap & keyframes );
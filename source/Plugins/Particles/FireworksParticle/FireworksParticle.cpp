@@ -7,6 +7,8 @@
 #include <Castor3D/Scene/SceneNode.hpp>
 #include <Castor3D/Scene/ParticleSystem/ParticleSystem.hpp>
 
+#include <CastorUtils/Math/Simd.hpp>
+
 #include <ashespp/Buffer/VertexBuffer.hpp>
 
 #include <random>
@@ -55,7 +57,8 @@ namespace fireworks
 				, castor3d::ParticleDeclaration const & inputs
 				, castor3d::ParticleEmitterArray & emitters );
 			void update( castor::Milliseconds const & time
-				, castor3d::Particle & particle );
+				, castor3d::ParticleStreams & particles
+				, uint32_t count )override;
 
 		private:
 			castor3d::ParticleDeclaration::const_iterator m_type;
@@ -94,71 +97,71 @@ namespace fireworks
 			return castor::Point3f{ getRandomFloat(), getRandomFloat(), getRandomFloat() };
 		}
 
-		inline void doUpdateLauncher( ParticleEmitter & emitter
-			, castor::Coords3f & position
-			, float & age )
+		inline void doAdd( float * values
+			, uint32_t count
+			, float value )
 		{
-			if ( age >= g_launcherCooldown.count() )
+			castor::Float4 delta{ value };
+			uint32_t i = 0u;
+
+			for ( ; i + 4u <= count; i += 4u )
 			{
-				castor::Point3f velocity{ doGetRandomDirection() * 5.0f };
-				velocity[1] = std::max( velocity[1] * 7.0f, 10.0f );
-				emitter.emit( castor::Point3f{ position }
-					, velocity
-					, 0.0f );
-				age = 0.0f;
+				( castor::Float4::loadUnaligned( values + i ) + delta ).storeUnaligned( values + i );
 			}
-		}
-
-		inline void doUpdateShell( ParticleEmitter & emitter
-			, castor::Milliseconds const & time
-			, float & type
-			, castor::Coords3f & position
-			, castor::Coords3f & velocity
-			, float & age )
-		{
-			castor::Point3f delta{ time.count() / 1000.0, time.count() / 1000.0, time.count() / 1000.0 };
-			castor::Point3f deltaP = delta * velocity;
-			castor::Point3f deltaV = delta * castor::Point3f{ 0.0f, -0.981f, 0.0f };
 
-			if ( age < g_shellLifetime.count() )
+			for ( ; i < count; ++i )
 			{
-				position += deltaP;
-				velocity += deltaV;
+				values[i] += value;
 			}
-			else
+		}
+
+		inline void doIntegrate( float * positions
+			, float * velocities
+			, uint32_t count
+			, float seconds )
+		{
+			// The xyz triplets realign on SIMD registers every 4 particles, so the gravity pattern spans 3 registers.
+			auto gravity = -0.981f * seconds;
+			float const pattern[12]{ 0.0f, gravity, 0.0f
+				, 0.0f, gravity, 0.0f
+				, 0.0f, gravity, 0.0f
+				, 0.0f, gravity, 0.0f };
+			castor::Float4 const deltaV[3]{ castor::Float4::loadUnaligned( pattern + 0u )
+				, castor::Float4::loadUnaligned( pattern + 4u )
+				, castor::Float4::loadUnaligned( pattern + 8u ) };
+			castor::Float4 const delta{ seconds };
+			auto components = count * 3u;
+			uint32_t i = 0u;
+
+			for ( ; i + 12u <= components; i += 12u )
 			{
-				for ( int i = 1; i < 10; ++i )
+				for ( uint32_t j = 0u; j < 3u; ++j )
 				{
-					emitter.emit( castor::Point3f{ position }
-						, ( doGetRandomDirection() * 5.0f ) + velocity / 2.0f
-						, 0.0f );
+					auto index = i + j * 4u;
+					auto velocity = castor::Float4::loadUnaligned( velocities + index );
+					( castor::Float4::loadUnaligned( positions + index ) + velocity * delta ).storeUnaligned( positions + index );
+					( velocity + deltaV[j] ).storeUnaligned( velocities + index );
 				}
+			}
 
-				// Turn this shell to a secondary shell, to decrease the holes in buffer
-				type = g_secondaryShell;
-				velocity = ( doGetRandomDirection() * 5.0f ) + velocity / 2.0f;
-				age = 0.0f;
+			for ( ; i < components; ++i )
+			{
+				positions[i] += velocities[i] * seconds;
+				velocities[i] += pattern[i % 12u];
 			}
 		}
 
-		inline void doUpdateSecondaryShell( castor::Milliseconds const & time
-			, float & type
-			, castor::Coords3f & position
-			, castor::Coords3f & velocity
-			, float & age )
+		inline castor::Point3f doGetPoint( float const * values )
 		{
-			if ( age < g_secondaryShellLifetime.count() )
-			{
-				castor::Point3f delta{ time.count() / 1000.0, time.count() / 1000.0, time.count() / 1000.0 };
-				castor::Point3f deltaP = delta * velocity;
-				castor::Point3f deltaV = delta * castor::Point3f{ 0.0f, -0.981f, 0.0f };
-				position += deltaP;
-				velocity += deltaV;
-			}
-			else
-			{
-				type = g_launcher;
-			}
+			return castor::Point3f{ values[0], values[1], values[2] };
+		}
+
+		inline void doSetPoint( float * values
+			, castor::Point3f const & value )
+		{
+			values[0] = value[0];
+			values[1] = value[1];
+			values[2] = value[2];
 		}
 
 		//*****************************************************************************************
@@ -237,40 +240,68 @@ namespace fireworks
 		}
 
 		void ParticleUpdater::update( castor::Milliseconds const & time
-			, castor3d::Particle & particle )
+			, castor3d::ParticleStreams & particles
+			, uint32_t count )
 		{
-			castor::Coords3f pos{ reinterpret_cast< float * >( particle.getData() + m_position->m_offset ) };
-			castor::Coords3f vel{ reinterpret_cast< float * >( particle.getData() + m_velocity->m_offset ) };
-			float * age{ reinterpret_cast< float * >( particle.getData() + m_age->m_offset ) };
-			float * type{ reinterpret_cast< float * >( particle.getData() + m_type->m_offset ) };
-			*age += time.count();
-
-			if ( *type == g_launcher )
-			{
-				doUpdateLauncher( static_cast< ParticleEmitter & >( *m_emitters[size_t( g_shell )] )
-					, pos
-					, *age );
-				auto worldPosition = m_system.getParent()->getDerivedPosition();
-				pos[0] = float( worldPosition[0] );
-				pos[1] = float( worldPosition[1] );
-				pos[2] = float( worldPosition[2] );
-			}
-			else if ( *type == g_shell )
+			auto types = particles.getStream< float >( *m_type );
+			auto positions = particles.getStream< float >( *m_position );
+			auto velocities = particles.getStream< float >( *m_velocity );
+			auto ages = particles.getStream< float >( *m_age );
+			auto & shellEmitter = static_cast< ParticleEmitter & >( *m_emitters[size_t( g_shell )] );
+			auto & secondaryShellEmitter = static_cast< ParticleEmitter & >( *m_emitters[size_t( g_secondaryShell )] );
+			auto worldPosition = m_system.getParent()->getDerivedPosition();
+			castor::Point3f launcherPosition{ float( worldPosition[0] ), float( worldPosition[1] ), float( worldPosition[2] ) };
+
+			// Whole streams passes, the launchers positions being reset below.
+			doAdd( ages, count, float( time.count() ) );
+			doIntegrate( positions, velocities, count, float( time.count() ) / 1000.0f );
+
+			// Per particle pass, for the lifetime events only.
+			for ( uint32_t i = 0u; i < count; ++i )
 			{
-				doUpdateShell( static_cast< ParticleEmitter & >( *m_emitters[size_t( g_secondaryShell )] )
-					, time
-					, *type
-					, pos
-					, vel
-					, *age );
-			}
-			else
-			{
-				doUpdateSecondaryShell( time
-					, *type
-					, pos
-					, vel
-					, *age );
+				auto & type = types[i];
+				auto & age = ages[i];
+				auto position = positions + i * 3u;
+				auto velocity = velocities + i * 3u;
+
+				if ( type == g_launcher )
+				{
+					if ( age >= g_launcherCooldown.count() )
+					{
+						castor::Point3f direction{ doGetRandomDirection() * 5.0f };
+						direction[1] = std::max( direction[1] * 7.0f, 10.0f );
+						shellEmitter.emit( doGetPoint( position )
+							, direction
+							, 0.0f );
+						age = 0.0f;
+					}
+
+					doSetPoint( position, launcherPosition );
+				}
+				else if ( type == g_shell )
+				{
+					if ( age >= g_shellLifetime.count() )
+					{
+						auto shellPosition = doGetPoint( position );
+						auto shellVelocity = doGetPoint( velocity );
+
+						for ( int j = 1; j < 10; ++j )
+						{
+							secondaryShellEmitter.emit( shellPosition
+								, ( doGetRandomDirection() * 5.0f ) + shellVelocity / 2.0f
+								, 0.0f );
+						}
+
+						// Turn this shell to a secondary shell, to decrease the holes in buffer
+						type = g_secondaryShell;
+						doSetPoint( velocity, ( doGetRandomDirection() * 5.0f ) + shellVelocity / 2.0f );
+						age = 0.0f;
+					}
+				}
+				else if ( age >= g_secondaryShellLifetime.count() )
+				{
+					type = g_launcher;
+				}
 			}
 		}
 	}
@@ -305,15 +336,20 @@ namespace fireworks
 
 	void ParticleSystem::doPackParticles()
 	{
-		for ( auto i = 1u; i < m_firstUnused && m_firstUnused > 1u; ++i )
-		{
-			auto & particle = m_particles[i];
+		auto types = m_particles.getStream< float >( *( m_inputs.begin() + eType ) );
+		auto i = 1u;
 
-			if ( particle.getValue< castor3d::ParticleFormat::eFloat >( eType ) == 0.0f )
+		while ( i < m_firstUnused )
+		{
+			if ( types[i] == g_launcher )
 			{
-				particle = std::move( m_particles[m_firstUnused - 1] );
+				m_particles.copy( i, m_firstUnused - 1u );
 				--m_firstUnused;
 			}
+			else
+			{
+				++i;
+			}
 		}
 	}
 
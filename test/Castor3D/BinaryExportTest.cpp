@@ -3,8 +3,10 @@
 #include <Castor3D/Engine.hpp>
 #include <Castor3D/Animation/Animation.hpp>
 #include <Castor3D/Animation/AnimationKeyFrame.hpp>
+#include <Castor3D/Binary/BinaryChunk.hpp>
 #include <Castor3D/Binary/BinaryMesh.hpp>
 #include <Castor3D/Binary/BinarySkeleton.hpp>
+#include <Castor3D/Binary/BinarySkeletonAnimation.hpp>
 #include <Castor3D/Cache/CacheView.hpp>
 #include <Castor3D/Cache/MeshCache.hpp>
 #include <Castor3D/Cache/PluginCache.hpp>
@@ -17,6 +19,7 @@
 #include <Castor3D/Model/Skeleton/Skeleton.hpp>
 #include <Castor3D/Model/Skeleton/Animation/SkeletonAnimation.hpp>
 #include <Castor3D/Model/Skeleton/Animation/SkeletonAnimationBone.hpp>
+#include <Castor3D/Model/Skeleton/Animation/SkeletonAnimationKeyFrame.hpp>
 #include <Castor3D/Model/Skeleton/Animation/SkeletonAnimationNode.hpp>
 #include <Castor3D/Miscellaneous/Parameter.hpp>
 #include <Castor3D/Plugin/ImporterPlugin.hpp>
@@ -25,12 +28,110 @@
 #include <Castor3D/Scene/SceneFileParser.hpp>
 
 #include <CastorUtils/Data/BinaryFile.hpp>
+#include <CastorUtils/Data/MappedFile.hpp>
 
 using namespace castor;
 using namespace castor3d;
 
 namespace Testing
 {
+	namespace
+	{
+		struct KeyFrameLocals
+		{
+			Milliseconds time;
+			ObjectTrsArray locals;
+		};
+
+		std::vector< KeyFrameLocals > getKeyFramesLocals( SkeletonAnimation const & animation )
+		{
+			std::vector< KeyFrameLocals > result;
+
+			for ( auto & keyFrame : animation )
+			{
+				auto & skelKeyFrame = static_cast< SkeletonAnimationKeyFrame const & >( *keyFrame );
+				result.push_back( { skelKeyFrame.getTimeIndex(), skelKeyFrame.getLocalTransforms() } );
+			}
+
+			return result;
+		}
+
+		// Both q and -q are the same rotation, the error is measured on the closest one.
+		float getRotationError( Quaternion const & lhs
+			, Quaternion const & rhs )
+		{
+			auto sign = point::dot( lhs, rhs ) < 0.0 ? -1.0f : 1.0f;
+			float result = 0.0f;
+
+			for ( uint32_t i = 0u; i < 4u; ++i )
+			{
+				result = std::max( result, std::abs( lhs[i] - sign * rhs[i] ) );
+			}
+
+			return result;
+		}
+
+		template< typename ObjT >
+		bool parseFile( ObjT & obj
+			, Path const & path
+			, bool mapped )
+		{
+			if ( mapped )
+			{
+				return BinaryParser< ObjT >{}.parse( obj, path );
+			}
+
+			BinaryFile file{ path, File::OpenMode::eRead };
+			return BinaryParser< ObjT >{}.parse( obj, file );
+		}
+
+		struct ChunkLayout
+		{
+			uint8_t const * base;
+			uint32_t version;
+			uint32_t misaligned;
+			uint32_t blocks;
+		};
+
+		void getChunkLayout( BinaryChunk & chunk
+			, ChunkLayout & layout )
+		{
+			BinaryChunk subchunk;
+
+			while ( chunk.checkAvailable( 1u )
+				&& chunk.getSubChunk( subchunk ) )
+			{
+				if ( size_t( subchunk.getData() - layout.base ) % CmshChunkAlignment )
+				{
+					++layout.misaligned;
+				}
+
+				switch ( subchunk.getChunkType() )
+				{
+				case ChunkType::eCmshHeader:
+				case ChunkType::eMesh:
+				case ChunkType::eSubmesh:
+				case ChunkType::eBonesComponent:
+					getChunkLayout( subchunk, layout );
+					break;
+
+				case ChunkType::eCmshVersion:
+					std::memcpy( &layout.version, subchunk.getData(), sizeof( uint32_t ) );
+					break;
+
+				case ChunkType::eSubmeshVertex:
+				case ChunkType::eSubmeshIndices:
+				case ChunkType::eSubmeshBones:
+					++layout.blocks;
+					break;
+
+				default:
+					break;
+				}
+			}
+		}
+	}
+
 	BinaryExportTest::BinaryExportTest( Engine & engine )
 		: C3DTestCase{ "BinaryExportTest", engine }
 	{
@@ -45,6 +146,10 @@ namespace Testing
 		doRegisterTest( "BinaryExportTest::SimpleMesh", std::bind( &BinaryExportTest::SimpleMesh, this ) );
 		doRegisterTest( "BinaryExportTest::ImportExport", std::bind( &BinaryExportTest::ImportExport, this ) );
 		doRegisterTest( "BinaryExportTest::AnimatedMesh", std::bind( &BinaryExportTest::AnimatedMesh, this ) );
+		doRegisterTest( "BinaryExportTest::QuantisedKeyFrames", std::bind( &BinaryExportTest::QuantisedKeyFrames, this ) );
+		doRegisterTest( "BinaryExportTest::ReduceKeyFrames", std::bind( &BinaryExportTest::ReduceKeyFrames, this ) );
+		doRegisterTest( "BinaryExportTest::LegacyMappedMesh", std::bind( &BinaryExportTest::LegacyMappedMesh, this ) );
+		doRegisterTest( "BinaryExportTest::MappedFile", std::bind( &BinaryExportTest::MappedFile, this ) );
 	}
 
 	void BinaryExportTest::SimpleMesh()
@@ -68,42 +173,235 @@ namespace Testing
 
 	void BinaryExportTest::ImportExport()
 	{
-		doTestMeshFile( cuT( "SimpleTestMesh" ) );
+		doTestMeshFile( cuT( "SimpleTestMesh" ), false );
 	}
 
 	void BinaryExportTest::AnimatedMesh()
 	{
-		doTestMeshFile( cuT( "AnimTestMesh" ) );
+		doTestMeshFile( cuT( "AnimTestMesh" ), false );
 	}
 
-	void BinaryExportTest::doTestMeshFile( String const & name )
+	void BinaryExportTest::QuantisedKeyFrames()
 	{
-		Path path{ name + cuT( ".cmsh" ) };
+		// The rotations are stored as 16 bits snorm components, then renormalised when read.
+		float const maxRotationError = 2.0f / 32767.0f;
+		Path path{ cuT( "QuantisedKeyFrames.cmsh" ) };
 		Scene scene{ cuT( "TestScene" ), m_engine };
+		Skeleton srcSkeleton{ scene };
+		auto & src = srcSkeleton.createAnimation( cuT( "Anim" ) );
+		auto root = src.addObject( cuT( "Root" ), nullptr );
+		auto child = src.addObject( cuT( "Child" ), root );
+		Point3f const axes[]
+		{
+			Point3f{ 0.0f, 1.0f, 0.0f },
+			point::getNormalised( Point3f{ 1.0f, 1.0f, 0.0f } ),
+			point::getNormalised( Point3f{ -0.3f, 0.2f, 0.9f } ),
+		};
 
-		auto src = scene.getMeshCache().add( name );
+		for ( uint32_t i = 0u; i < 12u; ++i )
 		{
-			BinaryFile file{ m_testDataFolder / path, File::OpenMode::eRead };
-			BinaryParser< Mesh > parser;
-			auto result = CT_CHECK( parser.parse( *src, file ) );
+			auto keyFrame = std::make_unique< SkeletonAnimationKeyFrame >( src, Milliseconds{ i * 100u } );
+			// Angles beyond 180 degrees give quaternions with a negative w.
+			auto angle = Angle::fromDegrees( float( i ) * 33.3f );
+			keyFrame->addAnimationObject( *root
+				, Point3f{ float( i ), 0.5f, -2.0f }
+				, Quaternion::fromAxisAngle( axes[i % 3u], angle )
+				, Point3f{ 1.0f, 1.0f, 1.0f } );
+			keyFrame->addAnimationObject( *child
+				, Point3f{ 0.0f, 1.25f * float( i ), 0.0f }
+				, Quaternion::fromAxisAngle( axes[( i + 1u ) % 3u], -angle )
+				, Point3f{ 1.0f + 0.1f * float( i ), 1.0f, 0.5f } );
+			src.addKeyFrame( std::move( keyFrame ) );
+		}
 
-			if ( result && File::fileExists( m_testDataFolder / ( name + cuT( ".cskl" ) ) ) )
+		{
+			BinaryFile file{ path, File::OpenMode::eWrite };
+			CT_CHECK( castor3d::BinaryWriter< SkeletonAnimation >{}.write( src, file ) );
+		}
+
+		Skeleton dstSkeleton{ scene };
+		auto & dst = dstSkeleton.createAnimation( cuT( "Anim" ) );
+		{
+			BinaryFile file{ path, File::OpenMode::eRead };
+			CT_CHECK( BinaryParser< SkeletonAnimation >{}.parse( dst, file ) );
+		}
+
+		auto srcKeyFrames = getKeyFramesLocals( src );
+		auto dstKeyFrames = getKeyFramesLocals( dst );
+		CT_REQUIRE( srcKeyFrames.size() == dstKeyFrames.size() );
+
+		for ( size_t i = 0u; i < srcKeyFrames.size(); ++i )
+		{
+			auto & lhs = srcKeyFrames[i];
+			auto & rhs = dstKeyFrames[i];
+			CT_EQUAL( lhs.time, rhs.time );
+			CT_REQUIRE( lhs.locals.size() == rhs.locals.size() );
+
+			for ( size_t j = 0u; j < lhs.locals.size(); ++j )
 			{
-				auto skeleton = std::make_shared< Skeleton >( *src->getScene() );
-				BinaryFile file{ m_testDataFolder / ( name + cuT( ".cskl" ) )
-					, File::OpenMode::eRead };
-				result = CT_CHECK( BinaryParser< Skeleton >().parse( *skeleton, file ) );
+				CT_EQUAL( lhs.locals[j].object->getName(), rhs.locals[j].object->getName() );
+				CT_EQUAL( lhs.locals[j].translate, rhs.locals[j].translate );
+				CT_EQUAL( lhs.locals[j].scale, rhs.locals[j].scale );
+				CT_CHECK( getRotationError( lhs.locals[j].rotate, rhs.locals[j].rotate ) <= maxRotationError );
+				CT_CHECK( std::abs( point::length( rhs.locals[j].rotate ) - 1.0 ) <= 1.0e-5 );
+			}
+		}
 
-				if ( result )
+		File::deleteFile( path );
+	}
+
+	void BinaryExportTest::ReduceKeyFrames()
+	{
+		float const tolerance = 0.001f;
+		auto const angleTolerance = Angle::fromDegrees( 1.0f );
+		auto const maxRotationError = float( std::sin( angleTolerance.radians() / 4.0f ) * 2.0f );
+		Scene scene{ cuT( "TestScene" ), m_engine };
+		Skeleton skeleton{ scene };
+		auto & animation = skeleton.createAnimation( cuT( "Anim" ) );
+		auto root = animation.addObject( cuT( "Root" ), nullptr );
+		auto child = animation.addObject( cuT( "Child" ), root );
+		Point3f const axis{ 0.0f, 0.0f, 1.0f };
+
+		// Keyframes 0 to 8 are a linear motion, keyframes 8 to 10 another one.
+		for ( uint32_t i = 0u; i <= 10u; ++i )
+		{
+			auto keyFrame = std::make_unique< SkeletonAnimationKeyFrame >( animation, Milliseconds{ i * 100u } );
+			auto step = float( std::min( i, 8u ) ) + 3.0f * float( i - std::min( i, 8u ) );
+			keyFrame->addAnimationObject( *root
+				, Point3f{ 0.5f * step, 0.0f, 0.0f }
+				, Quaternion::fromAxisAngle( axis, Angle::fromDegrees( 10.0f * step ) )
+				, Point3f{ 1.0f, 1.0f, 1.0f } );
+			keyFrame->addAnimationObject( *child
+				, Point3f{ 0.0f, 1.0f, 0.0f }
+				, Quaternion::fromAxisAngle( axis, Angle::fromDegrees( 0.0f ) )
+				, Point3f{ 1.0f + 0.05f * step, 1.0f, 1.0f } );
+			animation.addKeyFrame( std::move( keyFrame ) );
+		}
+
+		auto original = getKeyFramesLocals( animation );
+		CT_EQUAL( animation.reduceKeyFrames( tolerance, angleTolerance ), 8u );
+		auto reduced = getKeyFramesLocals( animation );
+		CT_REQUIRE( reduced.size() == 3u );
+		CT_EQUAL( reduced[0].time, Milliseconds{ 0u } );
+		CT_EQUAL( reduced[1].time, Milliseconds{ 800u } );
+		CT_EQUAL( reduced[2].time, Milliseconds{ 1000u } );
+
+		// Every original keyframe is rebuilt from its kept neighbours, within the tolerances.
+		for ( auto & keyFrame : original )
+		{
+			auto next = std::find_if( reduced.begin()
+				, reduced.end()
+				, [&keyFrame]( KeyFrameLocals const & lookup )
 				{
-					src->setSkeleton( skeleton );
-				}
+					return lookup.time >= keyFrame.time;
+				} );
+			CT_REQUIRE( next != reduced.end() );
+			auto prev = next == reduced.begin()
+				? next
+				: std::prev( next );
+			auto range = ( next->time - prev->time ).count();
+			auto factor = range
+				? float( ( keyFrame.time - prev->time ).count() ) / float( range )
+				: 0.0f;
+			CT_REQUIRE( prev->locals.size() == keyFrame.locals.size() );
+
+			for ( size_t j = 0u; j < keyFrame.locals.size(); ++j )
+			{
+				auto interpolated = interpolateTransform( prev->locals[j], next->locals[j], factor );
+				auto & expected = keyFrame.locals[j];
+				CT_CHECK( point::distance( interpolated.translate, expected.translate ) <= tolerance );
+				CT_CHECK( point::distance( interpolated.scale, expected.scale ) <= tolerance );
+				CT_CHECK( getRotationError( interpolated.rotate, expected.rotate ) <= maxRotationError );
+			}
+		}
+
+		// The motion change keyframe can't be rebuilt from the others.
+		CT_EQUAL( animation.reduceKeyFrames( tolerance, angleTolerance ), 0u );
+	}
+
+	void BinaryExportTest::LegacyMappedMesh()
+	{
+		doTestMeshFile( cuT( "AnimTestMesh" ), true );
+	}
+
+	void BinaryExportTest::MappedFile()
+	{
+		Path path{ cuT( "MappedFile.bin" ) };
+		std::vector< uint8_t > data( 1000u );
+
+		for ( size_t i = 0u; i < data.size(); ++i )
+		{
+			data[i] = uint8_t( i * 7u );
+		}
+
+		{
+			BinaryFile file{ path, File::OpenMode::eWrite };
+			CT_EQUAL( file.writeArray( data.data(), data.size() ), data.size() );
+		}
+
+		{
+			castor::MappedFile mapped{ path };
+			CT_REQUIRE( mapped.isMapped() );
+			CT_EQUAL( mapped.getSize(), data.size() );
+			CT_CHECK( std::equal( data.begin(), data.end(), mapped.getData() ) );
+		}
+
+		File::deleteFile( path );
+		castor::MappedFile missing{ path };
+		CT_CHECK( !missing.isMapped() );
+		CT_EQUAL( missing.getSize(), 0u );
+	}
+
+	void BinaryExportTest::doTestMeshFile( String const & name
+		, bool mapped )
+	{
+		Path path{ name + cuT( ".cmsh" ) };
+		Scene scene{ cuT( "TestScene" ), m_engine };
+
+		{
+			// The fixtures are cmsh 1.x files: big endian, with 12 bytes chunk headers.
+			castor::MappedFile file{ m_testDataFolder / path };
+			CT_REQUIRE( file.isMapped() );
+			BinaryChunk header;
+			CT_CHECK( header.read( file.getData(), file.getSize() ) );
+			CT_CHECK( header.isBigEndian() );
+		}
+
+		auto src = scene.getMeshCache().add( name );
+		auto result = CT_CHECK( parseFile( *src, m_testDataFolder / path, mapped ) );
+
+		if ( result && File::fileExists( m_testDataFolder / ( name + cuT( ".cskl" ) ) ) )
+		{
+			auto skeleton = std::make_shared< Skeleton >( *src->getScene() );
+			result = CT_CHECK( parseFile( *skeleton, m_testDataFolder / ( name + cuT( ".cskl" ) ), mapped ) );
+
+			if ( result )
+			{
+				src->setSkeleton( skeleton );
 			}
 		}
 
 		doTestMesh( src );
 	}
 
+	void BinaryExportTest::doTestMeshLayout( Path const & path )
+	{
+		castor::MappedFile file{ path };
+		CT_REQUIRE( file.isMapped() );
+		BinaryChunk header;
+		CT_REQUIRE( header.read( file.getData(), file.getSize() ) );
+		CT_CHECK( !header.isBigEndian() );
+		CT_CHECK( header.getChunkType() == ChunkType::eCmshFile );
+
+		// Every chunk payload, and thus the vertex, index and bones blocks, starts at a 16 bytes aligned offset.
+		ChunkLayout layout{ file.getData(), 0u, 0u, 0u };
+		CT_CHECK( size_t( header.getData() - layout.base ) % CmshChunkAlignment == 0u );
+		getChunkLayout( header, layout );
+		CT_EQUAL( layout.version, CurrentCmshVersion );
+		CT_EQUAL( layout.misaligned, 0u );
+		CT_CHECK( layout.blocks > 0u );
+	}
+
 	void BinaryExportTest::doTestMesh( MeshSPtr & src )
 	{
 		auto & renderSystem = *m_engine.getRenderSystem();
@@ -114,6 +412,7 @@ namespace Testing
 		Scene & scene = *src->getScene();
 		String name = src->getName();
 		Path path{ name + cuT( ".cmsh" ) };
+		Path sklPath{ path.getFileName() + cuT( ".cskl" ) };
 
 		for ( auto & submesh : *src )
 		{
@@ -128,46 +427,60 @@ namespace Testing
 
 			if ( result && skeleton )
 			{
-				BinaryFile file{ Path{ path.getFileName() + cuT( ".cskl" ) }, File::OpenMode::eWrite };
+				BinaryFile file{ sklPath, File::OpenMode::eWrite };
 				result = CT_CHECK( castor3d::BinaryWriter< Skeleton >().write( *skeleton, file ) );
 			}
 		}
 
-		auto dst = scene.getMeshCache().add( name + cuT( "_imp" ) );
+		doTestMeshLayout( path );
+		// The written file is read back through a regular read, then through a mapping.
+		std::vector< MeshSPtr > dsts;
+
+		for ( auto mapped : { false, true } )
 		{
-			BinaryFile file{ path, File::OpenMode::eRead };
-			BinaryParser< Mesh > parser;
-			auto result = CT_CHECK( parser.parse( *dst, file ) );
+			auto dst = scene.getMeshCache().add( name + ( mapped ? cuT( "_map" ) : cuT( "_imp" ) ) );
+			auto result = CT_CHECK( parseFile( *dst, path, mapped ) );
 
-			if ( result && File::fileExists( Path{ path.getFileName() + cuT( ".cskl" ) } ) )
+			if ( result && File::fileExists( sklPath ) )
 			{
 				auto skeleton = std::make_shared< Skeleton >( *dst->getScene() );
-				BinaryFile file{ Path{ path.getFileName() + cuT( ".cskl" ) }
-					, File::OpenMode::eRead };
-				result = CT_CHECK( BinaryParser< Skeleton >().parse( *skeleton, file ) );
+				result = CT_CHECK( parseFile( *skeleton, sklPath, mapped ) );
 
 				if ( result )
 				{
 					dst->setSkeleton( skeleton );
 				}
 			}
+
+			for ( auto submesh : *dst )
+			{
+				submesh->initialise( device );
+			}
+
+			auto & lhs = *src;
+			auto & rhs = *dst;
+			CT_EQUAL( lhs, rhs );
+			dsts.push_back( dst );
 		}
 
-		for ( auto submesh : *dst )
+		File::deleteFile( path );
+
+		if ( File::fileExists( sklPath ) )
 		{
-			submesh->initialise( device );
+			File::deleteFile( sklPath );
 		}
 
-		auto & lhs = *src;
-		auto & rhs = *dst;
-		CT_EQUAL( lhs, rhs );
-		File::deleteFile( path );
 		scene.cleanup();
 		m_engine.getRenderLoop().renderSyncFrame();
 		src->cleanup();
-		dst->cleanup();
+
+		for ( auto & dst : dsts )
+		{
+			dst->cleanup();
+		}
+
 		src.reset();
-		dst.reset();
+		dsts.clear();
 		renderSystem.setCurrentRenderDevice( nullptr );
 		doCleanupEngine();
 	}
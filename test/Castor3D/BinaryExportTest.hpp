@@ -22,7 +22,13 @@ namespace Testing
 		void SimpleMesh();
 		void ImportExport();
 		void AnimatedMesh();
-		void doTestMeshFile( castor::String const & name );
+		void QuantisedKeyFrames();
+		void ReduceKeyFrames();
+		void LegacyMappedMesh();
+		void MappedFile();
+		void doTestMeshFile( castor::String const & name
+			, bool mapped );
+		void doTestMeshLayout( castor::Path const & path );
 		void doTestMesh( castor3d::MeshSPtr & src );
 	};
 }
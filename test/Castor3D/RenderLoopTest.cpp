@@ -0,0 +1,155 @@
+#include "RenderLoopTest.hpp"
+
+#include <Castor3D/Engine.hpp>
+#include <Castor3D/Buffer/UniformBufferPools.hpp>
+#include <Castor3D/Cache/SceneCache.hpp>
+#include <Castor3D/Render/RenderDevice.hpp>
+#include <Castor3D/Render/RenderInfo.hpp>
+#include <Castor3D/Render/RenderLoop.hpp>
+#include <Castor3D/Render/RenderSystem.hpp>
+#include <Castor3D/Render/RenderWindow.hpp>
+#include <Castor3D/Scene/Scene.hpp>
+#include <Castor3D/Scene/SceneFileParser.hpp>
+#include <Castor3D/Shader/Ubos/UbosModule.hpp>
+
+using namespace castor;
+using namespace castor3d;
+
+namespace Testing
+{
+	RenderLoopTest::RenderLoopTest( Engine & engine )
+		: C3DTestCase{ "RenderLoopTest", engine }
+	{
+	}
+
+	RenderLoopTest::~RenderLoopTest()
+	{
+	}
+
+	void RenderLoopTest::doRegisterTests()
+	{
+		doRegisterTest( "RenderLoopTest::SingleFrameInFlight", std::bind( &RenderLoopTest::SingleFrameInFlight, this ) );
+		doRegisterTest( "RenderLoopTest::FramesInFlight", std::bind( &RenderLoopTest::FramesInFlight, this ) );
+		doRegisterTest( "RenderLoopTest::FramesInFlightChange", std::bind( &RenderLoopTest::FramesInFlightChange, this ) );
+		doRegisterTest( "RenderLoopTest::OcclusionCulling", std::bind( &RenderLoopTest::OcclusionCulling, this ) );
+	}
+
+	void RenderLoopTest::SingleFrameInFlight()
+	{
+		doRenderScene( cuT( "light_directional.cscn" ), 1u );
+	}
+
+	void RenderLoopTest::FramesInFlight()
+	{
+		doRenderScene( cuT( "light_directional.cscn" ), 2u );
+		doRenderScene( cuT( "instancing.cscn" ), 2u );
+	}
+
+	void RenderLoopTest::FramesInFlightChange()
+	{
+		m_engine.cleanup();
+		m_engine.setMaxFramesInFlight( 1u );
+		m_engine.initialise( 1, false );
+		auto & loop = m_engine.getRenderLoop();
+		loop.renderSyncFrame();
+		CT_EQUAL( loop.getFramesInFlight(), 1u );
+
+		// Applied by the render loop at the start of its next frame.
+		{
+			SceneFileParser parser{ m_engine };
+			CT_REQUIRE( parser.parseFile( m_testDataFolder / cuT( "frames_in_flight.cscn" ) ) );
+		}
+		CT_EQUAL( m_engine.getMaxFramesInFlight(), 2u );
+		loop.renderSyncFrame();
+		CT_EQUAL( loop.getFramesInFlight(), 2u );
+		CT_EQUAL( loop.getCurrentFrameSlot(), 1u );
+
+		m_engine.setMaxFramesInFlight( 1u );
+		loop.renderSyncFrame();
+		CT_EQUAL( loop.getFramesInFlight(), 1u );
+		CT_EQUAL( loop.getCompletedFrames(), loop.getSubmittedFrames() );
+		doCleanupEngine();
+	}
+
+	void RenderLoopTest::OcclusionCulling()
+	{
+		doRenderScene( cuT( "occlusion.cscn" ), 1u );
+	}
+
+	void RenderLoopTest::doRenderScene( String const & name
+		, uint32_t framesInFlight )
+	{
+		// The frames in flight count is read when the render loop is created.
+		m_engine.cleanup();
+		m_engine.setMaxFramesInFlight( framesInFlight );
+		m_engine.initialise( 1, false );
+		CT_EQUAL( m_engine.getMaxFramesInFlight(), framesInFlight );
+
+		SceneSPtr scene;
+		{
+			SceneFileParser parser{ m_engine };
+			CT_REQUIRE( parser.parseFile( m_testDataFolder / name ) );
+			CT_REQUIRE( parser.scenesBegin() != parser.scenesEnd() );
+			scene = parser.scenesBegin()->second;
+		}
+		auto window = std::make_shared< RenderWindow >( "RenderLoopTest"
+			, m_engine
+			, Size{ 800u, 600u }
+			, ashes::WindowHandle{ std::make_unique< TestWindowHandle >() } );
+
+		// More frames than slots, so that each slot gets reused.
+		auto & loop = m_engine.getRenderLoop();
+
+		for ( uint32_t i = 0u; i < 4u * framesInFlight; ++i )
+		{
+			auto submitted = loop.getSubmittedFrames();
+			auto slot = loop.getCurrentFrameSlot();
+			loop.renderSyncFrame();
+			CT_EQUAL( loop.getFramesInFlight(), framesInFlight );
+			CT_EQUAL( loop.getSubmittedFrames(), submitted + 1u );
+			CT_EQUAL( loop.getCurrentFrameSlot(), ( slot + 1u ) % framesInFlight );
+			// Only the frames that can be in flight may still be pending, the older ones' fences have been waited for.
+			CT_CHECK( loop.getSubmittedFrames() - loop.getCompletedFrames() < framesInFlight );
+		}
+
+		doCheckHostSnapshot();
+
+		window.reset();
+		scene->cleanup();
+		m_engine.getRenderLoop().renderSyncFrame();
+		m_engine.getSceneCache().remove( scene->getName() );
+		scene.reset();
+		m_engine.setMaxFramesInFlight( 1u );
+		doCleanupEngine();
+	}
+
+	void RenderLoopTest::doCheckHostSnapshot()
+	{
+		// The staging memory must not be in use by a frame in flight.
+		m_engine.setMaxFramesInFlight( 1u );
+		m_engine.getRenderLoop().renderSyncFrame();
+
+		auto & device = *m_engine.getRenderSystem()->getMainRenderDevice();
+		auto & pools = *device.uboPools;
+		auto ubo = pools.getBuffer< ModelUboConfiguration >( 0u );
+		auto commandBuffer = device.graphicsCommandPool->createCommandBuffer( "RenderLoopTest" );
+		commandBuffer->begin();
+
+		// The CPU writes go to the host copy, only what changed since the last upload reaches the GPU.
+		RenderInfo flushInfo;
+		pools.upload( *commandBuffer, flushInfo );
+		RenderInfo unchangedInfo;
+		pools.upload( *commandBuffer, unchangedInfo );
+		CT_EQUAL( unchangedInfo.m_uploadedUboBytes, 0u );
+
+		ubo.getData().nodeId = 42;
+		CT_EQUAL( ubo.getData().nodeId, 42 );
+		RenderInfo changedInfo;
+		pools.upload( *commandBuffer, changedInfo );
+		CT_CHECK( changedInfo.m_uploadedUboBytes >= sizeof( ModelUboConfiguration ) );
+		CT_CHECK( changedInfo.m_uploadedUboBytes <= ubo.range );
+
+		commandBuffer->end();
+		pools.putBuffer( ubo );
+	}
+}
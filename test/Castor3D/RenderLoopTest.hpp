@@ -0,0 +1,32 @@
+/* See LICENSE file in root folder */
+#ifndef ___C3DT_RENDER_LOOP_TEST_H___
+#define ___C3DT_RENDER_LOOP_TEST_H___
+
+#include "Castor3DTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class RenderLoopTest
+		: public C3DTestCase
+	{
+	public:
+		explicit RenderLoopTest( castor3d::Engine & engine );
+		virtual ~RenderLoopTest();
+
+	private:
+		void doRegisterTests()override;
+
+	private:
+		void SingleFrameInFlight();
+		void FramesInFlight();
+		void FramesInFlightChange();
+		void OcclusionCulling();
+
+	private:
+		void doRenderScene( castor::String const & name
+			, uint32_t framesInFlight );
+		void doCheckHostSnapshot();
+	};
+}
+
+#endif
@@ -1,6 +1,7 @@
 #include "Castor3DTestPrerequisites.hpp"
 
 #include "BinaryExportTest.hpp"
+#include "RenderLoopTest.hpp"
 #include "SceneExportTest.hpp"
 
 #include <Castor3D/Engine.hpp>
@@ -143,6 +144,7 @@ int main( int argc, char const * argv[] )
 		// Test cases.
 		Testing::registerType( std::make_unique< Testing::BinaryExportTest >( *engine ) );
 		Testing::registerType( std::make_unique< Testing::SceneExportTest >( *engine ) );
+		Testing::registerType( std::make_unique< Testing::RenderLoopTest >( *engine ) );
 
 		// Tests loop.
 		BENCHLOOP( count, result );
@@ -0,0 +1,244 @@
+#include "CastorUtilsAsyncJobQueueTest.hpp"
+
+#include <CastorUtils/Multithreading/AsyncJobQueue.hpp>
+
+#include <atomic>
+#include <stdexcept>
+
+using namespace castor;
+
+namespace Testing
+{
+	CastorUtilsAsyncJobQueueTest::CastorUtilsAsyncJobQueueTest()
+		: TestCase( "CastorUtilsAsyncJobQueueTest" )
+	{
+	}
+
+	CastorUtilsAsyncJobQueueTest::~CastorUtilsAsyncJobQueueTest()
+	{
+	}
+
+	void CastorUtilsAsyncJobQueueTest::doRegisterTests()
+	{
+		doRegisterTest( "CastorUtilsAsyncJobQueueTest::Burst", std::bind( &CastorUtilsAsyncJobQueueTest::Burst, this ) );
+		doRegisterTest( "CastorUtilsAsyncJobQueueTest::Priorities", std::bind( &CastorUtilsAsyncJobQueueTest::Priorities, this ) );
+		doRegisterTest( "CastorUtilsAsyncJobQueueTest::Cancellation", std::bind( &CastorUtilsAsyncJobQueueTest::Cancellation, this ) );
+		doRegisterTest( "CastorUtilsAsyncJobQueueTest::Continuations", std::bind( &CastorUtilsAsyncJobQueueTest::Continuations, this ) );
+		doRegisterTest( "CastorUtilsAsyncJobQueueTest::HandleOutlivesQueue", std::bind( &CastorUtilsAsyncJobQueueTest::HandleOutlivesQueue, this ) );
+		doRegisterTest( "CastorUtilsAsyncJobQueueTest::ThrowingJob", std::bind( &CastorUtilsAsyncJobQueueTest::ThrowingJob, this ) );
+	}
+
+	void CastorUtilsAsyncJobQueueTest::Burst()
+	{
+		// More jobs than the queue capacity, to go through the full queue path.
+		constexpr int count = 1000;
+		AsyncJobQueue queue( 4u, 64u );
+		std::atomic_int value{ 0 };
+
+		for ( int i = 0; i < count; ++i )
+		{
+			queue.pushJob( [&value]()
+				{
+					value++;
+				}
+				, JobPriority( i % int( JobPriority::eCount ) ) );
+		}
+
+		queue.waitAll();
+		CT_CHECK( value == count );
+	}
+
+	void CastorUtilsAsyncJobQueueTest::Priorities()
+	{
+		AsyncJobQueue queue( 1u );
+		std::atomic_bool started{ false };
+		std::atomic_bool go{ false };
+		std::vector< JobPriority > order;
+		queue.pushJob( [&started, &go]()
+			{
+				started = true;
+
+				while ( !go )
+				{
+					std::this_thread::yield();
+				}
+			} );
+
+		while ( !started )
+		{
+			std::this_thread::yield();
+		}
+
+		std::vector< AsyncJobQueue::Handle > handles;
+		handles.push_back( queue.pushJob( [&order](){ order.push_back( JobPriority::eBackground ); }, JobPriority::eBackground ) );
+		handles.push_back( queue.pushJob( [&order](){ order.push_back( JobPriority::eStreaming ); }, JobPriority::eStreaming ) );
+		handles.push_back( queue.pushJob( [&order](){ order.push_back( JobPriority::eInteractive ); }, JobPriority::eInteractive ) );
+		go = true;
+
+		for ( auto & handle : handles )
+		{
+			handle.wait();
+		}
+
+		CT_REQUIRE( order.size() == 3u );
+		CT_CHECK( order[0] == JobPriority::eInteractive );
+		CT_CHECK( order[1] == JobPriority::eStreaming );
+		CT_CHECK( order[2] == JobPriority::eBackground );
+	}
+
+	void CastorUtilsAsyncJobQueueTest::Cancellation()
+	{
+		AsyncJobQueue queue( 1u );
+		std::atomic_bool go{ false };
+		std::atomic_int value{ 0 };
+		auto blocker = queue.pushJob( [&go]()
+			{
+				while ( !go )
+				{
+					std::this_thread::yield();
+				}
+			} );
+		auto job = queue.pushJob( [&value]()
+			{
+				value++;
+			} );
+		auto continuation = job.then( [&value]()
+			{
+				value++;
+			} );
+
+		CT_CHECK( job.cancel() );
+		CT_CHECK( !job.cancel() );
+		go = true;
+		continuation.wait();
+		blocker.wait();
+		queue.waitAll();
+
+		CT_CHECK( blocker.isDone() );
+		CT_CHECK( job.isCancelled() );
+		CT_CHECK( continuation.isCancelled() );
+		CT_CHECK( !blocker.cancel() );
+		CT_CHECK( value == 0 );
+	}
+
+	void CastorUtilsAsyncJobQueueTest::Continuations()
+	{
+		AsyncJobQueue queue( 2u );
+		std::atomic_int value{ 0 };
+		auto job = queue.pushJob( [&value]()
+			{
+				value = 1;
+			} );
+		auto second = job.then( [&value]()
+			{
+				value = value * 10;
+			}
+			, JobPriority::eInteractive );
+		auto third = second.then( [&value]()
+			{
+				value = value + 2;
+			} );
+
+		third.wait();
+		CT_CHECK( job.isDone() );
+		CT_CHECK( second.isDone() );
+		CT_CHECK( third.isDone() );
+		CT_CHECK( value == 12 );
+
+		// Continuation registered on an already finished job.
+		auto late = job.then( [&value]()
+			{
+				value = 0;
+			} );
+		late.wait();
+		CT_CHECK( late.isDone() );
+		CT_CHECK( value == 0 );
+	}
+
+	void CastorUtilsAsyncJobQueueTest::HandleOutlivesQueue()
+	{
+		std::atomic_int value{ 0 };
+		AsyncJobQueue::Handle done;
+		AsyncJobQueue::Handle pending;
+		{
+			AsyncJobQueue queue( 1u );
+			std::atomic_bool go{ false };
+			done = queue.pushJob( [&value, &go]()
+				{
+					value++;
+
+					while ( !go )
+					{
+						std::this_thread::yield();
+					}
+				} );
+			pending = queue.pushJob( [&value]()
+				{
+					value++;
+				} );
+
+			while ( value == 0 )
+			{
+				std::this_thread::yield();
+			}
+
+			go = true;
+		}
+
+		CT_CHECK( done.isDone() );
+		CT_CHECK( pending.isDone() || pending.isCancelled() );
+		pending.wait();
+		CT_CHECK( !pending.cancel() );
+
+		// Continuations of a handle which outlived its queue are cancelled.
+		auto late = done.then( [&value]()
+			{
+				value++;
+			} );
+		late.wait();
+		CT_CHECK( late.isCancelled() );
+		CT_CHECK( value <= 2 );
+	}
+
+	void CastorUtilsAsyncJobQueueTest::ThrowingJob()
+	{
+		// A tiny capacity and a busy worker, so the throwing jobs are also run by the pushing thread.
+		constexpr int count = 16;
+		AsyncJobQueue queue( 1u, 2u );
+		std::atomic_bool go{ false };
+		std::atomic_int value{ 0 };
+		auto blocker = queue.pushJob( [&go]()
+			{
+				while ( !go )
+				{
+					std::this_thread::yield();
+				}
+			} );
+		std::vector< AsyncJobQueue::Handle > handles;
+
+		for ( int i = 0; i < count; ++i )
+		{
+			handles.push_back( queue.pushJob( []()
+				{
+					throw std::runtime_error{ "Throwing job" };
+				} ) );
+		}
+
+		auto continuation = handles.back().then( [&value]()
+			{
+				value++;
+			} );
+		go = true;
+
+		for ( auto & handle : handles )
+		{
+			handle.wait();
+			CT_CHECK( handle.isDone() );
+		}
+
+		continuation.wait();
+		queue.waitAll();
+		CT_CHECK( continuation.isDone() );
+		CT_CHECK( value == 1 );
+	}
+}
@@ -0,0 +1,29 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_AsyncJobQueueTest_H___
+#define ___CUT_AsyncJobQueueTest_H___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class CastorUtilsAsyncJobQueueTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsAsyncJobQueueTest();
+		virtual ~CastorUtilsAsyncJobQueueTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void Burst();
+		void Priorities();
+		void Cancellation();
+		void Continuations();
+		void HandleOutlivesQueue();
+		void ThrowingJob();
+	};
+}
+
+#endif
@@ -0,0 +1,247 @@
+#include "CastorUtilsBoundingBoxArrayTest.hpp"
+
+#include <CastorUtils/Math/TransformationMatrix.hpp>
+
+#include <algorithm>
+#include <random>
+
+using namespace castor;
+
+namespace Testing
+{
+	namespace
+	{
+		static uint32_t constexpr BenchObjects = 100000u;
+		static uint32_t constexpr BenchCalls = 100u;
+
+		// A 20x20x20 box centered on the origin, seen from inside.
+		std::vector< PlaneEquation > getBoxPlanes()
+		{
+			return
+			{
+				PlaneEquation{ Point3f{ 1.0f, 0.0f, 0.0f }, 10.0f },
+				PlaneEquation{ Point3f{ -1.0f, 0.0f, 0.0f }, 10.0f },
+				PlaneEquation{ Point3f{ 0.0f, 1.0f, 0.0f }, 10.0f },
+				PlaneEquation{ Point3f{ 0.0f, -1.0f, 0.0f }, 10.0f },
+				PlaneEquation{ Point3f{ 0.0f, 0.0f, 1.0f }, 10.0f },
+				PlaneEquation{ Point3f{ 0.0f, 0.0f, -1.0f }, 10.0f },
+			};
+		}
+
+		ArrayView< PlaneEquation const > makeView( std::vector< PlaneEquation > const & planes )
+		{
+			return makeArrayView( planes.data(), planes.data() + planes.size() );
+		}
+
+		Matrix4x4f getTransform( std::mt19937 & engine )
+		{
+			std::uniform_real_distribution< float > position{ -30.0f, 30.0f };
+			std::uniform_real_distribution< float > scale{ 0.5f, 2.0f };
+			std::uniform_real_distribution< float > angle{ 0.0f, 360.0f };
+			Matrix4x4f result;
+			matrix::setTransform( result
+				, Point3f{ position( engine ), position( engine ), position( engine ) }
+				, Point3f{ scale( engine ), scale( engine ), scale( engine ) }
+				, Quaternion::fromAxisAngle( point::getNormalised( Point3f{ 1.0f, 1.0f, 0.0f } )
+					, Angle::fromDegrees( angle( engine ) ) ) );
+			return result;
+		}
+
+		bool isVisible( BoundingBox const & box
+			, Matrix4x4f const & transform
+			, std::vector< PlaneEquation > const & planes )
+		{
+			auto aabb = box.getAxisAligned( transform );
+			bool result = true;
+
+			for ( auto & plane : planes )
+			{
+				result = result
+					&& plane.distance( aabb.getPositiveVertex( plane.getNormal() ) ) >= 0.0f;
+			}
+
+			return result;
+		}
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsBoundingBoxArrayTest::CastorUtilsBoundingBoxArrayTest()
+		: TestCase( "CastorUtilsBoundingBoxArrayTest" )
+	{
+	}
+
+	CastorUtilsBoundingBoxArrayTest::~CastorUtilsBoundingBoxArrayTest()
+	{
+	}
+
+	void CastorUtilsBoundingBoxArrayTest::doRegisterTests()
+	{
+		doRegisterTest( "CastorUtilsBoundingBoxArrayTest::Empty", std::bind( &CastorUtilsBoundingBoxArrayTest::Empty, this ) );
+		doRegisterTest( "CastorUtilsBoundingBoxArrayTest::Planes", std::bind( &CastorUtilsBoundingBoxArrayTest::Planes, this ) );
+		doRegisterTest( "CastorUtilsBoundingBoxArrayTest::Transformed", std::bind( &CastorUtilsBoundingBoxArrayTest::Transformed, this ) );
+		doRegisterTest( "CastorUtilsBoundingBoxArrayTest::Ranges", std::bind( &CastorUtilsBoundingBoxArrayTest::Ranges, this ) );
+	}
+
+	void CastorUtilsBoundingBoxArrayTest::Empty()
+	{
+		BoundingBoxArray array;
+		std::vector< uint8_t > visible{ 1u, 1u };
+		auto planes = getBoxPlanes();
+		array.cull( makeView( planes ), visible );
+		CT_CHECK( array.empty() );
+		CT_CHECK( visible.empty() );
+	}
+
+	void CastorUtilsBoundingBoxArrayTest::Planes()
+	{
+		BoundingBoxArray array;
+		Matrix4x4f identity{ 1.0f };
+		BoundingBox unit{ Point3f{ -1.0f, -1.0f, -1.0f }, Point3f{ 1.0f, 1.0f, 1.0f } };
+		Matrix4x4f translate;
+		// Inside.
+		array.add( unit, identity );
+		// Crossing the +X plane.
+		array.add( unit, matrix::setTranslate( translate, Point3f{ 10.5f, 0.0f, 0.0f } ) );
+		// Outside the +X plane.
+		array.add( unit, matrix::setTranslate( translate, Point3f{ 11.5f, 0.0f, 0.0f } ) );
+		// Outside the -Z plane.
+		array.add( unit, matrix::setTranslate( translate, Point3f{ 0.0f, 0.0f, -12.0f } ) );
+		// Inside, in a second SIMD batch.
+		array.add( unit, matrix::setTranslate( translate, Point3f{ 5.0f, 5.0f, 5.0f } ) );
+		CT_EQUAL( array.size(), 5u );
+
+		auto planes = getBoxPlanes();
+		std::vector< uint8_t > visible;
+		array.cull( makeView( planes ), visible );
+		CT_REQUIRE( visible.size() == 5u );
+		CT_EQUAL( visible[0], 1u );
+		CT_EQUAL( visible[1], 1u );
+		CT_EQUAL( visible[2], 0u );
+		CT_EQUAL( visible[3], 0u );
+		CT_EQUAL( visible[4], 1u );
+
+		// Move the outside box inside.
+		array.set( 2u, unit, identity );
+		array.cull( makeView( planes ), visible );
+		CT_EQUAL( visible[2], 1u );
+	}
+
+	void CastorUtilsBoundingBoxArrayTest::Transformed()
+	{
+		std::mt19937 engine;
+		BoundingBoxArray array;
+		std::vector< BoundingBox > boxes;
+		std::vector< Matrix4x4f > transforms;
+		BoundingBox box{ Point3f{ -1.0f, -2.0f, -0.5f }, Point3f{ 2.0f, 1.0f, 0.5f } };
+		auto planes = getBoxPlanes();
+		planes.emplace_back( point::getNormalised( Point3f{ 1.0f, 1.0f, 1.0f } ), 8.0f );
+
+		for ( uint32_t i = 0u; i < 1001u; ++i )
+		{
+			transforms.push_back( getTransform( engine ) );
+			array.add( box, transforms.back() );
+		}
+
+		std::vector< uint8_t > visible;
+		array.cull( makeView( planes ), visible );
+		CT_REQUIRE( visible.size() == transforms.size() );
+		uint32_t visibleCount{};
+
+		for ( uint32_t i = 0u; i < visible.size(); ++i )
+		{
+			auto expected = isVisible( box, transforms[i], planes );
+			CT_EQUAL( visible[i] != 0u, expected );
+			CT_EQUAL( array.isVisible( i, makeView( planes ) ), expected );
+			visibleCount += visible[i];
+		}
+
+		// Make sure the test covers both cases.
+		CT_CHECK( visibleCount > 0u );
+		CT_CHECK( visibleCount < visible.size() );
+	}
+
+	void CastorUtilsBoundingBoxArrayTest::Ranges()
+	{
+		std::mt19937 engine;
+		BoundingBoxArray array;
+		BoundingBox box{ Point3f{ -1.0f, -1.0f, -1.0f }, Point3f{ 1.0f, 1.0f, 1.0f } };
+		auto planes = getBoxPlanes();
+
+		for ( uint32_t i = 0u; i < 103u; ++i )
+		{
+			array.add( box, getTransform( engine ) );
+		}
+
+		std::vector< uint8_t > expected;
+		array.cull( makeView( planes ), expected );
+		// Unaligned ranges, one of them reaching the end of the array.
+		std::vector< BoundingBoxArray::Range > const ranges{ { 1u, 6u }, { 10u, 1u }, { 33u, 40u }, { 98u, 5u } };
+		std::vector< uint8_t > visible;
+		array.cull( makeView( planes )
+			, makeArrayView( ranges.data(), ranges.data() + ranges.size() )
+			, visible );
+		CT_REQUIRE( visible.size() == expected.size() );
+
+		for ( uint32_t i = 0u; i < visible.size(); ++i )
+		{
+			auto inRange = std::any_of( ranges.begin()
+				, ranges.end()
+				, [i]( BoundingBoxArray::Range const & range )
+				{
+					return i >= range.first && i < range.first + range.count;
+				} );
+			CT_EQUAL( visible[i], inRange ? expected[i] : 0u );
+		}
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsBoundingBoxArrayBench::CastorUtilsBoundingBoxArrayBench()
+		: BenchCase( "CastorUtilsBoundingBoxArrayBench" )
+		, m_planes{ getBoxPlanes() }
+	{
+		std::mt19937 engine;
+		BoundingBox box{ Point3f{ -1.0f, -1.0f, -1.0f }, Point3f{ 1.0f, 1.0f, 1.0f } };
+		m_boxes.resize( BenchObjects, box );
+		m_transforms.reserve( BenchObjects );
+		m_array.reserve( BenchObjects );
+
+		for ( uint32_t i = 0u; i < BenchObjects; ++i )
+		{
+			m_transforms.push_back( getTransform( engine ) );
+			m_array.add( m_boxes[i], m_transforms[i] );
+		}
+	}
+
+	CastorUtilsBoundingBoxArrayBench::~CastorUtilsBoundingBoxArrayBench()
+	{
+	}
+
+	void CastorUtilsBoundingBoxArrayBench::Execute()
+	{
+		BENCHMARK( CullScalar, BenchCalls );
+		BENCHMARK( CullSimd, BenchCalls );
+	}
+
+	void CastorUtilsBoundingBoxArrayBench::CullScalar()
+	{
+		// What the frustum culler used to do: transform then test each box.
+		m_visible.resize( BenchObjects );
+
+		for ( uint32_t i = 0u; i < BenchObjects; ++i )
+		{
+			m_visible[i] = isVisible( m_boxes[i], m_transforms[i], m_planes ) ? 1u : 0u;
+		}
+
+		doNotOptimizeAway( m_visible.data() );
+	}
+
+	void CastorUtilsBoundingBoxArrayBench::CullSimd()
+	{
+		m_array.cull( makeView( m_planes ), m_visible );
+		doNotOptimizeAway( m_visible.data() );
+	}
+
+	//*********************************************************************************************
+}
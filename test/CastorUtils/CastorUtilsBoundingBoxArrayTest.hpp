@@ -0,0 +1,49 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_BoundingBoxArrayTest_H___
+#define ___CUT_BoundingBoxArrayTest_H___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+#include <CastorUtils/Graphics/BoundingBoxArray.hpp>
+
+namespace Testing
+{
+	class CastorUtilsBoundingBoxArrayTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsBoundingBoxArrayTest();
+		virtual ~CastorUtilsBoundingBoxArrayTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void Empty();
+		void Planes();
+		void Transformed();
+		void Ranges();
+	};
+
+	class CastorUtilsBoundingBoxArrayBench
+		: public BenchCase
+	{
+	public:
+		CastorUtilsBoundingBoxArrayBench();
+		virtual ~CastorUtilsBoundingBoxArrayBench();
+		virtual void Execute();
+
+	private:
+		void CullScalar();
+		void CullSimd();
+
+	private:
+		std::vector< castor::BoundingBox > m_boxes;
+		std::vector< castor::Matrix4x4f > m_transforms;
+		std::vector< castor::PlaneEquation > m_planes;
+		castor::BoundingBoxArray m_array;
+		std::vector< uint8_t > m_visible;
+	};
+}
+
+#endif
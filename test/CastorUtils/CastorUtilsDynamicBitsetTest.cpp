@@ -27,6 +27,8 @@ namespace Testing
 		doRegisterTest( "DynamicBitsetOrTest", std::bind( &CastorUtilsDynamicBitsetTest::orTest, this ) );
 		doRegisterTest( "DynamicBitsetXorTest", std::bind( &CastorUtilsDynamicBitsetTest::xorTest, this ) );
 		doRegisterTest( "DynamicBitsetSetTest", std::bind( &CastorUtilsDynamicBitsetTest::setTest, this ) );
+		doRegisterTest( "DynamicBitsetCountTest", std::bind( &CastorUtilsDynamicBitsetTest::countTest, this ) );
+		doRegisterTest( "DynamicBitsetForEachSetTest", std::bind( &CastorUtilsDynamicBitsetTest::forEachSetTest, this ) );
 	}
 
 	void CastorUtilsDynamicBitsetTest::sizeTest()
@@ -188,4 +190,50 @@ namespace Testing
 			CT_CHECK( !value[3] );
 		}
 	}
+
+	void CastorUtilsDynamicBitsetTest::countTest()
+	{
+		{
+			DynamicBitset value{ 70u, false };
+			CT_EQUAL( value.count(), 0u );
+			value.set( 0u );
+			value.set( 31u );
+			value.set( 32u );
+			value.set( 69u );
+			CT_EQUAL( value.count(), 4u );
+		}
+		{
+			DynamicBitset value{ 70u, true };
+			CT_EQUAL( value.count(), 70u );
+		}
+	}
+
+	void CastorUtilsDynamicBitsetTest::forEachSetTest()
+	{
+		{
+			DynamicBitset value{ 100u, false };
+			std::vector< size_t > expected{ 0u, 1u, 31u, 32u, 63u, 64u, 99u };
+
+			for ( auto bit : expected )
+			{
+				value.set( bit );
+			}
+
+			std::vector< size_t > result;
+			value.forEachSet( [&result]( size_t bit )
+				{
+					result.push_back( bit );
+				} );
+			CT_CHECK( result == expected );
+		}
+		{
+			DynamicBitset value{ 100u, false };
+			size_t calls = 0u;
+			value.forEachSet( [&calls]( size_t )
+				{
+					++calls;
+				} );
+			CT_EQUAL( calls, 0u );
+		}
+	}
 }
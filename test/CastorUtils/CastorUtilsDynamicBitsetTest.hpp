@@ -25,6 +25,8 @@ namespace Testing
 		void andTest();
 		void xorTest();
 		void setTest();
+		void countTest();
+		void forEachSetTest();
 	};
 }
 
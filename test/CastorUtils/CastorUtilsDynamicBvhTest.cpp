@@ -0,0 +1,353 @@
+#include "CastorUtilsDynamicBvhTest.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace castor;
+
+namespace Testing
+{
+	namespace
+	{
+		static uint32_t constexpr BenchObjects = 100000u;
+		static uint32_t constexpr BenchCalls = 100u;
+
+		// A 20x20x20 box centered on the origin, seen from inside.
+		std::vector< PlaneEquation > getBoxPlanes()
+		{
+			return
+			{
+				PlaneEquation{ Point3f{ 1.0f, 0.0f, 0.0f }, 10.0f },
+				PlaneEquation{ Point3f{ -1.0f, 0.0f, 0.0f }, 10.0f },
+				PlaneEquation{ Point3f{ 0.0f, 1.0f, 0.0f }, 10.0f },
+				PlaneEquation{ Point3f{ 0.0f, -1.0f, 0.0f }, 10.0f },
+				PlaneEquation{ Point3f{ 0.0f, 0.0f, 1.0f }, 10.0f },
+				PlaneEquation{ Point3f{ 0.0f, 0.0f, -1.0f }, 10.0f },
+			};
+		}
+
+		ArrayView< PlaneEquation const > makeView( std::vector< PlaneEquation > const & planes )
+		{
+			return makeArrayView( planes.data(), planes.data() + planes.size() );
+		}
+
+		BoundingBox getBox( std::mt19937 & engine
+			, float range )
+		{
+			std::uniform_real_distribution< float > position{ -range, range };
+			std::uniform_real_distribution< float > size{ 0.1f, 2.0f };
+			Point3f min{ position( engine ), position( engine ), position( engine ) };
+			return BoundingBox{ min, min + Point3f{ size( engine ), size( engine ), size( engine ) } };
+		}
+
+		bool isVisible( BoundingBox const & box
+			, std::vector< PlaneEquation > const & planes )
+		{
+			bool result = true;
+
+			for ( auto & plane : planes )
+			{
+				result = result
+					&& plane.distance( box.getPositiveVertex( plane.getNormal() ) ) >= 0.0f;
+			}
+
+			return result;
+		}
+
+		bool intersect( BoundingBox const & lhs
+			, BoundingBox const & rhs )
+		{
+			auto lhsMin = lhs.getMin();
+			auto lhsMax = lhs.getMax();
+			auto rhsMin = rhs.getMin();
+			auto rhsMax = rhs.getMax();
+			return lhsMin[0] <= rhsMax[0] && lhsMax[0] >= rhsMin[0]
+				&& lhsMin[1] <= rhsMax[1] && lhsMax[1] >= rhsMin[1]
+				&& lhsMin[2] <= rhsMax[2] && lhsMax[2] >= rhsMin[2];
+		}
+
+		// BoundingBox stores its center and dimensions, min and max don't round trip exactly.
+		bool isNear( Point3f const & lhs
+			, Point3f const & rhs )
+		{
+			return std::abs( lhs[0] - rhs[0] ) < 0.0001f
+				&& std::abs( lhs[1] - rhs[1] ) < 0.0001f
+				&& std::abs( lhs[2] - rhs[2] ) < 0.0001f;
+		}
+
+		uint32_t toIndex( void * data )
+		{
+			return uint32_t( reinterpret_cast< uintptr_t >( data ) );
+		}
+
+		void * toData( uint32_t index )
+		{
+			return reinterpret_cast< void * >( uintptr_t( index ) );
+		}
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsDynamicBvhTest::CastorUtilsDynamicBvhTest()
+		: TestCase( "CastorUtilsDynamicBvhTest" )
+	{
+	}
+
+	CastorUtilsDynamicBvhTest::~CastorUtilsDynamicBvhTest()
+	{
+	}
+
+	void CastorUtilsDynamicBvhTest::doRegisterTests()
+	{
+		doRegisterTest( "CastorUtilsDynamicBvhTest::InsertRemove", std::bind( &CastorUtilsDynamicBvhTest::InsertRemove, this ) );
+		doRegisterTest( "CastorUtilsDynamicBvhTest::Update", std::bind( &CastorUtilsDynamicBvhTest::Update, this ) );
+		doRegisterTest( "CastorUtilsDynamicBvhTest::Queries", std::bind( &CastorUtilsDynamicBvhTest::Queries, this ) );
+		doRegisterTest( "CastorUtilsDynamicBvhTest::Raycast", std::bind( &CastorUtilsDynamicBvhTest::Raycast, this ) );
+	}
+
+	void CastorUtilsDynamicBvhTest::InsertRemove()
+	{
+		std::mt19937 engine;
+		DynamicBvh bvh;
+		CT_CHECK( bvh.empty() );
+		CT_CHECK( bvh.validate() );
+		std::vector< uint32_t > proxies;
+
+		for ( uint32_t i = 0u; i < 1000u; ++i )
+		{
+			proxies.push_back( bvh.insert( getBox( engine, 50.0f ), toData( i ) ) );
+		}
+
+		CT_EQUAL( bvh.size(), 1000u );
+		CT_CHECK( bvh.validate() );
+		// The hierarchy must stay balanced enough.
+		CT_CHECK( bvh.getHeight() < 30u );
+
+		for ( uint32_t i = 0u; i < 1000u; ++i )
+		{
+			CT_EQUAL( toIndex( bvh.getData( proxies[i] ) ), i );
+		}
+
+		// Remove every other object.
+		for ( uint32_t i = 0u; i < 1000u; i += 2u )
+		{
+			bvh.remove( proxies[i] );
+		}
+
+		CT_EQUAL( bvh.size(), 500u );
+		CT_CHECK( bvh.validate() );
+		// The freed nodes are reused.
+		auto proxy = bvh.insert( getBox( engine, 50.0f ), toData( 1000u ) );
+		CT_CHECK( proxy < 2000u );
+		CT_EQUAL( toIndex( bvh.getData( proxy ) ), 1000u );
+
+		bvh.clear();
+		CT_CHECK( bvh.empty() );
+		CT_EQUAL( bvh.size(), 0u );
+	}
+
+	void CastorUtilsDynamicBvhTest::Update()
+	{
+		std::mt19937 engine;
+		DynamicBvh bvh;
+		std::vector< BoundingBox > boxes;
+		std::vector< uint32_t > proxies;
+
+		for ( uint32_t i = 0u; i < 500u; ++i )
+		{
+			boxes.push_back( getBox( engine, 50.0f ) );
+			proxies.push_back( bvh.insert( boxes.back(), toData( i ) ) );
+		}
+
+		std::uniform_real_distribution< float > offset{ -0.5f, 0.5f };
+
+		for ( uint32_t pass = 0u; pass < 10u; ++pass )
+		{
+			for ( uint32_t i = 0u; i < boxes.size(); ++i )
+			{
+				// Small moves are refitted, every tenth object teleports and is reinserted.
+				auto move = ( i % 10u == pass )
+					? getBox( engine, 50.0f ).getMin() - boxes[i].getMin()
+					: Point3f{ offset( engine ), offset( engine ), offset( engine ) };
+				boxes[i] = BoundingBox{ boxes[i].getMin() + move, boxes[i].getMax() + move };
+				bvh.update( proxies[i], boxes[i] );
+			}
+
+			CT_CHECK( bvh.validate() );
+		}
+
+		auto expected = boxes[0];
+
+		for ( uint32_t i = 0u; i < boxes.size(); ++i )
+		{
+			CT_CHECK( isNear( bvh.getBoundingBox( proxies[i] ).getMin(), boxes[i].getMin() ) );
+			CT_CHECK( isNear( bvh.getBoundingBox( proxies[i] ).getMax(), boxes[i].getMax() ) );
+			expected = expected.getUnion( boxes[i] );
+		}
+
+		// The root box is tight.
+		CT_CHECK( isNear( bvh.getBoundingBox().getMin(), expected.getMin() ) );
+		CT_CHECK( isNear( bvh.getBoundingBox().getMax(), expected.getMax() ) );
+	}
+
+	void CastorUtilsDynamicBvhTest::Queries()
+	{
+		std::mt19937 engine;
+		DynamicBvh bvh;
+		std::vector< BoundingBox > boxes;
+
+		for ( uint32_t i = 0u; i < 2000u; ++i )
+		{
+			boxes.push_back( getBox( engine, 30.0f ) );
+			bvh.insert( boxes.back(), toData( i ) );
+		}
+
+		auto planes = getBoxPlanes();
+		planes.emplace_back( point::getNormalised( Point3f{ 1.0f, 1.0f, 1.0f } ), 8.0f );
+		std::vector< uint8_t > found( boxes.size(), 0u );
+		bvh.query( makeView( planes )
+			, [&found]( void * data )
+			{
+				++found[toIndex( data )];
+			} );
+		uint32_t visibleCount{};
+
+		for ( uint32_t i = 0u; i < boxes.size(); ++i )
+		{
+			auto expected = isVisible( boxes[i], planes );
+			CT_EQUAL( found[i], expected ? 1u : 0u );
+			visibleCount += found[i];
+		}
+
+		// Make sure the test covers both cases.
+		CT_CHECK( visibleCount > 0u );
+		CT_CHECK( visibleCount < boxes.size() );
+
+		BoundingBox area{ Point3f{ -5.0f, -5.0f, -5.0f }, Point3f{ 10.0f, 5.0f, 5.0f } };
+		std::fill( found.begin(), found.end(), 0u );
+		bvh.query( area
+			, [&found]( void * data )
+			{
+				++found[toIndex( data )];
+			} );
+
+		for ( uint32_t i = 0u; i < boxes.size(); ++i )
+		{
+			CT_EQUAL( found[i], intersect( boxes[i], area ) ? 1u : 0u );
+		}
+	}
+
+	void CastorUtilsDynamicBvhTest::Raycast()
+	{
+		DynamicBvh bvh;
+		// A row of unit boxes along X, at x = 0, 5, 10, ...
+		for ( uint32_t i = 0u; i < 10u; ++i )
+		{
+			auto x = float( i ) * 5.0f;
+			bvh.insert( BoundingBox{ Point3f{ x, 0.0f, 0.0f }, Point3f{ x + 1.0f, 1.0f, 1.0f } }
+				, toData( i ) );
+		}
+
+		// Nearest hit, from the left.
+		uint32_t nearest = ~0u;
+		float nearestDistance = std::numeric_limits< float >::max();
+		bvh.raycast( Point3f{ -10.0f, 0.5f, 0.5f }
+			, Point3f{ 1.0f, 0.0f, 0.0f }
+			, 1000.0f
+			, [&nearest, &nearestDistance]( void * data, float distance )
+			{
+				if ( distance < nearestDistance )
+				{
+					nearestDistance = distance;
+					nearest = toIndex( data );
+				}
+
+				return nearestDistance;
+			} );
+		CT_EQUAL( nearest, 0u );
+		CT_EQUAL( nearestDistance, 10.0f );
+
+		// All hits within the distance.
+		std::vector< uint32_t > hits;
+		bvh.raycast( Point3f{ 12.5f, 0.5f, 0.5f }
+			, Point3f{ -1.0f, 0.0f, 0.0f }
+			, 8.0f
+			, [&hits]( void * data, float )
+			{
+				hits.push_back( toIndex( data ) );
+				return 8.0f;
+			} );
+		std::sort( hits.begin(), hits.end() );
+		CT_REQUIRE( hits.size() == 2u );
+		CT_EQUAL( hits[0], 1u );
+		CT_EQUAL( hits[1], 2u );
+
+		// Miss.
+		hits.clear();
+		bvh.raycast( Point3f{ -10.0f, 2.5f, 0.5f }
+			, Point3f{ 1.0f, 0.0f, 0.0f }
+			, 1000.0f
+			, [&hits]( void * data, float )
+			{
+				hits.push_back( toIndex( data ) );
+				return 1000.0f;
+			} );
+		CT_CHECK( hits.empty() );
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsDynamicBvhBench::CastorUtilsDynamicBvhBench()
+		: BenchCase( "CastorUtilsDynamicBvhBench" )
+		, m_planes{ getBoxPlanes() }
+	{
+		std::mt19937 engine;
+		m_boxes.reserve( BenchObjects );
+		m_visible.reserve( BenchObjects );
+
+		for ( uint32_t i = 0u; i < BenchObjects; ++i )
+		{
+			m_boxes.push_back( getBox( engine, 200.0f ) );
+			m_bvh.insert( m_boxes.back(), toData( i ) );
+		}
+	}
+
+	CastorUtilsDynamicBvhBench::~CastorUtilsDynamicBvhBench()
+	{
+	}
+
+	void CastorUtilsDynamicBvhBench::Execute()
+	{
+		BENCHMARK( QueryLinear, BenchCalls );
+		BENCHMARK( QueryBvh, BenchCalls );
+	}
+
+	void CastorUtilsDynamicBvhBench::QueryLinear()
+	{
+		m_visible.clear();
+
+		for ( uint32_t i = 0u; i < BenchObjects; ++i )
+		{
+			if ( isVisible( m_boxes[i], m_planes ) )
+			{
+				m_visible.push_back( i );
+			}
+		}
+
+		doNotOptimizeAway( m_visible.data() );
+	}
+
+	void CastorUtilsDynamicBvhBench::QueryBvh()
+	{
+		m_visible.clear();
+		m_bvh.query( makeView( m_planes )
+			, [this]( void * data )
+			{
+				m_visible.push_back( toIndex( data ) );
+			} );
+		doNotOptimizeAway( m_visible.data() );
+	}
+
+	//*********************************************************************************************
+}
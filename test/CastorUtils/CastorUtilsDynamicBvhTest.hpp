@@ -0,0 +1,48 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_DynamicBvhTest_H___
+#define ___CUT_DynamicBvhTest_H___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+#include <CastorUtils/Graphics/DynamicBvh.hpp>
+
+namespace Testing
+{
+	class CastorUtilsDynamicBvhTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsDynamicBvhTest();
+		virtual ~CastorUtilsDynamicBvhTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void InsertRemove();
+		void Update();
+		void Queries();
+		void Raycast();
+	};
+
+	class CastorUtilsDynamicBvhBench
+		: public BenchCase
+	{
+	public:
+		CastorUtilsDynamicBvhBench();
+		virtual ~CastorUtilsDynamicBvhBench();
+		virtual void Execute();
+
+	private:
+		void QueryLinear();
+		void QueryBvh();
+
+	private:
+		std::vector< castor::BoundingBox > m_boxes;
+		std::vector< castor::PlaneEquation > m_planes;
+		castor::DynamicBvh m_bvh;
+		std::vector< uint32_t > m_visible;
+	};
+}
+
+#endif
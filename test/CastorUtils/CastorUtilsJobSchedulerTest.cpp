@@ -0,0 +1,242 @@
+#include "CastorUtilsJobSchedulerTest.hpp"
+
+#include <atomic>
+#include <stdexcept>
+
+using namespace castor;
+
+namespace Testing
+{
+	namespace
+	{
+		static uint32_t constexpr ThroughputJobs = 1000u;
+		static uint32_t constexpr LatencyCalls = 1000u;
+		static uint32_t constexpr ThroughputCalls = 10u;
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsJobSchedulerTest::CastorUtilsJobSchedulerTest()
+		: TestCase( "CastorUtilsJobSchedulerTest" )
+	{
+	}
+
+	CastorUtilsJobSchedulerTest::~CastorUtilsJobSchedulerTest()
+	{
+	}
+
+	void CastorUtilsJobSchedulerTest::doRegisterTests()
+	{
+		doRegisterTest( "CastorUtilsJobSchedulerTest::SingleJob", std::bind( &CastorUtilsJobSchedulerTest::SingleJob, this ) );
+		doRegisterTest( "CastorUtilsJobSchedulerTest::Counter", std::bind( &CastorUtilsJobSchedulerTest::Counter, this ) );
+		doRegisterTest( "CastorUtilsJobSchedulerTest::Overload", std::bind( &CastorUtilsJobSchedulerTest::Overload, this ) );
+		doRegisterTest( "CastorUtilsJobSchedulerTest::NestedJobs", std::bind( &CastorUtilsJobSchedulerTest::NestedJobs, this ) );
+		doRegisterTest( "CastorUtilsJobSchedulerTest::ThrowingJob", std::bind( &CastorUtilsJobSchedulerTest::ThrowingJob, this ) );
+	}
+
+	void CastorUtilsJobSchedulerTest::SingleJob()
+	{
+		constexpr size_t count = 1000000u;
+		JobScheduler scheduler( 5u );
+		std::vector< size_t > data;
+		scheduler.pushJob( [&data, count]()
+		{
+			while ( data.size() < count )
+			{
+				data.push_back( data.size() );
+			}
+		} );
+
+		scheduler.waitAll();
+		CT_CHECK( scheduler.isIdle() );
+		CT_CHECK( data.size() == count );
+	}
+
+	void CastorUtilsJobSchedulerTest::Counter()
+	{
+		constexpr size_t count = 100000u;
+		JobScheduler scheduler( 4u );
+		std::atomic_int first{ 0 };
+		std::atomic_int second{ 0 };
+		JobCounter firstCounter;
+		JobCounter secondCounter;
+
+		auto job = []( std::atomic_int & value )
+		{
+			size_t i = 0;
+
+			while ( i++ < count )
+			{
+				value++;
+			}
+		};
+
+		for ( auto i = 0u; i < 5u; ++i )
+		{
+			scheduler.pushJob( [&job, &first](){ job( first ); }, &firstCounter );
+			scheduler.pushJob( [&job, &second](){ job( second ); }, &secondCounter );
+		}
+
+		scheduler.wait( firstCounter );
+		CT_CHECK( firstCounter.isDone() );
+		CT_CHECK( first == count * 5u );
+		scheduler.wait( secondCounter );
+		CT_CHECK( secondCounter.isDone() );
+		CT_CHECK( second == count * 5u );
+	}
+
+	void CastorUtilsJobSchedulerTest::Overload()
+	{
+		constexpr size_t jobs = 10000u;
+		JobScheduler scheduler( 3u );
+		std::atomic_int value{ 0 };
+		JobCounter counter;
+
+		for ( auto i = 0u; i < jobs; ++i )
+		{
+			scheduler.pushJob( [&value]()
+				{
+					value++;
+				}
+				, &counter );
+		}
+
+		scheduler.wait( counter );
+		CT_CHECK( counter.getPending() == 0u );
+		CT_CHECK( value == jobs );
+	}
+
+	void CastorUtilsJobSchedulerTest::NestedJobs()
+	{
+		constexpr size_t parents = 16u;
+		constexpr size_t children = 64u;
+		JobScheduler scheduler( 2u );
+		std::atomic_int value{ 0 };
+		JobCounter counter;
+
+		for ( auto i = 0u; i < parents; ++i )
+		{
+			scheduler.pushJob( [&scheduler, &value]()
+				{
+					JobCounter childCounter;
+
+					for ( auto j = 0u; j < children; ++j )
+					{
+						scheduler.pushJob( [&value]()
+							{
+								value++;
+							}
+							, &childCounter );
+					}
+
+					scheduler.wait( childCounter );
+				}
+				, &counter );
+		}
+
+		scheduler.wait( counter );
+		CT_CHECK( value == parents * children );
+	}
+
+	void CastorUtilsJobSchedulerTest::ThrowingJob()
+	{
+		JobScheduler scheduler( 2u );
+		std::atomic_int value{ 0 };
+		JobCounter counter;
+		scheduler.pushJob( []()
+			{
+				throw std::runtime_error{ "Throwing job" };
+			}
+			, &counter );
+		scheduler.pushJob( [&value]()
+			{
+				value++;
+			}
+			, &counter );
+
+		scheduler.wait( counter );
+		CT_CHECK( counter.isDone() );
+		CT_CHECK( value == 1 );
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsJobSchedulerBench::CastorUtilsJobSchedulerBench()
+		: BenchCase( "CastorUtilsJobSchedulerBench" )
+		, m_pool{ 4u }
+		, m_scheduler{ 4u }
+	{
+	}
+
+	CastorUtilsJobSchedulerBench::~CastorUtilsJobSchedulerBench()
+	{
+	}
+
+	void CastorUtilsJobSchedulerBench::Execute()
+	{
+		BENCHMARK( LatencyThreadPool, LatencyCalls );
+		BENCHMARK( LatencyJobScheduler, LatencyCalls );
+		BENCHMARK( ThroughputThreadPool, ThroughputCalls );
+		BENCHMARK( ThroughputJobScheduler, ThroughputCalls );
+	}
+
+	void CastorUtilsJobSchedulerBench::LatencyThreadPool()
+	{
+		std::atomic_int value{ 0 };
+		m_pool.pushJob( [&value]()
+			{
+				value++;
+			} );
+		m_pool.waitAll( Milliseconds::max() );
+		doNotOptimizeAway( value.load() );
+	}
+
+	void CastorUtilsJobSchedulerBench::LatencyJobScheduler()
+	{
+		std::atomic_int value{ 0 };
+		JobCounter counter;
+		m_scheduler.pushJob( [&value]()
+			{
+				value++;
+			}
+			, &counter );
+		m_scheduler.wait( counter );
+		doNotOptimizeAway( value.load() );
+	}
+
+	void CastorUtilsJobSchedulerBench::ThroughputThreadPool()
+	{
+		std::atomic_int value{ 0 };
+
+		for ( auto i = 0u; i < ThroughputJobs; ++i )
+		{
+			m_pool.pushJob( [&value]()
+				{
+					value++;
+				} );
+		}
+
+		m_pool.waitAll( Milliseconds::max() );
+		doNotOptimizeAway( value.load() );
+	}
+
+	void CastorUtilsJobSchedulerBench::ThroughputJobScheduler()
+	{
+		std::atomic_int value{ 0 };
+		JobCounter counter;
+
+		for ( auto i = 0u; i < ThroughputJobs; ++i )
+		{
+			m_scheduler.pushJob( [&value]()
+				{
+					value++;
+				}
+				, &counter );
+		}
+
+		m_scheduler.wait( counter );
+		doNotOptimizeAway( value.load() );
+	}
+
+	//*********************************************************************************************
+}
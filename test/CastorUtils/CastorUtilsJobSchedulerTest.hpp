@@ -0,0 +1,50 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_JobSchedulerTest_H___
+#define ___CUT_JobSchedulerTest_H___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+#include <CastorUtils/Multithreading/JobScheduler.hpp>
+#include <CastorUtils/Multithreading/ThreadPool.hpp>
+
+namespace Testing
+{
+	class CastorUtilsJobSchedulerTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsJobSchedulerTest();
+		virtual ~CastorUtilsJobSchedulerTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void SingleJob();
+		void Counter();
+		void Overload();
+		void NestedJobs();
+		void ThrowingJob();
+	};
+
+	class CastorUtilsJobSchedulerBench
+		: public BenchCase
+	{
+	public:
+		CastorUtilsJobSchedulerBench();
+		virtual ~CastorUtilsJobSchedulerBench();
+		virtual void Execute();
+
+	private:
+		void LatencyThreadPool();
+		void LatencyJobScheduler();
+		void ThroughputThreadPool();
+		void ThroughputJobScheduler();
+
+	private:
+		castor::ThreadPool m_pool;
+		castor::JobScheduler m_scheduler;
+	};
+}
+
+#endif
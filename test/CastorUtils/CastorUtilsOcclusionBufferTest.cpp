@@ -0,0 +1,232 @@
+#include "CastorUtilsOcclusionBufferTest.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace castor;
+
+namespace Testing
+{
+	namespace
+	{
+		static uint32_t constexpr BenchOccluders = 1000u;
+		static uint32_t constexpr BenchObjects = 10000u;
+		static uint32_t constexpr BenchCalls = 100u;
+
+		// With an identity transform, the positions are directly in clip space,
+		// and the depths are the Z coordinates.
+		Matrix4x4f const Identity{ 1.0f };
+
+		void addQuad( std::vector< Point3f > & positions
+			, std::vector< uint32_t > & indices
+			, Point3f const & min
+			, Point3f const & max )
+		{
+			auto base = uint32_t( positions.size() );
+			positions.push_back( Point3f{ min[0], min[1], min[2] } );
+			positions.push_back( Point3f{ max[0], min[1], max[2] } );
+			positions.push_back( Point3f{ max[0], max[1], max[2] } );
+			positions.push_back( Point3f{ min[0], max[1], min[2] } );
+			indices.insert( indices.end(), { base + 0u, base + 1u, base + 2u, base + 0u, base + 2u, base + 3u } );
+		}
+
+		uint32_t rasteriseQuad( OcclusionBuffer & buffer
+			, Point3f const & min
+			, Point3f const & max )
+		{
+			std::vector< Point3f > positions;
+			std::vector< uint32_t > indices;
+			addQuad( positions, indices, min, max );
+			std::vector< Point3f > const & cpositions = positions;
+			std::vector< uint32_t > const & cindices = indices;
+			auto result = buffer.rasterise( makeArrayView( cpositions.data(), cpositions.data() + cpositions.size() )
+				, makeArrayView( cindices.data(), cindices.data() + cindices.size() )
+				, Identity );
+			buffer.buildHierarchy();
+			return result;
+		}
+
+		bool isVisible( OcclusionBuffer const & buffer
+			, Point3f const & min
+			, Point3f const & max )
+		{
+			return buffer.isVisible( BoundingBox{ min, max }, Identity );
+		}
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsOcclusionBufferTest::CastorUtilsOcclusionBufferTest()
+		: TestCase( "CastorUtilsOcclusionBufferTest" )
+	{
+	}
+
+	CastorUtilsOcclusionBufferTest::~CastorUtilsOcclusionBufferTest()
+	{
+	}
+
+	void CastorUtilsOcclusionBufferTest::doRegisterTests()
+	{
+		doRegisterTest( "CastorUtilsOcclusionBufferTest::Empty", std::bind( &CastorUtilsOcclusionBufferTest::Empty, this ) );
+		doRegisterTest( "CastorUtilsOcclusionBufferTest::FullScreenOccluder", std::bind( &CastorUtilsOcclusionBufferTest::FullScreenOccluder, this ) );
+		doRegisterTest( "CastorUtilsOcclusionBufferTest::PartialOccluder", std::bind( &CastorUtilsOcclusionBufferTest::PartialOccluder, this ) );
+		doRegisterTest( "CastorUtilsOcclusionBufferTest::DepthInterpolation", std::bind( &CastorUtilsOcclusionBufferTest::DepthInterpolation, this ) );
+		doRegisterTest( "CastorUtilsOcclusionBufferTest::NearPlane", std::bind( &CastorUtilsOcclusionBufferTest::NearPlane, this ) );
+	}
+
+	void CastorUtilsOcclusionBufferTest::Empty()
+	{
+		OcclusionBuffer buffer{ 64u, 32u };
+		CT_EQUAL( buffer.getWidth(), 64u );
+		CT_EQUAL( buffer.getHeight(), 32u );
+		// 64x32, 32x16, 16x8, 8x4, 4x2, 2x1, 1x1.
+		CT_EQUAL( buffer.getLevelCount(), 7u );
+		buffer.buildHierarchy();
+		CT_CHECK( isVisible( buffer, Point3f{ -0.5f, -0.5f, 0.5f }, Point3f{ 0.5f, 0.5f, 0.6f } ) );
+		CT_CHECK( isVisible( buffer, Point3f{ -0.01f, -0.01f, 0.99f }, Point3f{ 0.01f, 0.01f, 1.0f } ) );
+	}
+
+	void CastorUtilsOcclusionBufferTest::FullScreenOccluder()
+	{
+		OcclusionBuffer buffer{ 64u, 32u };
+		CT_EQUAL( rasteriseQuad( buffer, Point3f{ -1.0f, -1.0f, 0.5f }, Point3f{ 1.0f, 1.0f, 0.5f } ), 2u );
+
+		for ( uint32_t y = 0u; y < buffer.getHeight(); ++y )
+		{
+			for ( uint32_t x = 0u; x < buffer.getWidth(); ++x )
+			{
+				CT_CHECK( std::abs( buffer.getDepth( x, y ) - 0.5f ) < 0.0001f );
+			}
+		}
+
+		// Behind.
+		CT_CHECK( !isVisible( buffer, Point3f{ -0.5f, -0.5f, 0.6f }, Point3f{ 0.5f, 0.5f, 0.7f } ) );
+		CT_CHECK( !isVisible( buffer, Point3f{ 0.9f, 0.9f, 0.6f }, Point3f{ 0.95f, 0.95f, 0.7f } ) );
+		CT_CHECK( !isVisible( buffer, Point3f{ -1.0f, -1.0f, 0.6f }, Point3f{ 1.0f, 1.0f, 0.7f } ) );
+		// In front.
+		CT_CHECK( isVisible( buffer, Point3f{ -0.5f, -0.5f, 0.2f }, Point3f{ 0.5f, 0.5f, 0.3f } ) );
+		// Crossing the occluder.
+		CT_CHECK( isVisible( buffer, Point3f{ -0.5f, -0.5f, 0.4f }, Point3f{ 0.5f, 0.5f, 0.6f } ) );
+
+		buffer.clear();
+		buffer.buildHierarchy();
+		CT_CHECK( isVisible( buffer, Point3f{ -0.5f, -0.5f, 0.6f }, Point3f{ 0.5f, 0.5f, 0.7f } ) );
+	}
+
+	void CastorUtilsOcclusionBufferTest::PartialOccluder()
+	{
+		OcclusionBuffer buffer{ 64u, 32u };
+		rasteriseQuad( buffer, Point3f{ -1.0f, -1.0f, 0.5f }, Point3f{ 0.0f, 1.0f, 0.5f } );
+		// Behind the occluder.
+		CT_CHECK( !isVisible( buffer, Point3f{ -0.9f, -0.5f, 0.6f }, Point3f{ -0.1f, 0.5f, 0.7f } ) );
+		// Beside the occluder.
+		CT_CHECK( isVisible( buffer, Point3f{ 0.1f, -0.5f, 0.6f }, Point3f{ 0.9f, 0.5f, 0.7f } ) );
+		// Partly behind the occluder.
+		CT_CHECK( isVisible( buffer, Point3f{ -0.5f, -0.5f, 0.6f }, Point3f{ 0.5f, 0.5f, 0.7f } ) );
+		CT_CHECK( isVisible( buffer, Point3f{ -0.2f, -0.2f, 0.6f }, Point3f{ 0.2f, 0.2f, 0.7f } ) );
+		// Partly off screen.
+		CT_CHECK( !isVisible( buffer, Point3f{ -1.5f, -0.5f, 0.6f }, Point3f{ -0.5f, 0.5f, 0.7f } ) );
+		CT_CHECK( isVisible( buffer, Point3f{ 0.5f, -0.5f, 0.6f }, Point3f{ 1.5f, 0.5f, 0.7f } ) );
+	}
+
+	void CastorUtilsOcclusionBufferTest::DepthInterpolation()
+	{
+		OcclusionBuffer buffer{ 64u, 32u };
+		// Depth goes from 0.2 on the left side to 0.8 on the right side.
+		rasteriseQuad( buffer, Point3f{ -1.0f, -1.0f, 0.2f }, Point3f{ 1.0f, 1.0f, 0.8f } );
+
+		for ( uint32_t x = 0u; x < buffer.getWidth(); ++x )
+		{
+			auto ndc = ( float( x ) + 0.5f ) / float( buffer.getWidth() ) * 2.0f - 1.0f;
+			CT_CHECK( std::abs( buffer.getDepth( x, 16u ) - ( 0.5f + 0.3f * ndc ) ) < 0.0001f );
+		}
+
+		// Behind the nearest part of the occluder only.
+		CT_CHECK( !isVisible( buffer, Point3f{ -0.9f, -0.1f, 0.5f }, Point3f{ -0.8f, 0.1f, 0.6f } ) );
+		CT_CHECK( isVisible( buffer, Point3f{ 0.8f, -0.1f, 0.5f }, Point3f{ 0.9f, 0.1f, 0.6f } ) );
+	}
+
+	void CastorUtilsOcclusionBufferTest::NearPlane()
+	{
+		OcclusionBuffer buffer{ 64u, 32u };
+		// Crossing the near plane, ignored.
+		CT_EQUAL( rasteriseQuad( buffer, Point3f{ -1.0f, -1.0f, -0.5f }, Point3f{ 1.0f, 1.0f, 0.5f } ), 0u );
+		CT_CHECK( isVisible( buffer, Point3f{ -0.5f, -0.5f, 0.6f }, Point3f{ 0.5f, 0.5f, 0.7f } ) );
+
+		rasteriseQuad( buffer, Point3f{ -1.0f, -1.0f, 0.5f }, Point3f{ 1.0f, 1.0f, 0.5f } );
+		// A box crossing the near plane is always visible.
+		CT_CHECK( isVisible( buffer, Point3f{ -0.5f, -0.5f, -0.1f }, Point3f{ 0.5f, 0.5f, 0.7f } ) );
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsOcclusionBufferBench::CastorUtilsOcclusionBufferBench()
+		: BenchCase( "CastorUtilsOcclusionBufferBench" )
+		, m_buffer{ 256u, 128u }
+		, m_transform{ 1.0f }
+	{
+		std::mt19937 engine;
+		std::uniform_real_distribution< float > position{ -1.0f, 1.0f };
+		std::uniform_real_distribution< float > size{ 0.01f, 0.2f };
+		std::uniform_real_distribution< float > depth{ 0.1f, 0.9f };
+
+		for ( uint32_t i = 0u; i < BenchOccluders; ++i )
+		{
+			Point3f min{ position( engine ), position( engine ), depth( engine ) };
+			addQuad( m_positions
+				, m_indices
+				, min
+				, min + Point3f{ size( engine ), size( engine ), 0.0f } );
+		}
+
+		m_boxes.reserve( BenchObjects );
+		m_visible.reserve( BenchObjects );
+
+		for ( uint32_t i = 0u; i < BenchObjects; ++i )
+		{
+			Point3f min{ position( engine ), position( engine ), depth( engine ) };
+			m_boxes.push_back( BoundingBox{ min, min + Point3f{ size( engine ), size( engine ), 0.05f } } );
+		}
+
+		Rasterise();
+	}
+
+	CastorUtilsOcclusionBufferBench::~CastorUtilsOcclusionBufferBench()
+	{
+	}
+
+	void CastorUtilsOcclusionBufferBench::Execute()
+	{
+		BENCHMARK( Rasterise, BenchCalls );
+		BENCHMARK( Test, BenchCalls );
+	}
+
+	void CastorUtilsOcclusionBufferBench::Rasterise()
+	{
+		m_buffer.clear();
+		auto const & positions = m_positions;
+		auto const & indices = m_indices;
+		m_buffer.rasterise( makeArrayView( positions.data(), positions.data() + positions.size() )
+			, makeArrayView( indices.data(), indices.data() + indices.size() )
+			, m_transform );
+		m_buffer.buildHierarchy();
+	}
+
+	void CastorUtilsOcclusionBufferBench::Test()
+	{
+		m_visible.clear();
+
+		for ( uint32_t i = 0u; i < BenchObjects; ++i )
+		{
+			if ( m_buffer.isVisible( m_boxes[i], m_transform ) )
+			{
+				m_visible.push_back( i );
+			}
+		}
+
+		doNotOptimizeAway( m_visible.data() );
+	}
+
+	//*********************************************************************************************
+}
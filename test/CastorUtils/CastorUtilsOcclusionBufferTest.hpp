@@ -0,0 +1,51 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_OcclusionBufferTest_H___
+#define ___CUT_OcclusionBufferTest_H___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+#include <CastorUtils/Graphics/OcclusionBuffer.hpp>
+
+namespace Testing
+{
+	class CastorUtilsOcclusionBufferTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsOcclusionBufferTest();
+		virtual ~CastorUtilsOcclusionBufferTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void Empty();
+		void FullScreenOccluder();
+		void PartialOccluder();
+		void DepthInterpolation();
+		void NearPlane();
+	};
+
+	class CastorUtilsOcclusionBufferBench
+		: public BenchCase
+	{
+	public:
+		CastorUtilsOcclusionBufferBench();
+		virtual ~CastorUtilsOcclusionBufferBench();
+		virtual void Execute();
+
+	private:
+		void Rasterise();
+		void Test();
+
+	private:
+		castor::OcclusionBuffer m_buffer;
+		castor::Matrix4x4f m_transform;
+		std::vector< castor::Point3f > m_positions;
+		std::vector< uint32_t > m_indices;
+		std::vector< castor::BoundingBox > m_boxes;
+		std::vector< uint32_t > m_visible;
+	};
+}
+
+#endif
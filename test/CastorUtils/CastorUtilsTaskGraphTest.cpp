@@ -0,0 +1,112 @@
+#include "CastorUtilsTaskGraphTest.hpp"
+
+#include <CastorUtils/Multithreading/ParallelFor.hpp>
+#include <CastorUtils/Multithreading/TaskGraph.hpp>
+
+#include <atomic>
+#include <numeric>
+
+using namespace castor;
+
+namespace Testing
+{
+	CastorUtilsTaskGraphTest::CastorUtilsTaskGraphTest()
+		: TestCase( "CastorUtilsTaskGraphTest" )
+	{
+	}
+
+	CastorUtilsTaskGraphTest::~CastorUtilsTaskGraphTest()
+	{
+	}
+
+	void CastorUtilsTaskGraphTest::doRegisterTests()
+	{
+		doRegisterTest( "CastorUtilsTaskGraphTest::Dependencies", std::bind( &CastorUtilsTaskGraphTest::Dependencies, this ) );
+		doRegisterTest( "CastorUtilsTaskGraphTest::Rerun", std::bind( &CastorUtilsTaskGraphTest::Rerun, this ) );
+		doRegisterTest( "CastorUtilsTaskGraphTest::ParallelFor", std::bind( &CastorUtilsTaskGraphTest::ParallelFor, this ) );
+	}
+
+	void CastorUtilsTaskGraphTest::Dependencies()
+	{
+		JobScheduler scheduler( 4u );
+		TaskGraph graph;
+		int a = 0;
+		int b = 0;
+		int c = 0;
+		int d = 0;
+		auto ta = graph.add( [&a](){ a = 1; } );
+		auto tb = graph.add( [&a, &b](){ b = a + 1; }, { ta } );
+		auto tc = graph.add( [&a, &c](){ c = a + 2; }, { ta } );
+		graph.add( [&b, &c, &d](){ d = b * c; }, { tb, tc } );
+		CT_CHECK( graph.size() == 4u );
+
+		graph.run( scheduler );
+		CT_CHECK( a == 1 );
+		CT_CHECK( b == 2 );
+		CT_CHECK( c == 3 );
+		CT_CHECK( d == 6 );
+
+		a = b = c = d = 0;
+		graph.runSerial();
+		CT_CHECK( d == 6 );
+	}
+
+	void CastorUtilsTaskGraphTest::Rerun()
+	{
+		JobScheduler scheduler( 2u );
+		TaskGraph graph;
+		std::atomic_int value{ 0 };
+		std::vector< TaskGraph::TaskId > roots;
+
+		for ( auto i = 0u; i < 16u; ++i )
+		{
+			roots.push_back( graph.add( [&value](){ value++; } ) );
+		}
+
+		graph.add( [&value](){ value = value * 2; }, roots );
+
+		for ( auto i = 0u; i < 10u; ++i )
+		{
+			value = 0;
+			graph.run( scheduler );
+			CT_CHECK( value == 32 );
+		}
+	}
+
+	void CastorUtilsTaskGraphTest::ParallelFor()
+	{
+		JobScheduler scheduler( 4u );
+		std::vector< uint32_t > data( 10007u );
+		parallelFor( scheduler
+			, size_t{ 0u }
+			, data.size()
+			, [&data]( size_t index )
+			{
+				data[index] = uint32_t( index );
+			}
+			, size_t{ 64u } );
+
+		bool valid = true;
+
+		for ( size_t i = 0u; i < data.size(); ++i )
+		{
+			valid = valid && data[i] == uint32_t( i );
+		}
+
+		CT_CHECK( valid );
+
+		std::atomic< uint64_t > sum{ 0u };
+		parallelForEach( scheduler
+			, data.begin()
+			, data.end()
+			, [&sum]( uint32_t value )
+			{
+				sum += value;
+			} );
+		CT_CHECK( sum == std::accumulate( data.begin(), data.end(), uint64_t{ 0u } ) );
+
+		std::atomic_int count{ 0 };
+		parallelFor( scheduler, 5, 5, [&count]( int ){ count++; } );
+		CT_CHECK( count == 0 );
+	}
+}
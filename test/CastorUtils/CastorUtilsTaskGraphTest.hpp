@@ -0,0 +1,26 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_TaskGraphTest_H___
+#define ___CUT_TaskGraphTest_H___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+namespace Testing
+{
+	class CastorUtilsTaskGraphTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsTaskGraphTest();
+		virtual ~CastorUtilsTaskGraphTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void Dependencies();
+		void Rerun();
+		void ParallelFor();
+	};
+}
+
+#endif
@@ -0,0 +1,389 @@
+#include "CastorUtilsTransformHierarchyTest.hpp"
+
+#include <CastorUtils/Math/TransformationMatrix.hpp>
+
+#include <cmath>
+#include <random>
+
+using namespace castor;
+
+namespace Testing
+{
+	namespace
+	{
+		static uint32_t constexpr BenchNodes = 10000u;
+		static uint32_t constexpr BenchMoved = 100u;
+		static uint32_t constexpr BenchCalls = 100u;
+
+		bool isNear( Matrix4x4f const & lhs
+			, Matrix4x4f const & rhs )
+		{
+			auto l = lhs.constPtr();
+			auto r = rhs.constPtr();
+
+			for ( uint32_t i = 0u; i < 16u; ++i )
+			{
+				if ( std::abs( l[i] - r[i] ) > 0.0001f )
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		bool isNear( Point3f const & lhs
+			, Point3f const & rhs )
+		{
+			return std::abs( lhs[0] - rhs[0] ) < 0.0001f
+				&& std::abs( lhs[1] - rhs[1] ) < 0.0001f
+				&& std::abs( lhs[2] - rhs[2] ) < 0.0001f;
+		}
+
+		Matrix4x4f getTransform( Point3f const & position
+			, Quaternion const & orientation
+			, Point3f const & scale )
+		{
+			Matrix4x4f result;
+			matrix::setTransform( result, position, scale, orientation );
+			return result;
+		}
+
+		bool isChanged( TransformHierarchy const & hierarchy
+			, uint32_t index )
+		{
+			auto changed = hierarchy.getChanged();
+			return std::find( changed.begin(), changed.end(), index ) != changed.end();
+		}
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsTransformHierarchyTest::CastorUtilsTransformHierarchyTest()
+		: TestCase( "CastorUtilsTransformHierarchyTest" )
+	{
+	}
+
+	CastorUtilsTransformHierarchyTest::~CastorUtilsTransformHierarchyTest()
+	{
+	}
+
+	void CastorUtilsTransformHierarchyTest::doRegisterTests()
+	{
+		doRegisterTest( "CastorUtilsTransformHierarchyTest::Multiply", std::bind( &CastorUtilsTransformHierarchyTest::Multiply, this ) );
+		doRegisterTest( "CastorUtilsTransformHierarchyTest::Root", std::bind( &CastorUtilsTransformHierarchyTest::Root, this ) );
+		doRegisterTest( "CastorUtilsTransformHierarchyTest::Chain", std::bind( &CastorUtilsTransformHierarchyTest::Chain, this ) );
+		doRegisterTest( "CastorUtilsTransformHierarchyTest::Reparent", std::bind( &CastorUtilsTransformHierarchyTest::Reparent, this ) );
+		doRegisterTest( "CastorUtilsTransformHierarchyTest::Remove", std::bind( &CastorUtilsTransformHierarchyTest::Remove, this ) );
+		doRegisterTest( "CastorUtilsTransformHierarchyTest::OnlyChanged", std::bind( &CastorUtilsTransformHierarchyTest::OnlyChanged, this ) );
+		doRegisterTest( "CastorUtilsTransformHierarchyTest::Incremental", std::bind( &CastorUtilsTransformHierarchyTest::Incremental, this ) );
+	}
+
+	void CastorUtilsTransformHierarchyTest::Multiply()
+	{
+		std::random_device device;
+		std::default_random_engine engine{ device() };
+		std::uniform_real_distribution< float > distribution{ -10.0f, 10.0f };
+
+		for ( uint32_t i = 0u; i < 100u; ++i )
+		{
+			Matrix4x4f lhs;
+			Matrix4x4f rhs;
+
+			for ( uint32_t j = 0u; j < 16u; ++j )
+			{
+				lhs.ptr()[j] = distribution( engine );
+				rhs.ptr()[j] = distribution( engine );
+			}
+
+			Matrix4x4f result;
+			TransformHierarchy::multiply( lhs, rhs, result );
+			auto expected = lhs * rhs;
+			CT_CHECK( isNear( result, expected ) );
+			// In place, in the right hand side.
+			TransformHierarchy::multiply( lhs, rhs, rhs );
+			CT_CHECK( isNear( rhs, expected ) );
+		}
+	}
+
+	void CastorUtilsTransformHierarchyTest::Root()
+	{
+		TransformHierarchy hierarchy;
+		CT_CHECK( hierarchy.empty() );
+		int data{};
+		auto index = hierarchy.add( &data );
+		CT_EQUAL( hierarchy.size(), 1u );
+		CT_CHECK( hierarchy.getData( index ) == &data );
+		CT_EQUAL( hierarchy.getParent( index ), TransformHierarchy::InvalidIndex );
+		CT_CHECK( hierarchy.isDirty() );
+		hierarchy.update();
+		CT_CHECK( !hierarchy.isDirty() );
+		CT_EQUAL( hierarchy.getChanged().size(), 1u );
+		CT_CHECK( isNear( hierarchy.getWorldMatrix( index ), Matrix4x4f{ 1.0f } ) );
+
+		Point3f position{ 1.0f, 2.0f, 3.0f };
+		auto orientation = Quaternion::fromAxisAngle( Point3f{ 0.0f, 1.0f, 0.0f }, 45.0_degrees );
+		Point3f scale{ 2.0f, 2.0f, 2.0f };
+		hierarchy.setLocal( index, position, orientation, scale );
+		CT_CHECK( hierarchy.isDirty() );
+		hierarchy.update();
+		CT_CHECK( isNear( hierarchy.getWorldMatrix( index ), getTransform( position, orientation, scale ) ) );
+		CT_CHECK( isNear( hierarchy.getWorldPosition( index ), position ) );
+		CT_CHECK( isNear( hierarchy.getWorldScale( index ), scale ) );
+		CT_CHECK( hierarchy.getWorldOrientation( index ) == orientation );
+
+		hierarchy.update();
+		CT_CHECK( hierarchy.getChanged().empty() );
+	}
+
+	void CastorUtilsTransformHierarchyTest::Chain()
+	{
+		TransformHierarchy hierarchy;
+		std::vector< uint32_t > indices;
+		std::vector< Matrix4x4f > locals;
+		// Each transform is the child of the next one, so children get lower indices than their parents.
+		for ( uint32_t i = 0u; i < 5u; ++i )
+		{
+			indices.push_back( hierarchy.add( nullptr ) );
+		}
+
+		for ( uint32_t i = 0u; i < 5u; ++i )
+		{
+			Point3f position{ float( i ), 1.0f, 0.0f };
+			auto orientation = Quaternion::fromAxisAngle( Point3f{ 0.0f, 0.0f, 1.0f }, Angle::fromDegrees( 10.0f * float( i ) ) );
+			Point3f scale{ 1.0f, 1.0f + float( i ) * 0.1f, 1.0f };
+			hierarchy.setLocal( indices[i], position, orientation, scale );
+			locals.push_back( getTransform( position, orientation, scale ) );
+
+			if ( i > 0u )
+			{
+				hierarchy.setParent( indices[i - 1u], indices[i] );
+			}
+		}
+
+		hierarchy.update();
+		CT_EQUAL( hierarchy.getChanged().size(), 5u );
+		auto expected = locals[4];
+		CT_CHECK( isNear( hierarchy.getWorldMatrix( indices[4] ), expected ) );
+		CT_EQUAL( hierarchy.getDepth( indices[4] ), 0u );
+
+		for ( uint32_t i = 4u; i > 0u; --i )
+		{
+			expected = expected * locals[i - 1u];
+			CT_CHECK( isNear( hierarchy.getWorldMatrix( indices[i - 1u] ), expected ) );
+			CT_EQUAL( hierarchy.getDepth( indices[i - 1u] ), 5u - i );
+		}
+
+		CT_CHECK( isNear( hierarchy.getWorldScale( indices[0] )
+			, Point3f{ 1.0f, 1.0f * 1.1f * 1.2f * 1.3f * 1.4f, 1.0f } ) );
+	}
+
+	void CastorUtilsTransformHierarchyTest::Reparent()
+	{
+		TransformHierarchy hierarchy;
+		auto parent1 = hierarchy.add( nullptr );
+		auto parent2 = hierarchy.add( nullptr );
+		auto child = hierarchy.add( nullptr );
+		hierarchy.setLocal( parent1, Point3f{ 1.0f, 0.0f, 0.0f }, Quaternion::identity(), Point3f{ 1.0f, 1.0f, 1.0f } );
+		hierarchy.setLocal( parent2, Point3f{ 0.0f, 2.0f, 0.0f }, Quaternion::identity(), Point3f{ 1.0f, 1.0f, 1.0f } );
+		hierarchy.setLocal( child, Point3f{ 0.0f, 0.0f, 3.0f }, Quaternion::identity(), Point3f{ 1.0f, 1.0f, 1.0f } );
+		hierarchy.setParent( child, parent1 );
+		hierarchy.update();
+		CT_CHECK( isNear( hierarchy.getWorldPosition( child ), Point3f{ 1.0f, 0.0f, 3.0f } ) );
+
+		hierarchy.setParent( child, parent2 );
+		hierarchy.update();
+		CT_CHECK( isNear( hierarchy.getWorldPosition( child ), Point3f{ 0.0f, 2.0f, 3.0f } ) );
+		CT_CHECK( isChanged( hierarchy, child ) );
+
+		hierarchy.setParent( child, TransformHierarchy::InvalidIndex );
+		hierarchy.update();
+		CT_CHECK( isNear( hierarchy.getWorldPosition( child ), Point3f{ 0.0f, 0.0f, 3.0f } ) );
+	}
+
+	void CastorUtilsTransformHierarchyTest::Remove()
+	{
+		TransformHierarchy hierarchy;
+		auto parent = hierarchy.add( nullptr );
+		auto child = hierarchy.add( nullptr );
+		hierarchy.setLocal( parent, Point3f{ 1.0f, 0.0f, 0.0f }, Quaternion::identity(), Point3f{ 1.0f, 1.0f, 1.0f } );
+		hierarchy.setLocal( child, Point3f{ 0.0f, 1.0f, 0.0f }, Quaternion::identity(), Point3f{ 1.0f, 1.0f, 1.0f } );
+		hierarchy.setParent( child, parent );
+		hierarchy.update();
+		CT_CHECK( isNear( hierarchy.getWorldPosition( child ), Point3f{ 1.0f, 1.0f, 0.0f } ) );
+
+		hierarchy.remove( parent );
+		CT_EQUAL( hierarchy.size(), 1u );
+		CT_EQUAL( hierarchy.getParent( child ), TransformHierarchy::InvalidIndex );
+		hierarchy.update();
+		CT_CHECK( isNear( hierarchy.getWorldPosition( child ), Point3f{ 0.0f, 1.0f, 0.0f } ) );
+
+		// The freed slot is reused.
+		CT_EQUAL( hierarchy.add( nullptr ), parent );
+		CT_EQUAL( hierarchy.size(), 2u );
+		hierarchy.clear();
+		CT_CHECK( hierarchy.empty() );
+	}
+
+	void CastorUtilsTransformHierarchyTest::OnlyChanged()
+	{
+		TransformHierarchy hierarchy;
+		auto root = hierarchy.add( nullptr );
+		auto branch1 = hierarchy.add( nullptr );
+		auto leaf1 = hierarchy.add( nullptr );
+		auto branch2 = hierarchy.add( nullptr );
+		auto leaf2 = hierarchy.add( nullptr );
+		hierarchy.setParent( branch1, root );
+		hierarchy.setParent( leaf1, branch1 );
+		hierarchy.setParent( branch2, root );
+		hierarchy.setParent( leaf2, branch2 );
+		hierarchy.update();
+		CT_EQUAL( hierarchy.getChanged().size(), 5u );
+
+		hierarchy.setLocal( branch2, Point3f{ 0.0f, 0.0f, 5.0f }, Quaternion::identity(), Point3f{ 1.0f, 1.0f, 1.0f } );
+		hierarchy.update();
+		CT_EQUAL( hierarchy.getChanged().size(), 2u );
+		CT_CHECK( isChanged( hierarchy, branch2 ) );
+		CT_CHECK( isChanged( hierarchy, leaf2 ) );
+		CT_CHECK( isNear( hierarchy.getWorldPosition( leaf2 ), Point3f{ 0.0f, 0.0f, 5.0f } ) );
+		CT_CHECK( isNear( hierarchy.getWorldPosition( leaf1 ), Point3f{ 0.0f, 0.0f, 0.0f } ) );
+
+		hierarchy.setLocal( root, Point3f{ 1.0f, 0.0f, 0.0f }, Quaternion::identity(), Point3f{ 1.0f, 1.0f, 1.0f } );
+		hierarchy.update();
+		CT_EQUAL( hierarchy.getChanged().size(), 5u );
+		CT_CHECK( isNear( hierarchy.getWorldPosition( leaf2 ), Point3f{ 1.0f, 0.0f, 5.0f } ) );
+		CT_CHECK( isNear( hierarchy.getWorldPosition( leaf1 ), Point3f{ 1.0f, 0.0f, 0.0f } ) );
+	}
+
+	void CastorUtilsTransformHierarchyTest::Incremental()
+	{
+		TransformHierarchy hierarchy;
+		auto root = hierarchy.add( nullptr );
+		auto branch = hierarchy.add( nullptr );
+		auto leaf = hierarchy.add( nullptr );
+		auto other = hierarchy.add( nullptr );
+		hierarchy.setLocal( root, Point3f{ 1.0f, 0.0f, 0.0f }, Quaternion::identity(), Point3f{ 1.0f, 1.0f, 1.0f } );
+		hierarchy.setLocal( branch, Point3f{ 0.0f, 1.0f, 0.0f }, Quaternion::identity(), Point3f{ 1.0f, 1.0f, 1.0f } );
+		hierarchy.setLocal( leaf, Point3f{ 0.0f, 0.0f, 1.0f }, Quaternion::identity(), Point3f{ 1.0f, 1.0f, 1.0f } );
+		hierarchy.setParent( branch, root );
+		hierarchy.setParent( leaf, branch );
+		hierarchy.update();
+		CT_EQUAL( hierarchy.getDepth( leaf ), 2u );
+
+		// Adding a transform only updates it.
+		auto added = hierarchy.add( nullptr );
+		hierarchy.update();
+		CT_EQUAL( hierarchy.getChanged().size(), 1u );
+		CT_CHECK( isChanged( hierarchy, added ) );
+
+		// Moving a subtree updates its depths, and only it.
+		hierarchy.setParent( branch, other );
+		CT_EQUAL( hierarchy.getDepth( branch ), 1u );
+		CT_EQUAL( hierarchy.getDepth( leaf ), 2u );
+		hierarchy.setParent( other, added );
+		CT_EQUAL( hierarchy.getDepth( leaf ), 3u );
+		hierarchy.update();
+		CT_EQUAL( hierarchy.getChanged().size(), 3u );
+		CT_CHECK( !isChanged( hierarchy, root ) );
+		CT_CHECK( isNear( hierarchy.getWorldPosition( leaf ), Point3f{ 0.0f, 1.0f, 1.0f } ) );
+
+		// Removing a transform only updates its children subtrees, which become roots.
+		hierarchy.remove( other );
+		CT_EQUAL( hierarchy.getParent( branch ), TransformHierarchy::InvalidIndex );
+		CT_EQUAL( hierarchy.getDepth( branch ), 0u );
+		CT_EQUAL( hierarchy.getDepth( leaf ), 1u );
+		hierarchy.update();
+		CT_EQUAL( hierarchy.getChanged().size(), 2u );
+		CT_CHECK( isChanged( hierarchy, branch ) );
+		CT_CHECK( isChanged( hierarchy, leaf ) );
+
+		// A removed transform's slot, reused before the update, is updated once.
+		hierarchy.setLocal( added, Point3f{ 0.0f, 0.0f, 2.0f }, Quaternion::identity(), Point3f{ 1.0f, 1.0f, 1.0f } );
+		hierarchy.remove( added );
+		CT_EQUAL( hierarchy.add( nullptr ), added );
+		hierarchy.update();
+		CT_EQUAL( hierarchy.getChanged().size(), 1u );
+		CT_CHECK( isNear( hierarchy.getWorldPosition( added ), Point3f{ 0.0f, 0.0f, 0.0f } ) );
+	}
+
+	//*********************************************************************************************
+
+	CastorUtilsTransformHierarchyBench::CastorUtilsTransformHierarchyBench()
+		: BenchCase( "CastorUtilsTransformHierarchyBench" )
+	{
+		std::default_random_engine engine;
+		std::uniform_real_distribution< float > distribution{ -1.0f, 1.0f };
+		std::vector< uint32_t > indices;
+		indices.reserve( BenchNodes );
+
+		// Random trees, each node's parent being one of the previously added nodes.
+		for ( uint32_t i = 0u; i < BenchNodes; ++i )
+		{
+			auto index = m_hierarchy.add( nullptr );
+			m_hierarchy.setLocal( index
+				, Point3f{ distribution( engine ), distribution( engine ), distribution( engine ) }
+				, Quaternion::fromAxisAngle( Point3f{ 0.0f, 1.0f, 0.0f }, Angle::fromDegrees( 180.0f * distribution( engine ) ) )
+				, Point3f{ 1.0f, 1.0f, 1.0f } );
+
+			if ( i > 0u && i % 16u )
+			{
+				std::uniform_int_distribution< uint32_t > parents{ i > 64u ? i - 64u : 0u, i - 1u };
+				m_hierarchy.setParent( index, indices[parents( engine )] );
+			}
+
+			indices.push_back( index );
+		}
+
+		std::uniform_int_distribution< uint32_t > moved{ 0u, BenchNodes - 1u };
+
+		for ( uint32_t i = 0u; i < BenchMoved; ++i )
+		{
+			m_moved.push_back( indices[moved( engine )] );
+		}
+
+		m_hierarchy.update();
+	}
+
+	CastorUtilsTransformHierarchyBench::~CastorUtilsTransformHierarchyBench()
+	{
+	}
+
+	void CastorUtilsTransformHierarchyBench::Execute()
+	{
+		BENCHMARK( UpdateAll, BenchCalls );
+		BENCHMARK( UpdateSome, BenchCalls );
+	}
+
+	void CastorUtilsTransformHierarchyBench::UpdateAll()
+	{
+		// Moving all the roots (one node out of 16) updates the whole hierarchy.
+		m_angle += 1.0f;
+
+		for ( uint32_t i = 0u; i < BenchNodes; i += 16u )
+		{
+			m_hierarchy.setLocal( i
+				, Point3f{ 0.0f, 0.0f, 0.0f }
+				, Quaternion::fromAxisAngle( Point3f{ 0.0f, 1.0f, 0.0f }, Angle::fromDegrees( m_angle ) )
+				, Point3f{ 1.0f, 1.0f, 1.0f } );
+		}
+
+		m_hierarchy.update();
+		doNotOptimizeAway( m_hierarchy.getChanged().size() );
+	}
+
+	void CastorUtilsTransformHierarchyBench::UpdateSome()
+	{
+		m_angle += 1.0f;
+
+		for ( auto index : m_moved )
+		{
+			m_hierarchy.setLocal( index
+				, Point3f{ 0.0f, 0.0f, 0.0f }
+				, Quaternion::fromAxisAngle( Point3f{ 0.0f, 1.0f, 0.0f }, Angle::fromDegrees( m_angle ) )
+				, Point3f{ 1.0f, 1.0f, 1.0f } );
+		}
+
+		m_hierarchy.update();
+		doNotOptimizeAway( m_hierarchy.getChanged().size() );
+	}
+}
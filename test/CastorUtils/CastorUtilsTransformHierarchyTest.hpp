@@ -0,0 +1,50 @@
+/* See LICENSE file in root folder */
+#ifndef ___CUT_TransformHierarchyTest_H___
+#define ___CUT_TransformHierarchyTest_H___
+
+#include "CastorUtilsTestPrerequisites.hpp"
+
+#include <CastorUtils/Math/TransformHierarchy.hpp>
+
+namespace Testing
+{
+	class CastorUtilsTransformHierarchyTest
+		: public TestCase
+	{
+	public:
+		CastorUtilsTransformHierarchyTest();
+		virtual ~CastorUtilsTransformHierarchyTest();
+
+	private:
+		void doRegisterTests() override;
+
+	private:
+		void Multiply();
+		void Root();
+		void Chain();
+		void Reparent();
+		void Remove();
+		void OnlyChanged();
+		void Incremental();
+	};
+
+	class CastorUtilsTransformHierarchyBench
+		: public BenchCase
+	{
+	public:
+		CastorUtilsTransformHierarchyBench();
+		virtual ~CastorUtilsTransformHierarchyBench();
+		virtual void Execute();
+
+	private:
+		void UpdateAll();
+		void UpdateSome();
+
+	private:
+		castor::TransformHierarchy m_hierarchy;
+		std::vector< uint32_t > m_moved;
+		float m_angle{ 0.0f };
+	};
+}
+
+#endif
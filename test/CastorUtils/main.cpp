@@ -1,7 +1,12 @@
 #include "OpenClBench.hpp"
 #include "CastorUtilsArrayViewTest.hpp"
+#include "CastorUtilsAsyncJobQueueTest.hpp"
+#include "CastorUtilsBoundingBoxArrayTest.hpp"
+#include "CastorUtilsDynamicBvhTest.hpp"
+#include "CastorUtilsOcclusionBufferTest.hpp"
 #include "CastorUtilsBuddyAllocatorTest.hpp"
 #include "CastorUtilsDynamicBitsetTest.hpp"
+#include "CastorUtilsJobSchedulerTest.hpp"
 #include "CastorUtilsMatrixTest.hpp"
 #include "CastorUtilsObjectsPoolTest.hpp"
 #include "CastorUtilsPixelBufferExtractTest.hpp"
@@ -10,8 +15,10 @@
 #include "CastorUtilsSignalTest.hpp"
 #include "CastorUtilsSpeedTest.hpp"
 #include "CastorUtilsStringTest.hpp"
+#include "CastorUtilsTaskGraphTest.hpp"
 #include "CastorUtilsTextWriterTest.hpp"
 #include "CastorUtilsThreadPoolTest.hpp"
+#include "CastorUtilsTransformHierarchyTest.hpp"
 #include "CastorUtilsUniqueTest.hpp"
 #include "CastorUtilsWorkerThreadTest.hpp"
 #include "CastorUtilsZipTest.hpp"
@@ -47,10 +54,22 @@ int main( int argc, char const * argv[] )
 	Testing::registerType( std::make_unique< Testing::CastorUtilsSignalTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsWorkerThreadTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsThreadPoolTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsJobSchedulerTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsJobSchedulerBench >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsAsyncJobQueueTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsTaskGraphTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsArrayViewTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsUniqueTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsMatrixTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsMatrixBench >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsBoundingBoxArrayTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsBoundingBoxArrayBench >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsDynamicBvhTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsDynamicBvhBench >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsOcclusionBufferTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsOcclusionBufferBench >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsTransformHierarchyTest >() );
+	Testing::registerType( std::make_unique< Testing::CastorUtilsTransformHierarchyBench >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsPixelFormatTest >() );
 	//Testing::registerType( std::make_unique< Testing::CastorUtilsStringTest >() );
 	Testing::registerType( std::make_unique< Testing::CastorUtilsZipTest >() );
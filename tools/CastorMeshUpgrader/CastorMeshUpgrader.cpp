@@ -229,6 +229,7 @@ void printUsage()
 {
 	std::cout << "Castor Mesh Upgrader is a tool that allows you to upgrade your CMSH files to the latest CMSH version (works for CMSH and CSKL files)." << std::endl;
 	std::cout << "Note that if the .cmsh file contains a skeleton, it will be written in its own .cskl file." << std::endl;
+	std::cout << "CMSH 1.x files (big endian) are converted to the CMSH 2 format (little endian, with aligned data blocks)." << std::endl;
 	std::cout << "Usage:" << std::endl;
 	std::cout << "CastorMeshUpgrader FILE [-o NAME]" << std::endl;
 	std::cout << "  FILE must be a .cmsh or .cskl file." << std::endl;
@@ -353,9 +354,8 @@ bool doParseObject( castor3d::RenderDevice const & device
 
 	try
 	{
-		castor::BinaryFile file{ path, castor::File::OpenMode::eRead };
 		castor3d::BinaryParser< T > parser;
-		result = parser.parse( object, file );
+		result = parser.parse( object, path );
 	}
 	catch ( castor::Exception & exc )
 	{
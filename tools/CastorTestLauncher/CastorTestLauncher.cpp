@@ -6,6 +6,7 @@
 
 #include <Castor3D/Engine.hpp>
 #include <Castor3D/Cache/PluginCache.hpp>
+#include <Castor3D/Cache/ShaderCache.hpp>
 
 #include <CastorUtils/Data/File.hpp>
 #include <CastorUtils/Exception/Exception.hpp>
@@ -43,6 +44,9 @@ namespace test_launcher
 		wxCmdLineParser parser( wxApp::argc, wxApp::argv );
 		parser.AddSwitch( wxT( "h" ), wxT( "help" ), _( "Displays this help." ) );
 		parser.AddSwitch( wxT( "g" ), wxT( "generate" ), _( "Generates the reference image, using Vulkan renderer." ) );
+		parser.AddOption( wxT( "c" ), wxT( "shader-cache" ), _( "Defines the folder used to store the compiled shaders cache (disabled if not set)." ), wxCMD_LINE_VAL_STRING );
+		parser.AddOption( wxT( "m" ), wxT( "pipeline-manifest" ), _( "Defines the file used to record the pipeline variants, and to prewarm them on next runs (disabled if not set)." ), wxCMD_LINE_VAL_STRING );
+		parser.AddSwitch( wxT( "p" ), wxT( "populate" ), _( "Only renders the scene, to populate the shader cache, without saving any image." ) );
 		parser.AddParam( _( "The initial scene file" ), wxCMD_LINE_VAL_STRING, wxCMD_LINE_OPTION_MANDATORY );
 
 		for ( auto & plugin : list )
@@ -95,6 +99,29 @@ namespace test_launcher
 			{
 				m_fileName = castor::Path( parser.GetParam( 0 ).mb_str( wxConvUTF8 ).data() );
 			}
+
+			wxString shaderCache;
+
+			if ( parser.Found( wxT( "c" ), &shaderCache ) )
+			{
+				m_shaderCacheFolder = castor::Path( shaderCache.mb_str( wxConvUTF8 ).data() );
+			}
+
+			wxString pipelineManifest;
+
+			if ( parser.Found( wxT( "m" ), &pipelineManifest ) )
+			{
+				m_pipelineManifestFile = castor::Path( pipelineManifest.mb_str( wxConvUTF8 ).data() );
+			}
+
+			m_populateShaderCache = parser.Found( wxT( "p" ) );
+
+			if ( m_populateShaderCache && m_shaderCacheFolder.empty() )
+			{
+				parser.AddUsageText( _( "Populating the shader cache requires a shader cache folder." ) );
+				parser.Usage();
+				result = false;
+			}
 		}
 
 		return result;
@@ -133,6 +160,9 @@ namespace test_launcher
 		}
 
 		castor->loadRenderer( m_rendererType );
+		// Reference images are generated from freshly compiled shaders, unless a cache folder is explicitly given.
+		castor->getShaderProgramCache().setDiskCacheFolder( m_shaderCacheFolder );
+		castor->getShaderProgramCache().setPipelineManifestFile( m_pipelineManifestFile );
 		return castor;
 	}
 
@@ -162,8 +192,18 @@ namespace test_launcher
 						{
 							Logger::logInfo( cuT( "Load scene" ) );
 							mainFrame->loadScene( m_fileName );
-							Logger::logInfo( cuT( "Save frame" ) );
-							mainFrame->saveFrame( m_outputFileSuffix );
+
+							if ( m_populateShaderCache )
+							{
+								Logger::logInfo( cuT( "Populate shader cache" ) );
+								mainFrame->renderFrames();
+							}
+							else
+							{
+								Logger::logInfo( cuT( "Save frame" ) );
+								mainFrame->saveFrame( m_outputFileSuffix );
+							}
+
 							Logger::logInfo( cuT( "Cleanup frame" ) );
 							mainFrame->cleanup();
 						}
@@ -34,6 +34,9 @@ namespace test_launcher
 		castor::String m_rendererType;
 		castor::String m_outputFileSuffix;
 		castor::Path m_fileName;
+		castor::Path m_shaderCacheFolder;
+		castor::Path m_pipelineManifestFile;
+		bool m_populateShaderCache{ false };
 	};
 }
 
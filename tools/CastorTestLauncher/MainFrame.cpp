@@ -302,18 +302,24 @@ namespace test_launcher
 		return m_renderWindow != nullptr;
 	}
 
-	void MainFrame::saveFrame( castor::String const & suffix )
+	void MainFrame::renderFrames()
 	{
 		if ( m_renderWindow )
 		{
-			wxBitmap bitmap;
-
 			// Prerender 10 frames, for environment maps.
 			for ( auto i = 0; i <= 10; ++i )
 			{
 				m_engine.getRenderLoop().renderSyncFrame( 25_ms );
 			}
+		}
+	}
 
+	void MainFrame::saveFrame( castor::String const & suffix )
+	{
+		if ( m_renderWindow )
+		{
+			wxBitmap bitmap;
+			renderFrames();
 			m_renderWindow->enableSaveFrame();
 			m_engine.getRenderLoop().renderSyncFrame( 25_ms );
 			auto buffer = m_renderWindow->getSavedFrame();
@@ -25,6 +25,7 @@ namespace test_launcher
 
 		bool initialise();
 		bool loadScene( wxString const & fileName );
+		void renderFrames();
 		void saveFrame( castor::String const & suffix );
 		void cleanup();
 
@@ -138,42 +138,53 @@ namespace GuiCommon
 		wxString extension;
 		wxString source;
 
-		switch ( language )
+		if ( !m_module.shader )
 		{
-		case GuiCommon::ShaderLanguage::SPIRV:
+			// Modules loaded from the SPIR-V disk cache don't have a shader AST.
 			extension = wxT( ".spirv" );
-			source = make_wxString( spirv::writeSpirv( *m_module.shader
-				, true ) );
-			break;
+			source = m_module.source.empty()
+				? wxString{ _( "Shader module loaded from the SPIR-V cache, no source available." ) }
+				: make_wxString( m_module.source );
+		}
+		else
+		{
+			switch ( language )
+			{
+			case GuiCommon::ShaderLanguage::SPIRV:
+				extension = wxT( ".spirv" );
+				source = make_wxString( spirv::writeSpirv( *m_module.shader
+					, true ) );
+				break;
 #if C3D_HasGLSL
-		case GuiCommon::ShaderLanguage::GLSL:
-			extension = wxT( ".glsl" );
-			source = make_wxString( glsl::compileGlsl( *m_module.shader
-				, {}
-				, {
-					m_module.shader->getType(),
-					460,
-					true,
-					false,
-					false,
-					true,
-					true,
-					true,
-					true,
-				} ) );
-			break;
+			case GuiCommon::ShaderLanguage::GLSL:
+				extension = wxT( ".glsl" );
+				source = make_wxString( glsl::compileGlsl( *m_module.shader
+					, {}
+					, {
+						m_module.shader->getType(),
+						460,
+						true,
+						false,
+						false,
+						true,
+						true,
+						true,
+						true,
+					} ) );
+				break;
 #endif
 #if GC_HasHLSL
-		case GuiCommon::ShaderLanguage::HLSL:
-			extension = wxT( ".hlsl" );
-			source = make_wxString( hlsl::compileHlsl( *m_module.shader
-				, {}
-				, {
-					m_module.shader->getType(),
-					false,
-				} ) );
-			break;
+			case GuiCommon::ShaderLanguage::HLSL:
+				extension = wxT( ".hlsl" );
+				source = make_wxString( hlsl::compileHlsl( *m_module.shader
+					, {}
+					, {
+						m_module.shader->getType(),
+						false,
+					} ) );
+				break;
 #endif
+			}
 		}
 
 		m_editor->setText( source );
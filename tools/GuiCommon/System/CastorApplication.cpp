@@ -219,6 +219,7 @@ namespace GuiCommon
 		parser.AddSwitch( wxT( "a" ), wxT( "validate" ), _( "Enables rendering API validation." ) );
 		parser.AddSwitch( wxT( "u" ), wxT( "unlimited" ), _( "Disables FPS limit." ) );
 		parser.AddOption( wxT( "l" ), wxT( "log" ), _( "Defines log level (from 0=trace to 4=error)." ), wxCMD_LINE_VAL_NUMBER );
+		parser.AddOption( wxT( "f" ), wxT( "frames" ), _( "Defines the number of frames in flight (from 1 to 2)." ), wxCMD_LINE_VAL_NUMBER );
 		parser.AddParam( _( "The initial scene file." ), wxCMD_LINE_VAL_STRING, wxCMD_LINE_PARAM_OPTIONAL );
 
 		ashes::RendererList list;
@@ -258,6 +259,12 @@ namespace GuiCommon
 
 			m_validation = parser.Found( wxT( 'a' ) );
 			m_unlimitedFps = parser.Found( wxT( 'u' ) );
+			long frames;
+
+			if ( parser.Found( wxT( "f" ), &frames ) )
+			{
+				m_framesInFlight = uint32_t( std::max( 1l, frames ) );
+			}
 
 			for ( auto & plugin : list )
 			{
@@ -325,6 +332,7 @@ namespace GuiCommon
 		castor::Logger::logInfo( m_internalName + cuT( " - Start" ) );
 
 		m_castor = std::make_shared< castor3d::Engine >( m_internalName, m_version, m_validation );
+		m_castor->setMaxFramesInFlight( m_framesInFlight );
 		doloadPlugins( p_splashScreen );
 
 		p_splashScreen.Step( _( "Initialising Castor3D" ), 1 );
@@ -217,6 +217,7 @@ namespace GuiCommon
 		castor3d::Version m_version;
 		bool m_validation;
 		bool m_unlimitedFps{ false };
+		uint32_t m_framesInFlight{ 1u };
 	};
 }
 